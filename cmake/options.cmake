@@ -15,3 +15,4 @@ option(USE_SCRIPTPCH    "Use precompiled headers when compiling scripts"
 option(USE_COREPCH      "Use precompiled headers when compiling servers"              1)
 option(WITH_WARNINGS    "Show all warnings during compile"                            0)
 option(WITH_COREDEBUG   "Include additional debug-code in core"                       0)
+option(WITH_BENCHMARKS  "Include the .bench commands timing core code (dev builds)"   0)
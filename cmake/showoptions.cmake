@@ -63,6 +63,13 @@ else()
   message("* Use coreside debug     : No  (default)")
 endif()
 
+if( WITH_BENCHMARKS )
+  message("* Build .bench commands  : Yes")
+  add_definitions(-DTRINITY_BENCHMARKS)
+else()
+  message("* Build .bench commands  : No  (default)")
+endif()
+
 if( WIN32 )
   if( USE_MYSQL_SOURCES )
     message("* Use MySQL sourcetree   : Yes (default)")
@@ -32,6 +32,7 @@
 #include <cmath>
 
 #define MAX_STACK_SIZE 64
+#define BIH_RAY_PACKET_SIZE 32
 
 static inline uint32 floatToRawIntBits(float f)
 {
@@ -256,6 +257,23 @@ class BIH
             }
         }
 
+        /**
+        Traces several rays through the tree at once, up to BIH_RAY_PACKET_SIZE share each traversal.
+        Every node is fetched once for all rays that can still reach it and the slab tests are done
+        lane by lane on plain arrays, which the compiler can turn into SIMD code.
+        This is an any hit query: a ray leaves the packet on its first hit, so use it for line of sight
+        and not where the nearest hit is needed. hits[i] tells if rays[i] hit something within maxDist[i].
+        Returns the number of nodes visited.
+        */
+        template<typename RayCallback>
+        uint32 intersectRays(const G3D::Ray* rays, const float* maxDist, bool* hits, uint32 count, RayCallback& intersectCallback) const
+        {
+            uint32 visits = 0;
+            for (uint32 first = 0; first < count; first += BIH_RAY_PACKET_SIZE)
+                visits += intersectRayPacket(rays + first, maxDist + first, hits + first, std::min<uint32>(count - first, BIH_RAY_PACKET_SIZE), intersectCallback);
+            return visits;
+        }
+
         template<typename IsectCallback>
         void intersectPoint(const G3D::Vector3 &p, IsectCallback& intersectCallback) const
         {
@@ -356,6 +374,208 @@ class BIH
             float tfar;
         };
 
+        struct PacketStackNode
+        {
+            uint32 node;
+            uint32 mask;
+            float tnear[BIH_RAY_PACKET_SIZE];
+            float tfar[BIH_RAY_PACKET_SIZE];
+        };
+
+        template<typename RayCallback>
+        uint32 intersectRayPacket(const G3D::Ray* rays, const float* maxDist, bool* hits, uint32 count, RayCallback& intersectCallback) const
+        {
+            // ray data split per axis so the per node loops below run over contiguous floats
+            float org[3][BIH_RAY_PACKET_SIZE];
+            float invDir[3][BIH_RAY_PACKET_SIZE];
+            bool positive[3][BIH_RAY_PACKET_SIZE];
+            float intervalMin[BIH_RAY_PACKET_SIZE];
+            float intervalMax[BIH_RAY_PACKET_SIZE];
+            uint32 active = 0;
+
+            for (uint32 i = 0; i < count; ++i)
+            {
+                hits[i] = false;
+
+                // same clipping against the tree bounds as intersectRay()
+                float tMin = -1.f;
+                float tMax = -1.f;
+                bool missed = false;
+                G3D::Vector3 const& o = rays[i].origin();
+                G3D::Vector3 const& dir = rays[i].direction();
+                for (int a = 0; a < 3; ++a)
+                {
+                    org[a][i] = o[a];
+                    invDir[a][i] = 1.f / dir[a];
+                    positive[a][i] = !(floatToRawIntBits(dir[a]) >> 31);
+                    if (G3D::fuzzyNe(dir[a], 0.0f))
+                    {
+                        float t1 = (bounds.low()[a]  - o[a]) * invDir[a][i];
+                        float t2 = (bounds.high()[a] - o[a]) * invDir[a][i];
+                        if (t1 > t2)
+                            std::swap(t1, t2);
+                        if (t1 > tMin)
+                            tMin = t1;
+                        if (t2 < tMax || tMax < 0.f)
+                            tMax = t2;
+                        if (tMax <= 0 || tMin >= maxDist[i])
+                        {
+                            missed = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (missed || tMin > tMax)
+                    continue;
+
+                intervalMin[i] = std::max(tMin, 0.f);
+                intervalMax[i] = std::min(tMax, maxDist[i]);
+                active |= 1u << i;
+            }
+
+            uint32 visits = 0;
+            if (!active)
+                return visits;
+
+            // lanes that are not in the mask hold stale values, they are computed anyway and ignored
+            float leftMin[BIH_RAY_PACKET_SIZE], leftMax[BIH_RAY_PACKET_SIZE];
+            float rightMin[BIH_RAY_PACKET_SIZE], rightMax[BIH_RAY_PACKET_SIZE];
+            PacketStackNode stack[MAX_STACK_SIZE];
+            int stackPos = 0;
+            int node = 0;
+            uint32 mask = active;
+
+            while (true) {
+                while (true)
+                {
+                    ++visits;
+                    uint32 tn = tree[node];
+                    uint32 axis = (tn & (3 << 30)) >> 30;
+                    bool BVH2 = tn & (1 << 29);
+                    int offset = tn & ~(7 << 29);
+                    if (!BVH2)
+                    {
+                        if (axis < 3)
+                        {
+                            // "normal" interior node, left child is [.., clipLeft], right child is [clipRight, ..]
+                            float clipLeft = intBitsToFloat(tree[node + 1]);
+                            float clipRight = intBitsToFloat(tree[node + 2]);
+                            for (uint32 i = 0; i < count; ++i)
+                            {
+                                float tl = (clipLeft - org[axis][i]) * invDir[axis][i];
+                                float tr = (clipRight - org[axis][i]) * invDir[axis][i];
+                                leftMin[i] = positive[axis][i] ? intervalMin[i] : std::max(intervalMin[i], tl);
+                                leftMax[i] = positive[axis][i] ? std::min(intervalMax[i], tl) : intervalMax[i];
+                                rightMin[i] = positive[axis][i] ? std::max(intervalMin[i], tr) : intervalMin[i];
+                                rightMax[i] = positive[axis][i] ? intervalMax[i] : std::min(intervalMax[i], tr);
+                            }
+
+                            uint32 leftMask = 0;
+                            uint32 rightMask = 0;
+                            for (uint32 i = 0; i < count; ++i)
+                            {
+                                leftMask |= uint32(leftMin[i] <= leftMax[i]) << i;
+                                rightMask |= uint32(rightMin[i] <= rightMax[i]) << i;
+                            }
+                            leftMask &= mask;
+                            rightMask &= mask;
+
+                            // no front to back ordering, rays stop at any hit
+                            if (leftMask && rightMask)
+                            {
+                                stack[stackPos].node = offset + 3;
+                                stack[stackPos].mask = rightMask;
+                                std::copy(rightMin, rightMin + count, stack[stackPos].tnear);
+                                std::copy(rightMax, rightMax + count, stack[stackPos].tfar);
+                                stackPos++;
+                            }
+
+                            if (leftMask)
+                            {
+                                node = offset;
+                                mask = leftMask;
+                                std::copy(leftMin, leftMin + count, intervalMin);
+                                std::copy(leftMax, leftMax + count, intervalMax);
+                                continue;
+                            }
+
+                            if (rightMask)
+                            {
+                                node = offset + 3;
+                                mask = rightMask;
+                                std::copy(rightMin, rightMin + count, intervalMin);
+                                std::copy(rightMax, rightMax + count, intervalMax);
+                                continue;
+                            }
+                            // all rays pass between clip zones
+                            break;
+                        }
+                        else
+                        {
+                            // leaf - test some objects against every ray still in the packet
+                            int n = tree[node + 1];
+                            while (n > 0 && mask)
+                            {
+                                for (uint32 i = 0; i < count; ++i)
+                                {
+                                    if (!(mask & (1u << i)))
+                                        continue;
+
+                                    float dist = maxDist[i];
+                                    if (intersectCallback(rays[i], objects[offset], dist, true))
+                                    {
+                                        hits[i] = true;
+                                        mask &= ~(1u << i);
+                                        active &= ~(1u << i);
+                                    }
+                                }
+                                --n;
+                                ++offset;
+                            }
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        if (axis>2)
+                            return visits; // should not happen
+                        float clipLow = intBitsToFloat(tree[node + 1]);
+                        float clipHigh = intBitsToFloat(tree[node + 2]);
+                        uint32 nodeMask = 0;
+                        for (uint32 i = 0; i < count; ++i)
+                        {
+                            float tl = (clipLow - org[axis][i]) * invDir[axis][i];
+                            float th = (clipHigh - org[axis][i]) * invDir[axis][i];
+                            intervalMin[i] = std::max(intervalMin[i], positive[axis][i] ? tl : th);
+                            intervalMax[i] = std::min(intervalMax[i], positive[axis][i] ? th : tl);
+                            nodeMask |= uint32(intervalMin[i] <= intervalMax[i]) << i;
+                        }
+                        node = offset;
+                        mask &= nodeMask;
+                        if (!mask)
+                            break;
+                        continue;
+                    }
+                } // traversal loop
+                do
+                {
+                    // stack is empty?
+                    if (stackPos == 0)
+                        return visits;
+                    // move back up the stack, dropping rays that have hit something meanwhile
+                    stackPos--;
+                    mask = stack[stackPos].mask & active;
+                    if (!mask)
+                        continue;
+                    node = stack[stackPos].node;
+                    std::copy(stack[stackPos].tnear, stack[stackPos].tnear + count, intervalMin);
+                    std::copy(stack[stackPos].tfar, stack[stackPos].tfar + count, intervalMax);
+                    break;
+                } while (true);
+            }
+        }
+
         class BuildStats
         {
             private:
@@ -20,6 +20,7 @@
 #define _IVMAPMANAGER_H
 
 #include <string>
+#include <vector>
 #include "Define.h"
 
 //===========================================================
@@ -28,6 +29,11 @@
 This is the minimum interface to the VMapMamager.
 */
 
+namespace G3D
+{
+    class Vector3;
+}
+
 namespace VMAP
 {
 
@@ -60,7 +66,19 @@ namespace VMAP
             virtual void unloadMap(unsigned int pMapId, int x, int y) = 0;
             virtual void unloadMap(unsigned int pMapId) = 0;
 
+            /**
+            load the model files used by a map tile ahead of loadMap(), safe to call from any thread.
+            The models stay referenced until releasePrefetchedModels() is called with the filled list
+            */
+            virtual void prefetchMapTile(const char* pBasePath, unsigned int pMapId, int x, int y, std::vector<std::string>& models) = 0;
+            virtual void releasePrefetchedModels(const std::vector<std::string>& models) = 0;
+
             virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2) = 0;
+            /**
+            line of sight from one point to several targets (all in world coordinates), results[i] is set for targets[i].
+            The rays share one traversal of the map tree, nodeVisits (if given) is increased by the number of tree nodes visited
+            */
+            virtual void isInLineOfSight(unsigned int pMapId, float x, float y, float z, const G3D::Vector3* targets, bool* results, uint32 count, uint32* nodeVisits = NULL) = 0;
             virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
             /**
             test if we hit an object. return true if we hit one. rx, ry, rz will hold the hit position or the dest position, if no intersection was found
@@ -134,6 +134,30 @@ namespace VMAP
         }
     }
 
+    void VMapManager2::prefetchMapTile(const char* basePath, unsigned int mapId, int x, int y, std::vector<std::string>& models)
+    {
+        if (!isMapLoadingEnabled())
+            return;
+
+        std::vector<std::string> names;
+        StaticMapTree::GetTileModelNames(std::string(basePath), mapId, x, y, names);
+
+        std::string modelPath = basePath;
+        if (modelPath.length() > 0 && modelPath[modelPath.length()-1] != '/' && modelPath[modelPath.length()-1] != '\\')
+            modelPath.push_back('/');
+
+        // only the model files are shared between threads, the tile itself is linked into the tree by loadMap()
+        for (std::vector<std::string>::const_iterator itr = names.begin(); itr != names.end(); ++itr)
+            if (acquireModelInstance(modelPath, *itr))
+                models.push_back(*itr);
+    }
+
+    void VMapManager2::releasePrefetchedModels(const std::vector<std::string>& models)
+    {
+        for (std::vector<std::string>::const_iterator itr = models.begin(); itr != models.end(); ++itr)
+            releaseModelInstance(*itr);
+    }
+
     bool VMapManager2::isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2)
     {
         if (!isLineOfSightCalcEnabled() || DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LOS))
@@ -157,6 +181,63 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager2::isInLineOfSight(unsigned int mapId, float x, float y, float z, const Vector3* targets, bool* results, uint32 count, uint32* nodeVisits)
+    {
+        if (!isLineOfSightCalcEnabled() || DisableMgr::IsDisabledFor(DISABLE_TYPE_VMAP, mapId, NULL, VMAP_DISABLE_LOS))
+        {
+            std::fill(results, results + count, true);
+            return;
+        }
+
+        if (!VMAP::CheckPosition(x, y, z))
+        {
+            std::fill(results, results + count, false);
+            return;
+        }
+
+        InstanceTreeMap::iterator instanceTree = iInstanceMapTrees.find(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            std::fill(results, results + count, true);
+            return;
+        }
+
+        Vector3 pos1 = convertPositionToInternalRep(x, y, z);
+        Vector3 traced[BIH_RAY_PACKET_SIZE];
+        uint32 index[BIH_RAY_PACKET_SIZE];
+        bool tracedResults[BIH_RAY_PACKET_SIZE];
+
+        // gather the targets that need a ray, a packet at a time
+        for (uint32 first = 0; first < count; first += BIH_RAY_PACKET_SIZE)
+        {
+            uint32 last = std::min<uint32>(first + BIH_RAY_PACKET_SIZE, count);
+            uint32 n = 0;
+            for (uint32 i = first; i < last; ++i)
+            {
+                if (!VMAP::CheckPosition(targets[i].x, targets[i].y, targets[i].z))
+                {
+                    results[i] = false;
+                    continue;
+                }
+
+                Vector3 pos2 = convertPositionToInternalRep(targets[i].x, targets[i].y, targets[i].z);
+                if (pos1 == pos2)
+                {
+                    results[i] = true;
+                    continue;
+                }
+
+                traced[n] = pos2;
+                index[n] = i;
+                ++n;
+            }
+
+            instanceTree->second->isInLineOfSight(pos1, traced, tracedResults, n, nodeVisits);
+            for (uint32 i = 0; i < n; ++i)
+                results[index[i]] = tracedResults[i];
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
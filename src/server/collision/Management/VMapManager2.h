@@ -91,7 +91,11 @@ namespace VMAP
             void unloadMap(unsigned int mapId, int x, int y);
             void unloadMap(unsigned int mapId);
 
+            void prefetchMapTile(const char* basePath, unsigned int mapId, int x, int y, std::vector<std::string>& models);
+            void releasePrefetchedModels(const std::vector<std::string>& models);
+
             bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2) ;
+            void isInLineOfSight(unsigned int mapId, float x, float y, float z, const G3D::Vector3* targets, bool* results, uint32 count, uint32* nodeVisits = NULL);
             /**
             fill the hit pos and return true, if an object was hit
             */
@@ -178,6 +178,55 @@ namespace VMAP
     }
     //=========================================================
     /**
+    Line of sight from one point to many, the rays are traced through the tree in packets.
+    results[i] is set for targets[i], nodeVisits (if given) is increased by the number of tree nodes visited.
+    */
+    void StaticMapTree::isInLineOfSight(const Vector3& origin, const Vector3* targets, bool* results, uint32 count, uint32* nodeVisits) const
+    {
+        G3D::Ray rays[BIH_RAY_PACKET_SIZE];
+        float maxDist[BIH_RAY_PACKET_SIZE];
+        bool hits[BIH_RAY_PACKET_SIZE];
+        uint32 index[BIH_RAY_PACKET_SIZE];
+        MapRayCallback intersectionCallBack(iTreeValues);
+
+        for (uint32 first = 0; first < count; first += BIH_RAY_PACKET_SIZE)
+        {
+            uint32 last = std::min<uint32>(first + BIH_RAY_PACKET_SIZE, count);
+            uint32 traced = 0;
+            for (uint32 i = first; i < last; ++i)
+            {
+                // same special cases as the single ray version
+                float dist = (targets[i] - origin).magnitude();
+                if (dist == std::numeric_limits<float>::max() ||
+                    dist == std::numeric_limits<float>::infinity() ||
+                    dist > std::numeric_limits<float>::max())
+                {
+                    results[i] = false;
+                    continue;
+                }
+
+                if (dist < 1e-10f)
+                {
+                    results[i] = true;
+                    continue;
+                }
+
+                rays[traced] = G3D::Ray::fromOriginAndDirection(origin, (targets[i] - origin)/dist);
+                maxDist[traced] = dist;
+                index[traced] = i;
+                ++traced;
+            }
+
+            uint32 visits = iTree.intersectRays(rays, maxDist, hits, traced, intersectionCallBack);
+            if (nodeVisits)
+                *nodeVisits += visits;
+
+            for (uint32 i = 0; i < traced; ++i)
+                results[index[i]] = !hits[i];
+        }
+    }
+    //=========================================================
+    /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
     Return the hit pos or the original dest pos
     */
@@ -277,6 +326,37 @@ namespace VMAP
         return success;
     }
 
+    //=========================================================
+    /**
+    Reads the names of the models spawned on a tile, without touching any loaded tree
+    */
+    bool StaticMapTree::GetTileModelNames(const std::string &vmapPath, uint32 mapID, uint32 tileX, uint32 tileY, std::vector<std::string> &models)
+    {
+        std::string basePath = vmapPath;
+        if (basePath.length() > 0 && basePath[basePath.length()-1] != '/' && basePath[basePath.length()-1] != '\\')
+            basePath.push_back('/');
+        std::string tilefile = basePath + getTileFileName(mapID, tileX, tileY);
+        FILE* tf = fopen(tilefile.c_str(), "rb");
+        if (!tf)
+            return false;
+
+        char chunk[8];
+        bool result = readChunk(tf, chunk, VMAP_MAGIC, 8);
+        uint32 numSpawns = 0;
+        if (result && fread(&numSpawns, sizeof(uint32), 1, tf) != 1)
+            result = false;
+        for (uint32 i=0; i<numSpawns && result; ++i)
+        {
+            ModelSpawn spawn;
+            uint32 referencedVal;
+            result = ModelSpawn::readFromFile(tf, spawn) && fread(&referencedVal, sizeof(uint32), 1, tf) == 1;
+            if (result)
+                models.push_back(spawn.name);
+        }
+        fclose(tf);
+        return result;
+    }
+
     //=========================================================
 
     bool StaticMapTree::InitMap(const std::string &fname, VMapManager2* vm)
@@ -64,11 +64,13 @@ namespace VMAP
             static uint32 packTileID(uint32 tileX, uint32 tileY) { return tileX<<16 | tileY; }
             static void unpackTileID(uint32 ID, uint32 &tileX, uint32 &tileY) { tileX = ID>>16; tileY = ID&0xFF; }
             static bool CanLoadMap(const std::string &basePath, uint32 mapID, uint32 tileX, uint32 tileY);
+            static bool GetTileModelNames(const std::string &basePath, uint32 mapID, uint32 tileX, uint32 tileY, std::vector<std::string> &models);
 
             StaticMapTree(uint32 mapID, const std::string &basePath);
             ~StaticMapTree();
 
             bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2) const;
+            void isInLineOfSight(const G3D::Vector3& origin, const G3D::Vector3* targets, bool* results, uint32 count, uint32* nodeVisits = NULL) const;
             bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
             float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
             bool getAreaInfo(G3D::Vector3 &pos, uint32 &flags, int32 &adtId, int32 &rootId, int32 &groupId) const;
@@ -20,12 +20,16 @@
 #include "MapTree.h"
 #include "BoundingIntervalHierarchy.h"
 #include "VMapDefinitions.h"
+#include "DelayExecutor.h"
 
 #include <set>
 #include <iomanip>
 #include <sstream>
 #include <iomanip>
 
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Guard_T.h>
+
 using G3D::Vector3;
 using G3D::AABox;
 using G3D::inf;
@@ -53,149 +57,185 @@ namespace VMAP
 
     //=================================================================
 
-    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName)
-        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iFilterMethod(NULL), iCurrentUniqueNameId(0)
-    {
-        //mkdir(iDestDir);
-        //init();
-    }
-
-    TileAssembler::~TileAssembler()
+    // Counts the jobs of one stage of convertWorld2() that are still running
+    class AssemblerJobBatch
     {
-        //delete iCoordModelMapping;
-    }
-
-    bool TileAssembler::convertWorld2()
-    {
-        bool success = readMapSpawns();
-        if (!success)
-            return false;
+        public:
+            AssemblerJobBatch() : iCondition(iLock), iPending(0) { }
 
-        // export Map data
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end() && success; ++map_iter)
-        {
-            // build global map tree
-            std::vector<ModelSpawn*> mapSpawns;
-            UniqueEntryMap::iterator entry;
-            printf("Calculating model bounds for map %u...\n", map_iter->first);
-            for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
+            void add()
             {
-                // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
-                if (entry->second.flags & MOD_M2)
-                {
-                    if (!calculateTransformedBound(entry->second))
-                        break;
-                }
-                else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
-                {
-                    /// @todo remove extractor hack and uncomment below line:
-                    //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
-                    entry->second.iBound = entry->second.iBound + Vector3(533.33333f*32, 533.33333f*32, 0.f);
-                }
-                mapSpawns.push_back(&(entry->second));
-                spawnedModelFiles.insert(entry->second.name);
+                ACE_GUARD(ACE_Thread_Mutex, guard, iLock);
+                ++iPending;
             }
 
-            printf("Creating map tree for map %u...\n", map_iter->first);
-            BIH pTree;
+            void finished()
+            {
+                ACE_GUARD(ACE_Thread_Mutex, guard, iLock);
+                --iPending;
+                iCondition.broadcast();
+            }
 
-            try
+            void wait()
             {
-                pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::getBounds);
+                ACE_GUARD(ACE_Thread_Mutex, guard, iLock);
+                while (iPending > 0)
+                    iCondition.wait();
             }
-            catch (std::exception& e)
+
+        private:
+            ACE_Thread_Mutex iLock;
+            ACE_Condition_Thread_Mutex iCondition;
+            uint32 iPending;
+    };
+
+    class AssemblerJob : public ACE_Method_Request
+    {
+        public:
+            AssemblerJob(char& pResult) : iResult(pResult), iBatch(NULL) { }
+
+            void setBatch(AssemblerJobBatch* pBatch) { iBatch = pBatch; }
+
+            virtual int call()
             {
-                printf("Exception ""%s"" when calling pTree.build", e.what());
-                return false;
+                iResult = run() ? 1 : 0;
+                if (iBatch)
+                    iBatch->finished();
+                return 0;
             }
 
-            // ===> possibly move this code to StaticMapTree class
-            std::map<uint32, uint32> modelNodeIdx;
-            for (uint32 i=0; i<mapSpawns.size(); ++i)
-                modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
+        protected:
+            virtual bool run() = 0;
 
-            // write map tree file
-            std::stringstream mapfilename;
-            mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << map_iter->first << ".vmtree";
-            FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
-            if (!mapfile)
+        private:
+            char& iResult;
+            AssemblerJobBatch* iBatch;
+    };
+
+    class ConvertMapJob : public AssemblerJob
+    {
+        public:
+            ConvertMapJob(TileAssembler& pAssembler, uint32 pMapId, MapSpawns* pSpawns, std::set<std::string>& pModelFiles, char& pResult)
+                : AssemblerJob(pResult), iAssembler(pAssembler), iMapId(pMapId), iSpawns(pSpawns), iModelFiles(pModelFiles) { }
+
+        protected:
+            bool run() { return iAssembler.convertMap(iMapId, iSpawns, iModelFiles); }
+
+        private:
+            TileAssembler& iAssembler;
+            uint32 iMapId;
+            MapSpawns* iSpawns;
+            std::set<std::string>& iModelFiles;
+    };
+
+    class ConvertModelJob : public AssemblerJob
+    {
+        public:
+            ConvertModelJob(TileAssembler& pAssembler, std::string const& pModelFilename, char& pResult)
+                : AssemblerJob(pResult), iAssembler(pAssembler), iModelFilename(pModelFilename) { }
+
+        protected:
+            bool run()
             {
-                success = false;
-                printf("Cannot open %s\n", mapfilename.str().c_str());
-                break;
+                std::cout << "Converting " << iModelFilename << std::endl;
+                return iAssembler.convertRawFile(iModelFilename);
             }
 
-            //general info
-            if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) success = false;
-            uint32 globalTileID = StaticMapTree::packTileID(65, 65);
-            pair<TileMap::iterator, TileMap::iterator> globalRange = map_iter->second->TileEntries.equal_range(globalTileID);
-            char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
-            if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) success = false;
-            // Nodes
-            if (success && fwrite("NODE", 4, 1, mapfile) != 1) success = false;
-            if (success) success = pTree.writeToFile(mapfile);
-            // global map spawns (WDT), if any (most instances)
-            if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) success = false;
-
-            for (TileMap::iterator glob=globalRange.first; glob != globalRange.second && success; ++glob)
+        private:
+            TileAssembler& iAssembler;
+            std::string iModelFilename;
+    };
+
+    // Runs and deletes the jobs, on the calling thread if a pool is not worth it or cannot be started
+    static void runJobs(std::vector<AssemblerJob*>& pJobs, uint32 pThreads)
+    {
+        if (pThreads > pJobs.size())
+            pThreads = uint32(pJobs.size());
+
+        DelayExecutor executor;
+        if (pThreads <= 1 || executor.activate(int(pThreads)) == -1)
+        {
+            for (uint32 i = 0; i < pJobs.size(); ++i)
             {
-                success = ModelSpawn::writeToFile(mapfile, map_iter->second->UniqueEntries[glob->second]);
+                pJobs[i]->call();
+                delete pJobs[i];
             }
+            return;
+        }
+
+        AssemblerJobBatch batch;
+        for (uint32 i = 0; i < pJobs.size(); ++i)
+        {
+            pJobs[i]->setBatch(&batch);
+            batch.add();
+            if (executor.execute(pJobs[i]) == -1)
+                batch.finished();                           // deleted by the executor, its result stays a failure
+        }
 
-            fclose(mapfile);
+        batch.wait();
+        executor.deactivate();
+    }
+
+    //=================================================================
 
-            // <====
+    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 pThreads)
+        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iFilterMethod(NULL), iCurrentUniqueNameId(0), iThreads(pThreads)
+    {
+        //mkdir(iDestDir);
+        //init();
+    }
 
-            // write map tile files, similar to ADT files, only with extra BSP tree node info
-            TileMap &tileEntries = map_iter->second->TileEntries;
-            TileMap::iterator tile;
-            for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+    TileAssembler::~TileAssembler()
+    {
+        //delete iCoordModelMapping;
+    }
+
+    bool TileAssembler::convertWorld2()
+    {
+        bool success = readMapSpawns();
+        if (!success)
+            return false;
+
+        // export Map data
+        std::vector<std::set<std::string> > mapModelFiles(mapData.size());
+        std::vector<char> results(mapData.size(), 0);
+        std::vector<AssemblerJob*> jobs;
+        uint32 index = 0;
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter, ++index)
+            jobs.push_back(new ConvertMapJob(*this, map_iter->first, map_iter->second, mapModelFiles[index], results[index]));
+
+        runJobs(jobs, iThreads);
+
+        index = 0;
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter, ++index)
+        {
+            if (!results[index])
             {
-                const ModelSpawn &spawn = map_iter->second->UniqueEntries[tile->second];
-                if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
-                    continue;
-                uint32 nSpawns = tileEntries.count(tile->first);
-                std::stringstream tilefilename;
-                tilefilename.fill('0');
-                tilefilename << iDestDir << '/' << std::setw(3) << map_iter->first << '_';
-                uint32 x, y;
-                StaticMapTree::unpackTileID(tile->first, x, y);
-                tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
-                if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
-                {
-                    // file header
-                    if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) success = false;
-                    // write number of tile spawns
-                    if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) success = false;
-                    // write tile spawns
-                    for (uint32 s=0; s<nSpawns; ++s)
-                    {
-                        if (s)
-                            ++tile;
-                        const ModelSpawn &spawn2 = map_iter->second->UniqueEntries[tile->second];
-                        success = success && ModelSpawn::writeToFile(tilefile, spawn2);
-                        // MapTree nodes to update when loading tile:
-                        std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
-                        if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) success = false;
-                    }
-                    fclose(tilefile);
-                }
+                printf("error converting map %u\n", map_iter->first);
+                success = false;
             }
-            // break; //test, extract only first map; TODO: remvoe this line
+            spawnedModelFiles.insert(mapModelFiles[index].begin(), mapModelFiles[index].end());
         }
 
         // add an object models, listed in temp_gameobject_models file
         exportGameobjectModels();
         // export objects
         std::cout << "\nConverting Model Files" << std::endl;
-        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile)
+        results.assign(spawnedModelFiles.size(), 0);
+        jobs.clear();
+        index = 0;
+        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile, ++index)
+            jobs.push_back(new ConvertModelJob(*this, *mfile, results[index]));
+
+        runJobs(jobs, iThreads);
+
+        index = 0;
+        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile, ++index)
         {
-            std::cout << "Converting " << *mfile << std::endl;
-            if (!convertRawFile(*mfile))
+            if (!results[index])
             {
                 std::cout << "error converting " << *mfile << std::endl;
                 success = false;
-                break;
             }
         }
 
@@ -207,6 +247,120 @@ namespace VMAP
         return success;
     }
 
+    bool TileAssembler::convertMap(uint32 pMapId, MapSpawns* pSpawns, std::set<std::string>& pModelFiles)
+    {
+        bool success = true;
+
+        // build global map tree
+        std::vector<ModelSpawn*> mapSpawns;
+        UniqueEntryMap::iterator entry;
+        printf("Calculating model bounds for map %u...\n", pMapId);
+        for (entry = pSpawns->UniqueEntries.begin(); entry != pSpawns->UniqueEntries.end(); ++entry)
+        {
+            // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
+            if (entry->second.flags & MOD_M2)
+            {
+                if (!calculateTransformedBound(entry->second))
+                    break;
+            }
+            else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
+            {
+                /// @todo remove extractor hack and uncomment below line:
+                //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
+                entry->second.iBound = entry->second.iBound + Vector3(533.33333f*32, 533.33333f*32, 0.f);
+            }
+            mapSpawns.push_back(&(entry->second));
+            pModelFiles.insert(entry->second.name);
+        }
+
+        printf("Creating map tree for map %u...\n", pMapId);
+        BIH pTree;
+
+        try
+        {
+            pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::getBounds);
+        }
+        catch (std::exception& e)
+        {
+            printf("Exception ""%s"" when calling pTree.build", e.what());
+            return false;
+        }
+
+        // ===> possibly move this code to StaticMapTree class
+        std::map<uint32, uint32> modelNodeIdx;
+        for (uint32 i=0; i<mapSpawns.size(); ++i)
+            modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
+
+        // write map tree file
+        std::stringstream mapfilename;
+        mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << pMapId << ".vmtree";
+        FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
+        if (!mapfile)
+        {
+            printf("Cannot open %s\n", mapfilename.str().c_str());
+            return false;
+        }
+
+        //general info
+        if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) success = false;
+        uint32 globalTileID = StaticMapTree::packTileID(65, 65);
+        pair<TileMap::iterator, TileMap::iterator> globalRange = pSpawns->TileEntries.equal_range(globalTileID);
+        char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
+        if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) success = false;
+        // Nodes
+        if (success && fwrite("NODE", 4, 1, mapfile) != 1) success = false;
+        if (success) success = pTree.writeToFile(mapfile);
+        // global map spawns (WDT), if any (most instances)
+        if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) success = false;
+
+        for (TileMap::iterator glob=globalRange.first; glob != globalRange.second && success; ++glob)
+        {
+            success = ModelSpawn::writeToFile(mapfile, pSpawns->UniqueEntries[glob->second]);
+        }
+
+        fclose(mapfile);
+
+        // <====
+
+        // write map tile files, similar to ADT files, only with extra BSP tree node info
+        TileMap &tileEntries = pSpawns->TileEntries;
+        TileMap::iterator tile;
+        for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        {
+            const ModelSpawn &spawn = pSpawns->UniqueEntries[tile->second];
+            if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
+                continue;
+            uint32 nSpawns = tileEntries.count(tile->first);
+            std::stringstream tilefilename;
+            tilefilename.fill('0');
+            tilefilename << iDestDir << '/' << std::setw(3) << pMapId << '_';
+            uint32 x, y;
+            StaticMapTree::unpackTileID(tile->first, x, y);
+            tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
+            if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
+            {
+                // file header
+                if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) success = false;
+                // write number of tile spawns
+                if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) success = false;
+                // write tile spawns
+                for (uint32 s=0; s<nSpawns; ++s)
+                {
+                    if (s)
+                        ++tile;
+                    const ModelSpawn &spawn2 = pSpawns->UniqueEntries[tile->second];
+                    success = success && ModelSpawn::writeToFile(tilefile, spawn2);
+                    // MapTree nodes to update when loading tile:
+                    std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
+                    if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) success = false;
+                }
+                fclose(tilefile);
+            }
+        }
+
+        return success;
+    }
+
     bool TileAssembler::readMapSpawns()
     {
         std::string fname = iSrcDir + "/dir_bin";
@@ -100,12 +100,18 @@ namespace VMAP
             unsigned int iCurrentUniqueNameId;
             MapData mapData;
             std::set<std::string> spawnedModelFiles;
+            uint32 iThreads;
 
         public:
-            TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName);
+            TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 pThreads = 1);
             virtual ~TileAssembler();
 
+            /**
+            Maps are converted in parallel, then the model files. Every map and model only
+            writes its own files, so the output does not depend on the number of threads.
+            */
             bool convertWorld2();
+            bool convertMap(uint32 pMapId, MapSpawns* pSpawns, std::set<std::string>& pModelFiles);
             bool readMapSpawns();
             bool calculateTransformedBound(ModelSpawn &spawn);
             void exportGameobjectModels();
@@ -101,10 +101,11 @@ void UnitAI::DoAddAuraToAllHostilePlayers(uint32 spellid)
 {
     if (me->isInCombat())
     {
-        std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
-        for (std::list<HostileReference*>::iterator itr = threatlist.begin(); itr != threatlist.end(); ++itr)
+        // the spells can add or remove references, do not walk the threat list while casting
+        std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+        for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
-            if (Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
+            if (Unit* unit = Unit::GetUnit(*me, *itr))
                 if (unit->GetTypeId() == TYPEID_PLAYER)
                     me->AddAura(spellid, unit);
         }
@@ -117,10 +118,11 @@ void UnitAI::DoCastToAllHostilePlayers(uint32 spellid, bool triggered)
 {
     if (me->isInCombat())
     {
-        std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
-        for (std::list<HostileReference*>::iterator itr = threatlist.begin(); itr != threatlist.end(); ++itr)
+        // the spells can add or remove references, do not walk the threat list while casting
+        std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+        for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
-            if (Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
+            if (Unit* unit = Unit::GetUnit(*me, *itr))
                 if (unit->GetTypeId() == TYPEID_PLAYER)
                     me->CastSpell(unit, spellid, triggered);
         }
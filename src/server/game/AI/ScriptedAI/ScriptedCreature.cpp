@@ -255,11 +255,12 @@ void ScriptedAI::DoResetThreat()
         return;
     }
 
-    std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
+    // changing threat can put the owner of a pet on the list, walk a copy
+    std::vector<uint64> threatlist = me->getThreatManager().getThreatListGuids();
 
-    for (std::list<HostileReference*>::iterator itr = threatlist.begin(); itr != threatlist.end(); ++itr)
+    for (std::vector<uint64>::const_iterator itr = threatlist.begin(); itr != threatlist.end(); ++itr)
     {
-        Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid());
+        Unit* unit = Unit::GetUnit(*me, *itr);
 
         if (unit && DoGetThreat(unit))
             DoModifyThreatPercent(unit, -100);
@@ -514,9 +515,10 @@ void BossAI::TeleportCheaters()
 {
     float x, y, z;
     me->GetPosition(x, y, z);
-    std::list<HostileReference*>& threatList = me->getThreatManager().getThreatList();
-    for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
-        if (Unit* target = (*itr)->getTarget())
+    // teleporting can drop references, walk a copy
+    std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+    for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
+        if (Unit* target = Unit::GetUnit(*me, *itr))
             if (target->GetTypeId() == TYPEID_PLAYER && !CheckBoundary(target))
                 target->NearTeleportTo(x, y, z, 0);
 }
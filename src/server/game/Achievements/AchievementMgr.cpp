@@ -392,7 +392,7 @@ bool AchievementCriteriaDataSet::Meets(Player const* source, Unit const* target,
 }
 
 template<class T>
-AchievementMgr<T>::AchievementMgr(T* owner): _owner(owner), _achievementPoints(0)
+AchievementMgr<T>::AchievementMgr(T* owner): _owner(owner), _achievementPoints(0), m_unsavedChanges(false)
 {
 }
 
@@ -435,6 +435,7 @@ void AchievementMgr<T>::RemoveCriteriaProgress(const AchievementCriteriaEntry* e
     SendPacket(&data);
 
     progressMap->erase(criteriaProgress);
+    MarkCriteriaCompleted(entry, NULL, false);
 }
 
 template<>
@@ -464,6 +465,7 @@ void AchievementMgr<Guild>::RemoveCriteriaProgress(const AchievementCriteriaEntr
     SendPacket(&data);
 
     GetCriteriaProgressMap()->erase(criteriaProgress);
+    MarkCriteriaCompleted(entry, NULL, false);
 }
 
 template<class T>
@@ -544,6 +546,8 @@ void AchievementMgr<T>::SaveToDB(SQLTransaction& /*trans*/)
 template<>
 void AchievementMgr<Player>::SaveToDB(SQLTransaction& trans)
 {
+    m_unsavedChanges = false;
+
     if (!m_completedAchievements.empty())
     {
         bool need_execute = false;
@@ -788,9 +792,11 @@ void AchievementMgr<Player>::SaveToDB(SQLTransaction& trans)
 template<>
 void AchievementMgr<Guild>::SaveToDB(SQLTransaction& trans)
 {
+    m_unsavedChanges = false;
+
     PreparedStatement* stmt;
     std::ostringstream guidstr;
-    for (CompletedAchievementMap::const_iterator itr = m_completedAchievements.begin(); itr != m_completedAchievements.end(); ++itr)
+    for (CompletedAchievementMap::iterator itr = m_completedAchievements.begin(); itr != m_completedAchievements.end(); ++itr)
     {
         if (!itr->second.changed)
             continue;
@@ -811,6 +817,7 @@ void AchievementMgr<Guild>::SaveToDB(SQLTransaction& trans)
         trans->Append(stmt);
 
         guidstr.str("");
+        itr->second.changed = false;
     }
 
     CriteriaProgressMap* progressMap = GetCriteriaProgressMap();
@@ -818,7 +825,7 @@ void AchievementMgr<Guild>::SaveToDB(SQLTransaction& trans)
     if (!progressMap)
         return;
 
-    for (CriteriaProgressMap::const_iterator itr = progressMap->begin(); itr != progressMap->end(); ++itr)
+    for (CriteriaProgressMap::iterator itr = progressMap->begin(); itr != progressMap->end(); ++itr)
     {
         if (!itr->second.changed)
             continue;
@@ -835,6 +842,8 @@ void AchievementMgr<Guild>::SaveToDB(SQLTransaction& trans)
         stmt->setUInt32(3, itr->second.date);
         stmt->setUInt32(4, GUID_LOPART(itr->second.CompletedGUID));
         trans->Append(stmt);
+
+        itr->second.changed = false;
     }
 }
 
@@ -995,6 +1004,8 @@ void AchievementMgr<Player>::LoadFromDB(PreparedQueryResult achievementResult, P
         }
         while (criteriaAccountResult->NextRow());
     }
+
+    RebuildCompletedCriteria();
 }
 
 template<>
@@ -1071,6 +1082,8 @@ void AchievementMgr<Guild>::LoadFromDB(PreparedQueryResult achievementResult, Pr
         }
         while (criteriaResult->NextRow());
     }
+
+    RebuildCompletedCriteria();
 }
 
 template<class T>
@@ -1103,6 +1116,7 @@ void AchievementMgr<Player>::Reset()
     m_completedAchievements.clear();
     _achievementPoints = 0;
     criteriaProgress->clear();
+    m_completedCriteria.clear();
     DeleteFromDB(GetOwner()->GetGUIDLow());
 
     // Re-fill data
@@ -1400,10 +1414,16 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes type,
     if (IsGuild<T>() && !sWorld->getBoolConfig(CONFIG_GUILD_LEVELING_ENABLED))
         return;
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, IsGuild<T>());
+    // only the criteria whose main requirement matches miscValue1, RequirementsSatisfied would reject all others
+    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByAsset(type, miscValue1, IsGuild<T>());
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+
+        // CanUpdateCriteria would refuse it anyway, skip the progress lookup
+        if (IsCriteriaMarkedCompleted(achievementCriteria->ID))
+            continue;
+
         AchievementEntry const* achievement = sAchievementMgr->GetAchievement(achievementCriteria->achievement);
         if (!achievement)
             continue;
@@ -2113,10 +2133,12 @@ void AchievementMgr<T>::SetCriteriaProgress(AchievementCriteriaEntry const* entr
 
     progress->changed = true;
     progress->date = time(NULL); // Set the date to the latest update.
+    m_unsavedChanges = true;
 
    AchievementEntry const* achievement = sAchievementMgr->GetAchievement(entry->achievement);
     uint32 timeElapsed = 0;
     bool criteriaComplete = IsCompletedCriteria(entry, achievement);
+    MarkCriteriaCompleted(entry, achievement, criteriaComplete);
 
     if (entry->timeLimit)
     {
@@ -2134,6 +2156,39 @@ void AchievementMgr<T>::SetCriteriaProgress(AchievementCriteriaEntry const* entr
     SendCriteriaUpdate(entry, progress, timeElapsed, criteriaComplete);
 }
 
+template<class T>
+void AchievementMgr<T>::MarkCriteriaCompleted(AchievementCriteriaEntry const* entry, AchievementEntry const* achievement, bool completed)
+{
+    // realm first criteria stop being completed once someone else gets the achievement
+    if (completed && achievement && (achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+        completed = false;
+
+    if (entry->ID >= m_completedCriteria.size())
+    {
+        if (!completed)
+            return;
+
+        m_completedCriteria.resize(std::max<uint32>(sAchievementCriteriaStore.GetNumRows(), entry->ID + 1), false);
+    }
+
+    m_completedCriteria[entry->ID] = completed;
+}
+
+template<class T>
+void AchievementMgr<T>::RebuildCompletedCriteria()
+{
+    m_completedCriteria.clear();
+
+    CriteriaProgressMap* progressMap = GetCriteriaProgressMap();
+    if (!progressMap)
+        return;
+
+    for (CriteriaProgressMap::const_iterator itr = progressMap->begin(); itr != progressMap->end(); ++itr)
+        if (AchievementCriteriaEntry const* criteria = sAchievementMgr->GetAchievementCriteria(itr->first))
+            if (AchievementEntry const* achievement = sAchievementMgr->GetAchievement(criteria->achievement))
+                MarkCriteriaCompleted(criteria, achievement, IsCompletedCriteria(criteria, achievement));
+}
+
 template<class T>
 void AchievementMgr<T>::UpdateTimedAchievements(uint32 timeDiff)
 {
@@ -2237,6 +2292,7 @@ void AchievementMgr<T>::CompletedAchievement(AchievementEntry const* achievement
     ca.date = time(NULL);
     ca.first_guid = GetOwner()->GetGUIDLow();
     ca.changed = true;
+    m_unsavedChanges = true;
 
     // Don't insert for ACHIEVEMENT_FLAG_REALM_FIRST_KILL since otherwise only the first group member would reach that achievement
     // @TODO: where do set this instead?
@@ -2314,6 +2370,7 @@ void AchievementMgr<Guild>::CompletedAchievement(AchievementEntry const* achieve
     CompletedAchievementData& ca = m_completedAchievements[achievement->ID];
     ca.date = time(NULL);
     ca.changed = true;
+    m_unsavedChanges = true;
 
     if (achievement->flags & ACHIEVEMENT_FLAG_SHOW_GUILD_MEMBERS)
     {
@@ -3985,11 +4042,18 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriaListByAchievement[criteria->achievement].push_back(criteria);
 
-        if (achievement && achievement->flags & ACHIEVEMENT_FLAG_GUILD)
+        bool guild = achievement && achievement->flags & ACHIEVEMENT_FLAG_GUILD;
+        if (guild)
             ++guildCriterias, m_GuildAchievementCriteriasByType[criteria->type].push_back(criteria);
         else
             ++criterias, m_AchievementCriteriasByType[criteria->type].push_back(criteria);
 
+        if (criteria->type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL && IsAssetIndexedCriteriaType(AchievementCriteriaTypes(criteria->type)))
+        {
+            AchievementCriteriaListByAsset& byAsset = guild ? m_GuildAchievementCriteriasByAsset[criteria->type] : m_AchievementCriteriasByAsset[criteria->type];
+            byAsset[criteria->raw.field3].push_back(criteria);
+        }
+
         if (criteria->timeLimit)
             m_AchievementCriteriasByTimedType[criteria->timedCriteriaStartType].push_back(criteria);
     }
@@ -3997,6 +4061,47 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u achievement criteria and %u guild achievement crieteria in %u ms", criterias, guildCriterias, GetMSTimeDiffToNow(oldMSTime));
 }
 
+// Types whose RequirementsSatisfied() rejects every criteria with raw.field3 != miscValue1 when miscValue1 is set
+bool AchievementGlobalMgr::IsAssetIndexedCriteriaType(AchievementCriteriaTypes type)
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_GUILD_CHALLENGE_TYPE:
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
 void AchievementGlobalMgr::LoadAchievementReferenceList()
 {
     uint32 oldMSTime = getMSTime();
@@ -18,8 +18,10 @@
 #ifndef __TRINITY_ACHIEVEMENTMGR_H
 #define __TRINITY_ACHIEVEMENTMGR_H
 
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Common.h"
 #include <ace/Singleton.h>
@@ -34,6 +36,8 @@ typedef std::list<AchievementEntry const*>         AchievementEntryList;
 typedef ACE_Based::LockedMap<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
 typedef ACE_Based::LockedMap<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
+typedef UNORDERED_MAP<uint32, AchievementCriteriaEntryList>         AchievementCriteriaListByAsset;
+
 struct CriteriaProgress
 {
     uint32 counter;
@@ -248,6 +252,7 @@ class AchievementMgr
         void StartTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry, uint32 timeLost = 0);
         void RemoveTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry);   // used for quest and scripted timed achievements
         uint32 GetAchievementPoints() const { return _achievementPoints; }
+        bool HasUnsavedChanges() const { return m_unsavedChanges; }   // progress or completions not written by SaveToDB yet
 
     private:
         enum ProgressType { PROGRESS_SET, PROGRESS_ACCUMULATE, PROGRESS_HIGHEST };
@@ -262,6 +267,12 @@ class AchievementMgr
         bool CanCompleteCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
         bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
         bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, Unit const* unit, Player* referencePlayer);
+        bool IsCriteriaMarkedCompleted(uint32 criteriaId) const
+        {
+            return criteriaId < m_completedCriteria.size() && m_completedCriteria[criteriaId];
+        }
+        void MarkCriteriaCompleted(AchievementCriteriaEntry const* entry, AchievementEntry const* achievement, bool completed);
+        void RebuildCompletedCriteria();
         void SendPacket(WorldPacket* data) const;
 
         bool ConditionsSatisfied(AchievementCriteriaEntry const *criteria, Player* referencePlayer) const;
@@ -273,7 +284,9 @@ class AchievementMgr
         CompletedAchievementMap m_completedAchievements;
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
+        std::vector<bool> m_completedCriteria;        // by criteria id, set while IsCompletedCriteria() holds for a criteria not depending on other players
         uint32 _achievementPoints;
+        bool m_unsavedChanges;
 };
 
 class AchievementGlobalMgr
@@ -291,6 +304,23 @@ class AchievementGlobalMgr
             return guild ? m_GuildAchievementCriteriasByType[type] : m_AchievementCriteriasByType[type];
         }
 
+        // criteria of that type an update with miscValue1 = asset can advance, all of the type if they are not indexed by asset
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByAsset(AchievementCriteriaTypes type, uint64 asset, bool guild = false) const
+        {
+            if (!asset || !IsAssetIndexedCriteriaType(type))
+                return GetAchievementCriteriaByType(type, guild);
+
+            // the asset is a 32 bit dbc field, nothing can match a larger value
+            if (asset > std::numeric_limits<uint32>::max())
+                return m_emptyCriteriaList;
+
+            AchievementCriteriaListByAsset const& byAsset = guild ? m_GuildAchievementCriteriasByAsset[type] : m_AchievementCriteriasByAsset[type];
+            AchievementCriteriaListByAsset::const_iterator itr = byAsset.find(uint32(asset));
+            return itr != byAsset.end() ? itr->second : m_emptyCriteriaList;
+        }
+
+        static bool IsAssetIndexedCriteriaType(AchievementCriteriaTypes type);
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -370,6 +400,11 @@ class AchievementGlobalMgr
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         AchievementCriteriaEntryList m_GuildAchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
 
+        // same criterias by type and main requirement (creature, spell, item...) for the types that must match it
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaListByAsset m_GuildAchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaEntryList m_emptyCriteriaList;
+
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
         // store achievement criterias by achievement to speed up lookup
@@ -31,6 +31,7 @@
 #include "Language.h"
 #include "Log.h"
 #include <vector>
+#include <algorithm>
 
 enum eAuctionHouse
 {
@@ -370,6 +371,42 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id)
     return true;
 }
 
+std::wstring const& AuctionHouseMgr::GetLowerItemName(ItemTemplate const* proto, int loc_idx)
+{
+    uint64 key = (uint64(proto->ItemId) << 8) | uint8(loc_idx + 1);
+    LowerNameMap::iterator itr = mLowerItemNames.find(key);
+    if (itr != mLowerItemNames.end())
+        return itr->second;
+
+    std::wstring& wname = mLowerItemNames[key];
+    std::string name = proto->Name1;
+    if (name.empty())
+        return wname;
+
+    // local name
+    if (loc_idx >= 0)
+        if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+            ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
+
+    if (Utf8toWStr(name, wname))
+        wstrToLower(wname);
+
+    return wname;
+}
+
+std::wstring const& AuctionHouseMgr::GetLowerRandomPropertySuffix(ItemRandomPropertiesEntry const* entry)
+{
+    LowerNameMap::iterator itr = mLowerSuffixNames.find(entry->ID);
+    if (itr != mLowerSuffixNames.end())
+        return itr->second;
+
+    std::wstring& wsuffix = mLowerSuffixNames[entry->ID];
+    if (entry->nameSuffix && Utf8toWStr(entry->nameSuffix, wsuffix))
+        wstrToLower(wsuffix);
+
+    return wsuffix;
+}
+
 void AuctionHouseMgr::Update()
 {
     mHordeAuctions.Update();
@@ -417,18 +454,86 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(uint32 factionTem
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
+namespace
+{
+    template<class Index>
+    void EraseFromIndex(Index& index, typename Index::key_type const& key, uint32 auctionId)
+    {
+        typename Index::iterator itr = index.find(key);
+        if (itr == index.end())
+            return;
+
+        itr->second.erase(auctionId);
+        if (itr->second.empty())
+            index.erase(itr);
+    }
+
+    // sets of an index that hold the auctions of one search filter
+    struct AuctionSearchSource
+    {
+        explicit AuctionSearchSource(AuctionHouseObject::AuctionSearchSourceType _type) : type(_type), size(0) {}
+
+        void Add(AuctionHouseObject::AuctionIdSet const& ids)
+        {
+            sets.push_back(&ids);
+            size += ids.size();
+        }
+
+        void Add(AuctionHouseObject::AuctionFilterIndex const& index, uint32 key)
+        {
+            AuctionHouseObject::AuctionFilterIndex::const_iterator itr = index.find(key);
+            if (itr != index.end())
+                Add(itr->second);
+        }
+
+        AuctionHouseObject::AuctionSearchSourceType type;
+        std::vector<AuctionHouseObject::AuctionIdSet const*> sets;
+        uint32 size;
+    };
+}
+
 void AuctionHouseObject::AddAuction(AuctionEntry* auction)
 {
     ASSERT(auction);
 
-    AuctionsMap[auction->Id] = auction;
+    Item* item = sAuctionMgr->GetAItem(auction->itemGUIDLow);
+    IndexAuction(auction, item ? item->GetItemRandomPropertyId() : 0);
+
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
+void AuctionHouseObject::IndexAuction(AuctionEntry* auction, int32 randomPropertyId)
+{
+    AuctionsMap[auction->Id] = auction;
+    if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->itemEntry))
+    {
+        AuctionIndex[auction->Id] = AuctionIndexEntry(auction, proto, randomPropertyId);
+        AuctionsByClass[proto->Class].insert(auction->Id);
+        AuctionsBySubClass[proto->Class << 16 | proto->SubClass].insert(auction->Id);
+        AuctionsByInventoryType[proto->InventoryType].insert(auction->Id);
+        AuctionsByQuality[proto->Quality].insert(auction->Id);
+        AuctionsByLevel[proto->RequiredLevel].insert(auction->Id);
+        AuctionsByName[std::make_pair(proto->ItemId, randomPropertyId)].insert(auction->Id);
+    }
+}
+
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry*/)
 {
     bool wasInMap = AuctionsMap.erase(auction->Id) ? true : false;
 
+    AuctionIndexMap::iterator itr = AuctionIndex.find(auction->Id);
+    if (itr != AuctionIndex.end())
+    {
+        ItemTemplate const* proto = itr->second.proto;
+        EraseFromIndex(AuctionsByClass, proto->Class, auction->Id);
+        EraseFromIndex(AuctionsBySubClass, proto->Class << 16 | proto->SubClass, auction->Id);
+        EraseFromIndex(AuctionsByInventoryType, proto->InventoryType, auction->Id);
+        EraseFromIndex(AuctionsByQuality, proto->Quality, auction->Id);
+        EraseFromIndex(AuctionsByLevel, proto->RequiredLevel, auction->Id);
+        EraseFromIndex(AuctionsByName, std::make_pair(proto->ItemId, itr->second.randomPropertyId), auction->Id);
+        AuctionIndex.erase(itr);
+    }
+
     sScriptMgr->OnAuctionRemove(this, auction);
 
     // we need to delete the entry, it is not referenced any more
@@ -439,6 +544,17 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction, uint32 /*itemEntry
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld->GetGameTime();
+
+    ///- Drop search results nobody paged through in time
+    uint32 now = getMSTime();
+    for (AuctionSearchCacheMap::iterator itr = SearchCache.begin(); itr != SearchCache.end();)
+    {
+        if (getMSTimeDiff(itr->second.createTime, now) >= AUCTION_SEARCH_CACHE_TIME)
+            SearchCache.erase(itr++);
+        else
+            ++itr;
+    }
+
     ///- Handle expired auctions
 
     // If storage is empty, no need to update. next == NULL in this case.
@@ -521,93 +637,206 @@ void AuctionHouseObject::BuildListOwnerItems(WorldPacket& data, Player* player,
     }
 }
 
-void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
-    std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
-    uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
-    uint32& count, uint32& totalcount)
+/**
+ * Checks the filters a search candidate was not selected by, the filter of its source is skipped.
+ * The item itself is not needed, usable items are checked by the caller.
+ */
+bool AuctionHouseObject::MatchesFilters(AuctionIndexEntry const& entry, AuctionSearchSourceType source, std::wstring const& wsearchedname, int loc_idx,
+    uint8 levelmin, uint8 levelmax, uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality)
 {
-    int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-    int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
+    ItemTemplate const* proto = entry.proto;
 
-    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
+    if (source != AUCTION_SEARCH_SOURCE_CLASS)
     {
-        AuctionEntry* Aentry = itr->second;
-        Item* item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
-        if (!item)
-            continue;
-
-        ItemTemplate const* proto = item->GetTemplate();
-
         if (itemClass != 0xffffffff && proto->Class != itemClass)
-            continue;
+            return false;
 
         if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            continue;
+            return false;
+    }
 
-        if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            continue;
+    if (source != AUCTION_SEARCH_SOURCE_INVENTORY_TYPE && inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
+        return false;
 
-        if (quality != 0xffffffff && proto->Quality != quality)
-            continue;
+    if (source != AUCTION_SEARCH_SOURCE_QUALITY && quality != 0xffffffff && proto->Quality != quality)
+        return false;
 
-        if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            continue;
+    if (source != AUCTION_SEARCH_SOURCE_LEVEL && levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
+        return false;
 
-        if (usable != 0x00 && player->CanUseItem(item) != EQUIP_ERR_OK)
-            continue;
+    // No need to do any of this if no search term was entered, or if the name index found the candidate
+    if (source != AUCTION_SEARCH_SOURCE_NAME && !wsearchedname.empty() && !MatchesName(proto, entry.randomPropertyId, wsearchedname, loc_idx))
+        return false;
 
-        // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-        // No need to do any of this if no search term was entered
-        if (!wsearchedname.empty())
-        {
-            std::string name = proto->Name1;
-            if (name.empty())
-                continue;
+    return true;
+}
 
-            // local name
-            if (loc_idx >= 0)
-                if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
-                    ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
+bool AuctionHouseObject::MatchesName(ItemTemplate const* proto, int32 randomPropertyId, std::wstring const& wsearchedname, int loc_idx)
+{
+    // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+    std::wstring const& name = sAuctionMgr->GetLowerItemName(proto, loc_idx);
+    if (name.empty())
+        return false;
 
-            // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-            //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-            //  used in BuildAuctionInfo() which then causes wrong items to be listed
-            int32 propRefID = item->GetItemRandomPropertyId();
+    if (name.find(wsearchedname) != std::wstring::npos)
+        return true;
 
-            if (propRefID)
-            {
-                // Append the suffix to the name (ie: of the Monkey) if one exists
-                // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
-                //  even though the DBC names seem misleading
-                const ItemRandomPropertiesEntry* itemRandProp = sItemRandomPropertiesStore.LookupEntry(propRefID);
-
-                if (itemRandProp)
-                {
-                    char* temp = itemRandProp->nameSuffix;
-                    //char* temp = itemRandProp->nameSuffix;
-
-                    // dbc local name
-                    if (temp)
-                    {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += temp[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-                    }
-                }
-            }
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    if (randomPropertyId <= 0)
+        return false;
 
-            // Perform the search (with or without suffix)
-            if (!Utf8FitTo(name, wsearchedname))
-                continue;
-        }
+    // Append the suffix to the name (ie: of the Monkey) if one exists
+    // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
+    //  even though the DBC names seem misleading
+    ItemRandomPropertiesEntry const* itemRandProp = sItemRandomPropertiesStore.LookupEntry(randomPropertyId);
+    if (!itemRandProp)
+        return false;
 
-        // Add the item if no search term or if entered search term was found
-        if (count < 50 && totalcount >= listfrom)
+    std::wstring const& suffix = sAuctionMgr->GetLowerRandomPropertySuffix(itemRandProp);
+    if (suffix.empty())
+        return false;
+
+    // Perform the search on the full name, the term may span name and suffix
+    std::wstring fullName = name;
+    fullName += L' ';
+    fullName += suffix;
+    return fullName.find(wsearchedname) != std::wstring::npos;
+}
+
+/**
+ * Collects the auctions of the most selective search filter, in auction id order, and returns that filter.
+ * Every candidate still has to pass MatchesFilters, the other filters are not applied here.
+ */
+AuctionHouseObject::AuctionSearchSourceType AuctionHouseObject::FindSearchCandidates(std::vector<uint32>& candidates, std::wstring const& wsearchedname, int loc_idx,
+    uint8 levelmin, uint8 levelmax, uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality) const
+{
+    std::vector<AuctionSearchSource> sources;
+
+    // a name is usually the most selective filter, and it is matched once per item and suffix instead of once per auction
+    if (!wsearchedname.empty())
+    {
+        sources.push_back(AuctionSearchSource(AUCTION_SEARCH_SOURCE_NAME));
+        for (AuctionNameIndex::const_iterator itr = AuctionsByName.begin(); itr != AuctionsByName.end(); ++itr)
         {
-            ++count;
-            Aentry->BuildAuctionInfo(data);
+            AuctionIndexMap::const_iterator itrEntry = AuctionIndex.find(*itr->second.begin());
+            if (MatchesName(itrEntry->second.proto, itr->first.second, wsearchedname, loc_idx))
+                sources.back().Add(itr->second);
         }
+    }
+
+    if (itemClass != 0xffffffff)
+    {
+        sources.push_back(AuctionSearchSource(AUCTION_SEARCH_SOURCE_CLASS));
+        if (itemSubClass != 0xffffffff)
+            sources.back().Add(AuctionsBySubClass, itemClass << 16 | itemSubClass);
+        else
+            sources.back().Add(AuctionsByClass, itemClass);
+    }
+
+    if (inventoryType != 0xffffffff)
+    {
+        sources.push_back(AuctionSearchSource(AUCTION_SEARCH_SOURCE_INVENTORY_TYPE));
+        sources.back().Add(AuctionsByInventoryType, inventoryType);
+    }
+
+    if (quality != 0xffffffff)
+    {
+        sources.push_back(AuctionSearchSource(AUCTION_SEARCH_SOURCE_QUALITY));
+        sources.back().Add(AuctionsByQuality, quality);
+    }
+
+    if (levelmin != 0x00)
+    {
+        sources.push_back(AuctionSearchSource(AUCTION_SEARCH_SOURCE_LEVEL));
+        AuctionFilterIndex::const_iterator end = levelmax != 0x00 ? AuctionsByLevel.upper_bound(levelmax) : AuctionsByLevel.end();
+        for (AuctionFilterIndex::const_iterator itr = AuctionsByLevel.lower_bound(levelmin); itr != end; ++itr)
+            sources.back().Add(itr->second);
+    }
+
+    // no filter at all, every auction is a candidate
+    if (sources.empty())
+    {
+        candidates.reserve(AuctionIndex.size());
+        for (AuctionIndexMap::const_iterator itr = AuctionIndex.begin(); itr != AuctionIndex.end(); ++itr)
+            candidates.push_back(itr->first);
+        return AUCTION_SEARCH_SOURCE_ALL;
+    }
+
+    AuctionSearchSource const* best = &sources.front();
+    for (std::vector<AuctionSearchSource>::const_iterator itr = sources.begin(); itr != sources.end(); ++itr)
+        if (itr->size < best->size)
+            best = &*itr;
+
+    candidates.reserve(best->size);
+    for (std::vector<AuctionIdSet const*>::const_iterator itr = best->sets.begin(); itr != best->sets.end(); ++itr)
+        candidates.insert(candidates.end(), (*itr)->begin(), (*itr)->end());
+
+    if (best->sets.size() > 1)
+        std::sort(candidates.begin(), candidates.end());
+
+    return best->type;
+}
+
+void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
+    std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
+    uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
+    uint32& count, uint32& totalcount)
+{
+    int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
+
+    AuctionSearchCache& search = SearchCache[player->GetGUIDLow()];
+
+    // Next page of the previous search, the matching auctions are already known
+    if (listfrom && search.createTime && getMSTimeDiff(search.createTime, getMSTime()) < AUCTION_SEARCH_CACHE_TIME &&
+        search.locale == loc_idx && search.levelMin == levelmin && search.levelMax == levelmax && search.usable == usable &&
+        search.inventoryType == inventoryType && search.itemClass == itemClass && search.itemSubClass == itemSubClass &&
+        search.quality == quality && search.searchedName == wsearchedname)
+    {
+        totalcount = search.results.size();
+        for (uint32 i = listfrom; i < search.results.size() && count < AUCTION_SEARCH_PAGE_SIZE; ++i)
+            if (AuctionEntry* Aentry = GetAuction(search.results[i]))  // may have been sold or expired meanwhile
+                if (Aentry->BuildAuctionInfo(data))
+                    ++count;
+        return;
+    }
+
+    search.searchedName = wsearchedname;
+    search.locale = loc_idx;
+    search.levelMin = levelmin;
+    search.levelMax = levelmax;
+    search.usable = usable;
+    search.inventoryType = inventoryType;
+    search.itemClass = itemClass;
+    search.itemSubClass = itemSubClass;
+    search.quality = quality;
+    search.createTime = getMSTime();
+    search.results.clear();
+
+    std::vector<uint32> candidates;
+    AuctionSearchSourceType source = FindSearchCandidates(candidates, wsearchedname, loc_idx, levelmin, levelmax, inventoryType, itemClass, itemSubClass, quality);
+
+    for (std::vector<uint32>::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+    {
+        AuctionIndexEntry const& entry = AuctionIndex.find(*itr)->second;
+        if (!MatchesFilters(entry, source, wsearchedname, loc_idx, levelmin, levelmax, inventoryType, itemClass, itemSubClass, quality))
+            continue;
+
+        Item* item = sAuctionMgr->GetAItem(entry.auction->itemGUIDLow);
+        if (!item)
+            continue;
+
+        if (usable != 0x00 && player->CanUseItem(item) != EQUIP_ERR_OK)
+            continue;
+
+        search.results.push_back(*itr);
+
+        // Add the item if no search term or if entered search term was found
+        if (count < AUCTION_SEARCH_PAGE_SIZE && totalcount >= listfrom)
+            if (entry.auction->BuildAuctionInfo(data))
+                ++count;
+
         ++totalcount;
     }
 }
@@ -28,9 +28,12 @@
 class Item;
 class Player;
 class WorldPacket;
+struct ItemTemplate;
 
 #define MIN_AUCTION_TIME (12*HOUR)
 #define MAX_AUCTION_ITEMS 160
+#define AUCTION_SEARCH_PAGE_SIZE 50
+#define AUCTION_SEARCH_CACHE_TIME (30*IN_MILLISECONDS)      // how long the result of a search is kept for the next pages
 
 enum AuctionError
 {
@@ -109,6 +112,51 @@ class AuctionHouseObject
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
 
+    struct AuctionIndexEntry
+    {
+        AuctionIndexEntry(AuctionEntry* _auction = NULL, ItemTemplate const* _proto = NULL, int32 _randomPropertyId = 0) :
+            auction(_auction), proto(_proto), randomPropertyId(_randomPropertyId) {}
+        AuctionEntry* auction;
+        ItemTemplate const* proto;
+        int32 randomPropertyId;                             // of the auctioned item, part of the searchable name
+    };
+    typedef std::map<uint32 /*auctionId*/, AuctionIndexEntry> AuctionIndexMap;
+
+    // auction ids by the value of one search filter, a search walks the smallest set its filters select
+    typedef std::set<uint32 /*auctionId*/> AuctionIdSet;
+    typedef std::map<uint32, AuctionIdSet> AuctionFilterIndex;
+    typedef std::map<std::pair<uint32 /*itemEntry*/, int32 /*randomPropertyId*/>, AuctionIdSet> AuctionNameIndex;
+
+    // the search filter whose index supplied the candidates, every candidate already passes it
+    enum AuctionSearchSourceType
+    {
+        AUCTION_SEARCH_SOURCE_ALL,                          // no filter, every auction
+        AUCTION_SEARCH_SOURCE_NAME,
+        AUCTION_SEARCH_SOURCE_CLASS,                        // class, or class and subclass
+        AUCTION_SEARCH_SOURCE_INVENTORY_TYPE,
+        AUCTION_SEARCH_SOURCE_QUALITY,
+        AUCTION_SEARCH_SOURCE_LEVEL
+    };
+
+    // last browse search of a player, next page requests with the same filters are served from it
+    struct AuctionSearchCache
+    {
+        AuctionSearchCache() : locale(0), levelMin(0), levelMax(0), usable(0), inventoryType(0), itemClass(0), itemSubClass(0), quality(0), createTime(0) {}
+
+        std::wstring searchedName;
+        int locale;
+        uint8 levelMin;
+        uint8 levelMax;
+        uint8 usable;
+        uint32 inventoryType;
+        uint32 itemClass;
+        uint32 itemSubClass;
+        uint32 quality;
+        uint32 createTime;                                  // getMSTime() of the search
+        std::vector<uint32> results;                        // matching auction ids, in listing order
+    };
+    typedef UNORDERED_MAP<uint32 /*playerLowGuid*/, AuctionSearchCache> AuctionSearchCacheMap;
+
     uint32 Getcount() const { return AuctionsMap.size(); }
 
     AuctionEntryMap::iterator GetAuctionsBegin() {return AuctionsMap.begin();}
@@ -134,7 +182,24 @@ class AuctionHouseObject
         uint32& count, uint32& totalcount);
 
   private:
+    friend class AuctionHouseBench;                         // .bench auction, searches a standalone house without items
+
+    void IndexAuction(AuctionEntry* auction, int32 randomPropertyId);
+    static bool MatchesFilters(AuctionIndexEntry const& entry, AuctionSearchSourceType source, std::wstring const& wsearchedname, int loc_idx,
+        uint8 levelmin, uint8 levelmax, uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality);
+    static bool MatchesName(ItemTemplate const* proto, int32 randomPropertyId, std::wstring const& wsearchedname, int loc_idx);
+    AuctionSearchSourceType FindSearchCandidates(std::vector<uint32>& candidates, std::wstring const& wsearchedname, int loc_idx, uint8 levelmin, uint8 levelmax,
+        uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality) const;
+
     AuctionEntryMap AuctionsMap;
+    AuctionIndexMap AuctionIndex;
+    AuctionFilterIndex AuctionsByClass;
+    AuctionFilterIndex AuctionsBySubClass;                  // keyed by class << 16 | subclass, subclasses are per class
+    AuctionFilterIndex AuctionsByInventoryType;
+    AuctionFilterIndex AuctionsByQuality;
+    AuctionFilterIndex AuctionsByLevel;                     // keyed by required level
+    AuctionNameIndex AuctionsByName;                        // names are matched once per item and suffix, in the searcher's locale
+    AuctionSearchCacheMap SearchCache;
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
@@ -187,6 +252,9 @@ class AuctionHouseMgr
         void AddAItem(Item* it);
         bool RemoveAItem(uint32 id);
 
+        std::wstring const& GetLowerItemName(ItemTemplate const* proto, int loc_idx);
+        std::wstring const& GetLowerRandomPropertySuffix(ItemRandomPropertiesEntry const* entry);
+
         void Update();
 
     private:
@@ -196,6 +264,11 @@ class AuctionHouseMgr
         AuctionHouseObject mNeutralAuctions;
 
         ItemMap mAitems;
+
+        // lowercased names used by the browse search, filled on first use
+        typedef UNORDERED_MAP<uint64, std::wstring> LowerNameMap;
+        LowerNameMap mLowerItemNames;
+        LowerNameMap mLowerSuffixNames;
 };
 
 #define sAuctionMgr ACE_Singleton<AuctionHouseMgr, ACE_Null_Mutex>::instance()
@@ -321,6 +321,60 @@ void Battleground::Update(uint32 diff)
     PostUpdateImpl(diff);
 }
 
+/**
+ * Battlegrounds with a map are updated by BattlegroundMap::Update on the map's thread, and players
+ * leave them from whatever thread updates the player. Whatever that reaches beyond the battleground's
+ * own map (raid groups, guilds, the battleground queues, every session) is queued here instead and
+ * run by ProcessWorldTasks from BattlegroundMgr::Update, on the world thread once all maps are updated.
+ */
+void Battleground::QueueWorldTask(BattlegroundWorldTask const& task)
+{
+    m_WorldTasks.push_back(task);
+}
+
+void Battleground::ProcessWorldTasks()
+{
+    if (m_WorldTasks.empty())
+        return;
+
+    // tasks queued while these run wait for the next update
+    std::vector<BattlegroundWorldTask> tasks;
+    tasks.swap(m_WorldTasks);
+
+    for (std::vector<BattlegroundWorldTask>::const_iterator itr = tasks.begin(); itr != tasks.end(); ++itr)
+    {
+        switch (itr->Type)
+        {
+            case BG_WORLD_TASK_REMOVE_RAID_MEMBER:
+                if (Group* group = GetBgRaid(itr->Team))
+                    if (!group->RemoveMember(itr->Guid))    // group was disbanded
+                        SetBgRaid(itr->Team, NULL);
+                break;
+            case BG_WORLD_TASK_FREE_SLOT:
+                // the battleground may have ended since the player left
+                if (GetStatus() < STATUS_WAIT_LEAVE)
+                {
+                    AddToBGFreeSlotQueue();
+                    sBattlegroundMgr->ScheduleQueueUpdate(0, 0, BattlegroundMgr::BGQueueTypeId(GetTypeID(), GetArenaType()), GetTypeID(), GetBracketId());
+                }
+                break;
+            case BG_WORLD_TASK_GUILD_CRITERIA:
+                if (Guild* guild = sGuildMgr->GetGuildById(itr->GuildId))
+                {
+                    Player* player = ObjectAccessor::FindPlayer(itr->Guid);
+                    if (itr->CriteriaType == ACHIEVEMENT_CRITERIA_TYPE_WIN_BG)
+                        guild->GetAchievementMgr().UpdateAchievementCriteria(itr->CriteriaType, itr->MiscValue1, 0, 0, player);
+                    else
+                        guild->GetAchievementMgr().UpdateAchievementCriteria(itr->CriteriaType, itr->MiscValue1, 0, 0, NULL, player);
+                }
+                break;
+            case BG_WORLD_TASK_ANNOUNCE_START:
+                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName().c_str(), GetMinLevel(), GetMaxLevel());
+                break;
+        }
+    }
+}
+
 inline void Battleground::_CheckSafePositions(uint32 diff)
 {
     float maxDist = GetStartMaxDist();
@@ -584,10 +638,9 @@ inline void Battleground::_ProcessJoin(uint32 diff)
                     player->RemoveAurasDueToSpell(SPELL_PREPARATION);
                     player->ResetAllPowers();
                 }
-            std::string const& bgName = GetName();
             // Announce BG starting
             if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
-                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, bgName.c_str(), GetMinLevel(), GetMaxLevel());
+                QueueWorldTask(BattlegroundWorldTask(BG_WORLD_TASK_ANNOUNCE_START));
         }
     }
 
@@ -989,12 +1042,21 @@ void Battleground::EndBattleground(uint32 winner)
             {
                 guildAwarded = true;
                 if (uint32 guildId = GetBgMap()->GetOwnerGuildId(player->GetTeam()))
-                    if (Guild* guild = sGuildMgr->GetGuildById(guildId))
+                {
+                    BattlegroundWorldTask task(BG_WORLD_TASK_GUILD_CRITERIA);
+                    task.Guid = player->GetGUID();
+                    task.GuildId = guildId;
+                    task.CriteriaType = ACHIEVEMENT_CRITERIA_TYPE_WIN_BG;
+                    task.MiscValue1 = 1;
+                    QueueWorldTask(task);
+
+                    if (isArena() && isRated() && winner_team && loser_team && winner_team != loser_team)
                     {
-                        guild->GetAchievementMgr().UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_BG, 1, 0, NULL, player);
-                        if (isArena() && isRated() && winner_team && loser_team && winner_team != loser_team)
-                            guild->GetAchievementMgr().UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, std::max<uint32>(winner_team->GetRating(Arena::GetSlotByType(GetArenaType())), 1), 0, 0, NULL, player);
+                        task.CriteriaType = ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA;
+                        task.MiscValue1 = std::max<uint32>(winner_team->GetRating(Arena::GetSlotByType(GetArenaType())), 1);
+                        QueueWorldTask(task);
                     }
+                }
             }
         }
         else
@@ -1147,20 +1209,19 @@ void Battleground::RemovePlayerAtLeave(uint64 guid, bool Transport, bool SendPac
         }
 
         // remove from raid group if player is member
-        if (Group* group = GetBgRaid(team))
+        if (GetBgRaid(team))
         {
-            if (!group->RemoveMember(guid))                // group was disbanded
-            {
-                SetBgRaid(team, NULL);
-            }
+            BattlegroundWorldTask task(BG_WORLD_TASK_REMOVE_RAID_MEMBER);
+            task.Team = team;
+            task.Guid = guid;
+            QueueWorldTask(task);
         }
         DecreaseInvitedCount(team);
         //we should update battleground queue, but only if bg isn't ending
         if (isBattleground() && GetStatus() < STATUS_WAIT_LEAVE)
         {
             // a player has left the battleground, so there are free slots -> add to queue
-            AddToBGFreeSlotQueue();
-            sBattlegroundMgr->ScheduleQueueUpdate(0, 0, bgQueueTypeId, bgTypeId, GetBracketId());
+            QueueWorldTask(BattlegroundWorldTask(BG_WORLD_TASK_FREE_SLOT));
         }
         // Let others know
         WorldPacket data;
@@ -1496,6 +1557,7 @@ void Battleground::AddToBGFreeSlotQueue()
     // make sure to add only once
     if (!m_InBGFreeSlotQueue && isBattleground())
     {
+        TRINITY_GUARD(ACE_Thread_Mutex, sBattlegroundMgr->BGFreeSlotQueueLock);
         sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].push_front(this);
         m_InBGFreeSlotQueue = true;
     }
@@ -1507,6 +1569,7 @@ void Battleground::RemoveFromBGFreeSlotQueue()
     // set to be able to re-add if needed
     m_InBGFreeSlotQueue = false;
     // uncomment this code when battlegrounds will work like instances
+    TRINITY_GUARD(ACE_Thread_Mutex, sBattlegroundMgr->BGFreeSlotQueueLock);
     for (BGFreeSlotQueueType::iterator itr = sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].begin(); itr != sBattlegroundMgr->BGFreeSlotQueue[m_TypeID].end(); ++itr)
     {
         if ((*itr)->GetInstanceID() == m_InstanceID)
@@ -325,6 +325,28 @@ enum BGHonorMode
     BG_HONOR_MODE_NUM
 };
 
+// Work a battleground leaves to the world thread, see Battleground::QueueWorldTask
+enum BattlegroundWorldTaskType
+{
+    BG_WORLD_TASK_REMOVE_RAID_MEMBER,                       // Group::RemoveMember of a leaving player, may disband the raid
+    BG_WORLD_TASK_FREE_SLOT,                                // a player left, back into BGFreeSlotQueue and update the queue
+    BG_WORLD_TASK_GUILD_CRITERIA,                           // criteria of the guild owning a side of the battleground
+    BG_WORLD_TASK_ANNOUNCE_START                            // world text announcing the start
+};
+
+struct BattlegroundWorldTask
+{
+    explicit BattlegroundWorldTask(BattlegroundWorldTaskType type) : Type(type), Team(0), Guid(0), GuildId(0),
+        CriteriaType(ACHIEVEMENT_CRITERIA_TYPE_TOTAL), MiscValue1(0) { }
+
+    BattlegroundWorldTaskType Type;
+    uint32 Team;
+    uint64 Guid;                                            // player leaving, or the guild criteria's reference player
+    uint32 GuildId;
+    AchievementCriteriaTypes CriteriaType;
+    uint64 MiscValue1;
+};
+
 #define BG_AWARD_ARENA_POINTS_MIN_LEVEL 71
 #define ARENA_TIMELIMIT_POINTS_LOSS    -12
 
@@ -342,6 +364,7 @@ class Battleground
         virtual ~Battleground();
 
         void Update(uint32 diff);
+        void ProcessWorldTasks();
 
         virtual bool SetupBattleground()                    // must be implemented in BG subclass
         {
@@ -639,6 +662,8 @@ class Battleground
         void _ProcessJoin(uint32 diff);
         void _CheckSafePositions(uint32 diff);
 
+        void QueueWorldTask(BattlegroundWorldTask const& task);
+
         // Scorekeeping
         BattlegroundScoreMap PlayerScores;                // Player scores
         // must be implemented in BG subclass
@@ -727,6 +752,9 @@ class Battleground
          */
         virtual void PostUpdateImpl(uint32 /* diff */) { };
 
+        // filled on the map's thread or by the world thread between map updates, like the player lists
+        std::vector<BattlegroundWorldTask> m_WorldTasks;
+
         // Player lists
         std::vector<uint64> m_ResurrectQueue;               // Player GUID
         std::deque<uint64> m_OfflineQueue;                  // Player GUID
@@ -110,7 +110,12 @@ void BattlegroundMgr::Update(uint32 diff)
         {
             next = itr;
             ++next;
-            itr->second->Update(diff);
+            // battlegrounds with a map are updated by BattlegroundMap::Update on the map's thread,
+            // only the ones still waiting for their first player are updated here
+            if (!itr->second->GetBgMap())
+                itr->second->Update(diff);
+            // what their update and leaving players could not do on a map thread
+            itr->second->ProcessWorldTasks();
             // use the SetDeleteThis variable
             // direct deletion caused crashes
             if (itr->second->ToBeDeleted())
@@ -130,31 +135,15 @@ void BattlegroundMgr::Update(uint32 diff)
         m_BattlegroundQueues[qtype].UpdateEvents(diff);
 
     // update scheduled queues
-    if (!m_QueueUpdateScheduler.empty())
+    std::vector<QueueSchedulerItem> scheduled;
     {
-        std::vector<QueueSchedulerItem*> scheduled;
-        {
-            //copy vector and clear the other
-            scheduled = std::vector<QueueSchedulerItem*>(m_QueueUpdateScheduler);
-            m_QueueUpdateScheduler.clear();
-            //release lock
-        }
-
-        for (uint8 i = 0; i < scheduled.size(); i++)
-        {
-            uint32 arenaMMRating = scheduled[i]->_arenaMMRating;
-            uint8 arenaType = scheduled[i]->_arenaType;
-            BattlegroundQueueTypeId bgQueueTypeId = scheduled[i]->_bgQueueTypeId;
-            BattlegroundTypeId bgTypeId = scheduled[i]->_bgTypeId;
-            BattlegroundBracketId bracket_id = scheduled[i]->_bracket_id;
-            m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueUpdate(diff, bgTypeId, bracket_id, arenaType, arenaMMRating > 0, arenaMMRating);
-        }
-           
-        /*for (std::vector<QueueSchedulerItem*>::iterator itr = scheduled.begin();
-            itr != scheduled.end(); ++itr)
-            delete *itr;*/
+        TRINITY_GUARD(ACE_Thread_Mutex, m_QueueUpdateSchedulerLock);
+        scheduled.swap(m_QueueUpdateScheduler);
     }
 
+    for (std::vector<QueueSchedulerItem>::const_iterator itr = scheduled.begin(); itr != scheduled.end(); ++itr)
+        m_BattlegroundQueues[itr->_bgQueueTypeId].BattlegroundQueueUpdate(diff, itr->_bgTypeId, itr->_bracket_id, itr->_arenaType, itr->_arenaMMRating > 0, itr->_arenaMMRating);
+
     // if rating difference counts, maybe force-update queues
     if (sWorld->getIntConfig(CONFIG_ARENA_RATED_UPDATE_TIMER))
     {
@@ -1645,24 +1634,19 @@ void BattlegroundMgr::SetHolidayWeekends(std::list<uint32> activeHolidayId)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, TODO add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
-    QueueSchedulerItem* schedule_id = new QueueSchedulerItem(arenaMatchmakerRating, arenaType, bgQueueTypeId, bgTypeId, bracket_id);
-    bool found = false;
-    for (uint8 i = 0; i < m_QueueUpdateScheduler.size(); i++)
+    TRINITY_GUARD(ACE_Thread_Mutex, m_QueueUpdateSchedulerLock);
+    for (std::vector<QueueSchedulerItem>::const_iterator itr = m_QueueUpdateScheduler.begin(); itr != m_QueueUpdateScheduler.end(); ++itr)
     {
-        if (m_QueueUpdateScheduler[i]->_arenaMMRating == arenaMatchmakerRating
-            && m_QueueUpdateScheduler[i]->_arenaType == arenaType
-            && m_QueueUpdateScheduler[i]->_bgQueueTypeId == bgQueueTypeId
-            && m_QueueUpdateScheduler[i]->_bgTypeId == bgTypeId
-            && m_QueueUpdateScheduler[i]->_bracket_id == bracket_id)
-        {
-            found = true;
-            break;
-        }
+        if (itr->_arenaMMRating == arenaMatchmakerRating
+            && itr->_arenaType == arenaType
+            && itr->_bgQueueTypeId == bgQueueTypeId
+            && itr->_bgTypeId == bgTypeId
+            && itr->_bracket_id == bracket_id)
+            return;
     }
-    if (!found)
-        m_QueueUpdateScheduler.push_back(schedule_id);
+
+    m_QueueUpdateScheduler.push_back(QueueSchedulerItem(arenaMatchmakerRating, arenaType, bgQueueTypeId, bgTypeId, bracket_id));
 }
 
 uint32 BattlegroundMgr::GetMaxRatingDifference() const
@@ -127,6 +127,7 @@ class BattlegroundMgr
         BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES]; // public, because we need to access them in BG handler code
 
         BGFreeSlotQueueType BGFreeSlotQueue[MAX_BATTLEGROUND_TYPE_ID];
+        ACE_Thread_Mutex BGFreeSlotQueueLock;               // battlegrounds ending on their map's thread remove themselves
 
         void ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id);
         uint32 GetMaxRatingDifference() const;
@@ -167,7 +168,8 @@ class BattlegroundMgr
         BattlegroundSelectionWeightMap m_ArenaSelectionWeights;
         BattlegroundSelectionWeightMap m_BGSelectionWeights;
         BattlegroundSelectionWeightMap m_RatedBGSelectionWeights;
-        std::vector<QueueSchedulerItem*> m_QueueUpdateScheduler;
+        std::vector<QueueSchedulerItem> m_QueueUpdateScheduler;
+        ACE_Thread_Mutex m_QueueUpdateSchedulerLock;       // ScheduleQueueUpdate is reached from map threads (players leaving a battleground)
         std::set<uint32> m_ClientBattlegroundIds[MAX_BATTLEGROUND_TYPE_ID][MAX_BATTLEGROUND_BRACKETS]; //the instanceids just visible for the client
         uint32 m_NextRatedArenaUpdate;
         bool   m_ArenaTesting;
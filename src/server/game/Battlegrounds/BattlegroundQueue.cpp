@@ -56,6 +56,7 @@ BattlegroundQueue::~BattlegroundQueue()
                 delete (*itr);
             m_QueuedGroups[i][j].clear();
         }
+        m_RatedGroupsByMMR[i].clear();
     }
 }
 
@@ -192,6 +193,8 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* grp, Battlegr
 
         //add GroupInfo to m_QueuedGroups
         m_QueuedGroups[bracketId][index].push_back(ginfo);
+        if (isRated && ArenaType)
+            m_RatedGroupsByMMR[bracketId].insert(RatedGroupsIndex::value_type(ginfo->ArenaMatchmakerRating, ginfo));
 
         //announce to world, this code needs mutex
         if (!isRated && !isPremade && !ginfo->IsRatedBG && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
@@ -375,6 +378,8 @@ void BattlegroundQueue::RemovePlayer(uint64 guid, bool decreaseInvitedCount)
     if (group->Players.empty())
     {
         m_QueuedGroups[bracket_id][index].erase(group_itr);
+        if (group->IsRated && group->ArenaType)
+            RemoveFromRatingIndex(BattlegroundBracketId(bracket_id), group);
         delete group;
     }
     // if group wasn't empty, so it wasn't deleted, and player have left a rated
@@ -400,6 +405,83 @@ void BattlegroundQueue::RemovePlayer(uint64 guid, bool decreaseInvitedCount)
     }
 }
 
+void BattlegroundQueue::RemoveFromRatingIndex(BattlegroundBracketId bracket_id, GroupQueueInfo* ginfo)
+{
+    RatedGroupsIndex& index = m_RatedGroupsByMMR[bracket_id];
+    std::pair<RatedGroupsIndex::iterator, RatedGroupsIndex::iterator> bounds = index.equal_range(ginfo->ArenaMatchmakerRating);
+    for (RatedGroupsIndex::iterator itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == ginfo)
+        {
+            index.erase(itr);
+            return;
+        }
+    }
+
+    // rating changed while queued, fall back to a full scan
+    for (RatedGroupsIndex::iterator itr = index.begin(); itr != index.end(); ++itr)
+    {
+        if (itr->second == ginfo)
+        {
+            index.erase(itr);
+            return;
+        }
+    }
+}
+
+// returns the not yet invited rated arena group that joined first and either has its
+// matchmaker rating inside [minRating, maxRating] or joined before discardTime
+GroupQueueInfo* BattlegroundQueue::SelectRatedArenaGroup(BattlegroundBracketId bracket_id, uint32 minRating, uint32 maxRating, uint32 discardTime, GroupQueueInfo const* exclude)
+{
+    GroupQueueInfo* selected = NULL;
+
+    // groups that waited longer than the discard timer ignore ratings, they are at the front of the queues
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; ++i)
+    {
+        for (GroupsQueueType::const_iterator itr = m_QueuedGroups[bracket_id][i].begin(); itr != m_QueuedGroups[bracket_id][i].end(); ++itr)
+        {
+            GroupQueueInfo* ginfo = *itr;
+            if (ginfo->JoinTime >= discardTime)
+                break;
+
+            if (ginfo->IsInvitedToBGInstanceGUID || ginfo == exclude || (exclude && ginfo->group && ginfo->group == exclude->group))
+                continue;
+
+            if (!selected || ginfo->JoinTime < selected->JoinTime)
+                selected = ginfo;
+            break;
+        }
+    }
+
+    RatedGroupsIndex const& index = m_RatedGroupsByMMR[bracket_id];
+    RatedGroupsIndex::const_iterator end = index.upper_bound(maxRating);
+    for (RatedGroupsIndex::const_iterator itr = index.lower_bound(minRating); itr != end; ++itr)
+    {
+        GroupQueueInfo* ginfo = itr->second;
+        if (ginfo->IsInvitedToBGInstanceGUID || ginfo == exclude || (exclude && ginfo->group && ginfo->group == exclude->group))
+            continue;
+
+        if (!selected || ginfo->JoinTime < selected->JoinTime)
+            selected = ginfo;
+    }
+
+    return selected;
+}
+
+// moves a rated arena group to the premade queue of the faction it has been invited as
+void BattlegroundQueue::MoveToFactionQueue(BattlegroundBracketId bracket_id, GroupQueueInfo* ginfo, uint32 team)
+{
+    if (ginfo->Team == team)
+        return;
+
+    GroupsQueueType& from = m_QueuedGroups[bracket_id][ginfo->Team == HORDE ? BG_QUEUE_PREMADE_HORDE : BG_QUEUE_PREMADE_ALLIANCE];
+    GroupsQueueType::iterator itr = std::find(from.begin(), from.end(), ginfo);
+    if (itr != from.end())
+        from.erase(itr);
+
+    m_QueuedGroups[bracket_id][team == HORDE ? BG_QUEUE_PREMADE_HORDE : BG_QUEUE_PREMADE_ALLIANCE].push_front(ginfo);
+}
+
 //returns true when player pl_guid is in queue and is invited to bgInstanceGuid
 bool BattlegroundQueue::IsPlayerInvited(uint64 pl_guid, const uint32 bgInstanceGuid, const uint32 removeTime)
 {
@@ -927,52 +1009,16 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTyp
             arenaMaxRating = mmrMaxDiff + arenaMaxRating;
         }
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[BG_TEAMS_COUNT];
-        uint8 found = 0;
-        uint8 team = 0;
-
-        for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
-        {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
-            {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
-            }
-        }
-
-        if (!found)
+        // we need to find 2 teams which will play next game, the ones that joined first win
+        GroupQueueInfo* aTeam = SelectRatedArenaGroup(bracket_id, arenaMinRating, arenaMaxRating, discardTime, NULL);
+        if (!aTeam)
             return;
 
-        if (found == 1)
-        {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (*itr3)->JoinTime < discardTime)
-                    && (*itr_teams[0])->group != (*itr3)->group)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
+        GroupQueueInfo* hTeam = SelectRatedArenaGroup(bracket_id, arenaMinRating, arenaMaxRating, discardTime, aTeam);
 
         //if we have 2 teams, then start new arena and invite players!
-        if (found == 2)
+        if (hTeam)
         {
-            GroupQueueInfo* aTeam = *itr_teams[BG_TEAM_ALLIANCE];
-            GroupQueueInfo* hTeam = *itr_teams[BG_TEAM_HORDE];
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
             if (!arena)
             {
@@ -986,16 +1032,8 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTyp
             hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
 
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->Team != ALLIANCE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[BG_TEAM_ALLIANCE]);
-            }
-            if (hTeam->Team != HORDE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[BG_TEAM_HORDE]);
-            }
+            MoveToFactionQueue(bracket_id, aTeam, ALLIANCE);
+            MoveToFactionQueue(bracket_id, hTeam, HORDE);
 
             InviteGroupToBG(aTeam, arena, ALLIANCE);
             InviteGroupToBG(hTeam, arena, HORDE);
@@ -102,6 +102,11 @@ class BattlegroundQueue
         */
         GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
 
+        // rated arena groups of both factions ordered by matchmaker rating, lets the
+        // rated arena matching only look at the groups inside the allowed rating window
+        typedef std::multimap<uint32, GroupQueueInfo*> RatedGroupsIndex;
+        RatedGroupsIndex m_RatedGroupsByMMR[MAX_BATTLEGROUND_BRACKETS];
+
         // class to select and invite groups to bg
         class SelectionPool
         {
@@ -123,6 +128,9 @@ class BattlegroundQueue
     private:
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, uint32 side);
+        void RemoveFromRatingIndex(BattlegroundBracketId bracket_id, GroupQueueInfo* ginfo);
+        GroupQueueInfo* SelectRatedArenaGroup(BattlegroundBracketId bracket_id, uint32 minRating, uint32 maxRating, uint32 discardTime, GroupQueueInfo const* exclude);
+        void MoveToFactionQueue(BattlegroundBracketId bracket_id, GroupQueueInfo* ginfo, uint32 team);
         uint32 m_WaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
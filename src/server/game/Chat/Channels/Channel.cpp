@@ -28,6 +28,7 @@ Channel::Channel(const std::string& name, uint32 channel_id, uint32 Team)
  : m_announce(true), m_ownership(true), m_name(name), m_password(""), m_flags(0), m_channelId(channel_id), m_ownerGUID(0), m_Team(Team), _special(false)
 {
     m_IsSaved = false;
+    m_fanout = sChannelFanout->CreateList();
 
     if (IsWorld())
         m_announce = false;
@@ -115,6 +116,12 @@ Channel::Channel(const std::string& name, uint32 channel_id, uint32 Team)
     }
 }
 
+Channel::~Channel()
+{
+    if (m_fanout)
+        sChannelFanout->DestroyList(m_fanout);
+}
+
 bool Channel::IsWorld() const
 {
     std::string lowername;
@@ -228,6 +235,9 @@ void Channel::Join(uint64 p, const char *pass)
     pinfo.flags = MEMBER_FLAG_NONE;
     players[p] = pinfo;
 
+    if (m_fanout && player)
+        sChannelFanout->AddMember(m_fanout, player);
+
     MakeYouJoined(&data);
     SendToOne(&data, p);
 
@@ -275,6 +285,9 @@ void Channel::Leave(uint64 p, bool send)
         bool changeowner = players[p].IsOwner();
 
         players.erase(p);
+        if (m_fanout)
+            sChannelFanout->RemoveMember(m_fanout, p);
+
         if (m_announce && (!player || !AccountMgr::IsModeratorAccount(player->GetSession()->GetSecurity()) || !sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL)))
         {
             WorldPacket data;
@@ -354,6 +367,8 @@ void Channel::KickOrBan(uint64 good, const char *badname, bool ban)
                 SendToAll(&data);
 
             players.erase(bad->GetGUID());
+            if (m_fanout)
+                sChannelFanout->RemoveMember(m_fanout, bad->GetGUID());
             bad->LeftChannel(this);
 
             if (changeowner && m_ownership && !players.empty())
@@ -783,6 +798,12 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, uint64 p)
 {
+    if (m_fanout)
+    {
+        sChannelFanout->Broadcast(m_fanout, data, p);
+        return;
+    }
+
     for (PlayerList::const_iterator i = players.begin(); i != players.end(); ++i)
     {
         Player* player = ObjectAccessor::FindPlayer(i->first);
@@ -1068,3 +1089,9 @@ void Channel::JoinNotify(uint64 guid)
 void Channel::LeaveNotify(uint64 guid)
 {
 }
+
+void Channel::UpdateIgnores(Player* player)
+{
+    if (m_fanout)
+        sChannelFanout->UpdateIgnores(m_fanout, player);
+}
@@ -29,6 +29,7 @@
 #include "Player.h"
 #include "WorldPacket.h"
 #include "LockedMap.h"
+#include "ChannelFanout.h"
 
 enum ChatNotify
 {
@@ -160,6 +161,7 @@ class Channel
     uint32      m_channelId;
     uint64      m_ownerGUID;
     bool        m_IsSaved;
+    ChannelFanoutList* m_fanout;                        // NULL when broadcasts are sent by the calling thread
 
     private:
         // initial packet data (notify type and channel name)
@@ -250,6 +252,7 @@ class Channel
     public:
         uint32 m_Team;
         Channel(const std::string& name, uint32 channel_id, uint32 Team = 0);
+        ~Channel();
         std::string GetName() const { return m_name; }
         uint32 GetChannelId() const { return m_channelId; }
         bool IsConstant() const { return m_channelId != 0 || _special; }
@@ -285,6 +288,7 @@ class Channel
         void DeVoice(uint64 guid1, uint64 guid2);
         void JoinNotify(uint64 guid);                                           // invisible notify
         void LeaveNotify(uint64 guid);                                          // invisible notify
+        void UpdateIgnores(Player* player);
         void SetOwnership(bool ownership) { m_ownership = ownership; };
         static void CleanOldChannelsInDB();
 };
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ChannelFanout.h"
+#include "Player.h"
+#include "SocialMgr.h"
+#include "WorldSession.h"
+#include "WorldSocket.h"
+#include "World.h"
+#include "Log.h"
+#include "Threading.h"
+
+#include <ace/Guard_T.h>
+#include <ace/Method_Request.h>
+
+#include <algorithm>
+
+class ChannelFanoutList
+{
+    public:
+        ~ChannelFanoutList()
+        {
+            for (std::vector<Member>::iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+                itr->Socket->RemoveReference();
+        }
+
+        void Add(uint64 guid, WorldSocket* socket, std::vector<uint32>& ignores)
+        {
+            Remove(guid);
+
+            m_index[guid] = uint32(m_members.size());
+            m_members.push_back(Member());
+            m_members.back().Guid = guid;
+            m_members.back().Socket = socket;
+            m_members.back().Ignores.swap(ignores);
+        }
+
+        void Remove(uint64 guid)
+        {
+            IndexMap::iterator itr = m_index.find(guid);
+            if (itr == m_index.end())
+                return;
+
+            uint32 index = itr->second;
+            m_index.erase(itr);
+            m_members[index].Socket->RemoveReference();
+
+            if (index + 1 != m_members.size())
+            {
+                std::swap(m_members[index], m_members.back());
+                m_index[m_members[index].Guid] = index;
+            }
+            m_members.pop_back();
+        }
+
+        void SetIgnores(uint64 guid, std::vector<uint32>& ignores)
+        {
+            IndexMap::iterator itr = m_index.find(guid);
+            if (itr != m_index.end())
+                m_members[itr->second].Ignores.swap(ignores);
+        }
+
+        void Send(WorldPacket const* packet, uint64 speaker)
+        {
+            uint32 speakerLow = GUID_LOPART(speaker);
+            for (std::vector<Member>::iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
+            {
+                if (speaker && std::binary_search(itr->Ignores.begin(), itr->Ignores.end(), speakerLow))
+                    continue;
+
+                if (itr->Socket->SendPacket(packet) == -1)
+                    itr->Socket->CloseSocket();
+            }
+        }
+
+    private:
+        struct Member
+        {
+            uint64 Guid;
+            WorldSocket* Socket;
+            std::vector<uint32> Ignores;
+        };
+
+        typedef UNORDERED_MAP<uint64, uint32> IndexMap;
+
+        std::vector<Member> m_members;
+        IndexMap m_index;
+};
+
+class ChannelFanoutRequest : public ACE_Method_Request
+{
+    public:
+        ChannelFanoutRequest(ChannelFanout& fanout, std::vector<ChannelFanoutOp>& ops) : m_fanout(fanout), m_executed(false)
+        {
+            m_ops.swap(ops);
+        }
+
+        // The executor deletes requests it could not queue or that were still queued when it stopped. Their
+        // sockets, packets and lists must not leak, nor be freed here while the fan-out thread may still send
+        // to the lists: the batch goes back in front of the pending operations (m_lock is held by the caller).
+        ~ChannelFanoutRequest()
+        {
+            if (!m_executed)
+                m_fanout.Requeue(m_ops);
+        }
+
+        virtual int call()
+        {
+            m_fanout.ExecuteBatch(m_ops);
+            m_executed = true;
+            return 0;
+        }
+
+    private:
+        ChannelFanout& m_fanout;
+        std::vector<ChannelFanoutOp> m_ops;
+        bool m_executed;
+};
+
+ChannelFanout::~ChannelFanout()
+{
+    Unload();
+}
+
+void ChannelFanout::Initialize()
+{
+    if (!sWorld->getBoolConfig(CONFIG_CHANNEL_FANOUT))
+        return;
+
+    // one thread, batches have to be applied in the order they were queued
+    if (m_executor.activate(1) == -1)
+        sLog->outError(LOG_FILTER_CHATSYS, "ChannelFanout: could not start the fan-out thread, channel messages are sent by the speaker's thread.");
+}
+
+void ChannelFanout::Unload()
+{
+    if (!m_executor.activated())
+        return;
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        Flush();
+    }
+
+    // let the last messages and socket references go on the fan-out thread first
+    while (m_queuedBatches.value())
+        ACE_Based::Thread::Sleep(1);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    m_executor.deactivate();
+
+    // batches the executor handed back, nothing else touches the lists anymore
+    Execute(m_pending);
+    m_pending.clear();
+}
+
+void ChannelFanout::Update()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    Flush();
+}
+
+ChannelFanoutList* ChannelFanout::CreateList()
+{
+    return IsEnabled() ? new ChannelFanoutList() : NULL;
+}
+
+void ChannelFanout::DestroyList(ChannelFanoutList* list)
+{
+    ChannelFanoutOp op;
+    op.Type = CHANNEL_FANOUT_DESTROY_LIST;
+    op.List = list;
+    Queue(op, false);
+}
+
+void ChannelFanout::AddMember(ChannelFanoutList* list, Player* player)
+{
+    WorldSocket* socket = player->GetSession()->GetSocket();
+    if (!socket)
+        return;
+
+    socket->AddReference();
+
+    ChannelFanoutOp op;
+    op.Type = CHANNEL_FANOUT_ADD_MEMBER;
+    op.List = list;
+    op.Guid = player->GetGUID();
+    op.Socket = socket;
+    FillIgnores(player, op.Ignores);
+    Queue(op, false);
+}
+
+void ChannelFanout::RemoveMember(ChannelFanoutList* list, uint64 guid)
+{
+    ChannelFanoutOp op;
+    op.Type = CHANNEL_FANOUT_REMOVE_MEMBER;
+    op.List = list;
+    op.Guid = guid;
+    Queue(op, false);
+}
+
+void ChannelFanout::UpdateIgnores(ChannelFanoutList* list, Player* player)
+{
+    ChannelFanoutOp op;
+    op.Type = CHANNEL_FANOUT_SET_IGNORES;
+    op.List = list;
+    op.Guid = player->GetGUID();
+    FillIgnores(player, op.Ignores);
+    Queue(op, false);
+}
+
+void ChannelFanout::Broadcast(ChannelFanoutList* list, WorldPacket const* packet, uint64 speaker)
+{
+    ChannelFanoutOp op;
+    op.Type = CHANNEL_FANOUT_BROADCAST;
+    op.List = list;
+    op.Guid = speaker;
+    op.Packet = new WorldPacket(*packet);
+    Queue(op, true);
+}
+
+void ChannelFanout::ExecuteBatch(std::vector<ChannelFanoutOp>& ops)
+{
+    Execute(ops);
+    --m_queuedBatches;
+}
+
+void ChannelFanout::Execute(std::vector<ChannelFanoutOp>& ops)
+{
+    for (std::vector<ChannelFanoutOp>::iterator itr = ops.begin(); itr != ops.end(); ++itr)
+    {
+        switch (itr->Type)
+        {
+            case CHANNEL_FANOUT_ADD_MEMBER:
+                itr->List->Add(itr->Guid, itr->Socket, itr->Ignores);
+                break;
+            case CHANNEL_FANOUT_REMOVE_MEMBER:
+                itr->List->Remove(itr->Guid);
+                break;
+            case CHANNEL_FANOUT_SET_IGNORES:
+                itr->List->SetIgnores(itr->Guid, itr->Ignores);
+                break;
+            case CHANNEL_FANOUT_BROADCAST:
+                itr->List->Send(itr->Packet, itr->Guid);
+                delete itr->Packet;
+                break;
+            case CHANNEL_FANOUT_DESTROY_LIST:
+                delete itr->List;
+                break;
+        }
+    }
+}
+
+void ChannelFanout::Queue(ChannelFanoutOp const& op, bool flush)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+
+    // stopped or never started: nothing else touches the lists anymore
+    if (!m_executor.activated())
+    {
+        std::vector<ChannelFanoutOp> ops(1, op);
+        Execute(ops);
+        return;
+    }
+
+    m_pending.push_back(op);
+    if (flush)
+        Flush();
+}
+
+// m_lock must be held
+void ChannelFanout::Flush()
+{
+    if (m_pending.empty())
+        return;
+
+    ++m_queuedBatches;
+    if (m_executor.execute(new ChannelFanoutRequest(*this, m_pending)) == -1)
+        sLog->outError(LOG_FILTER_CHATSYS, "ChannelFanout: failed to queue a batch of channel updates, it is retried with the next one.");
+}
+
+// m_lock must be held
+void ChannelFanout::Requeue(std::vector<ChannelFanoutOp>& ops)
+{
+    ops.insert(ops.end(), m_pending.begin(), m_pending.end());
+    m_pending.swap(ops);
+    --m_queuedBatches;
+}
+
+void ChannelFanout::FillIgnores(Player* player, std::vector<uint32>& ignores)
+{
+    player->GetSocial()->GetIgnoredGuids(ignores);
+}
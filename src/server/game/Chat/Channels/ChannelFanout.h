@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITY_CHANNELFANOUT_H
+#define TRINITY_CHANNELFANOUT_H
+
+#include "Define.h"
+#include "DelayExecutor.h"
+
+#include <ace/Singleton.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
+
+#include <vector>
+
+class Player;
+class WorldPacket;
+class WorldSocket;
+class ChannelFanoutList;
+
+enum ChannelFanoutOpType
+{
+    CHANNEL_FANOUT_ADD_MEMBER,
+    CHANNEL_FANOUT_REMOVE_MEMBER,
+    CHANNEL_FANOUT_SET_IGNORES,
+    CHANNEL_FANOUT_BROADCAST,
+    CHANNEL_FANOUT_DESTROY_LIST
+};
+
+struct ChannelFanoutOp
+{
+    ChannelFanoutOp() : Type(CHANNEL_FANOUT_BROADCAST), List(NULL), Guid(0), Socket(NULL), Packet(NULL) { }
+
+    ChannelFanoutOpType Type;
+    ChannelFanoutList* List;
+    uint64 Guid;                                        // member, or speaker of a broadcast
+    WorldSocket* Socket;                                // referenced until the member is removed
+    WorldPacket* Packet;                                // one copy shared by all listeners of a broadcast
+    std::vector<uint32> Ignores;                        // sorted low guids the member ignores
+};
+
+/**
+ * Sends channel broadcasts from a dedicated thread.
+ *
+ * Every channel has a member list that only the fan-out thread reads: the
+ * socket of each member, referenced so that it stays valid after the session
+ * is gone, and a copy of the member's ignore list. A broadcast costs the
+ * speaker one copy of the packet, the listeners are walked on the fan-out
+ * thread without ObjectAccessor lookups or social list checks.
+ *
+ * Membership and ignore list changes are queued and handed over in one batch
+ * with the next broadcast or at the next world update. There is a single
+ * thread so that everything is applied in the order it was queued.
+ */
+class ChannelFanout
+{
+    friend class ACE_Singleton<ChannelFanout, ACE_Null_Mutex>;
+
+    public:
+        void Initialize();
+        void Unload();
+        void Update();
+
+        bool IsEnabled() { return m_executor.activated(); }
+
+        ChannelFanoutList* CreateList();
+        void DestroyList(ChannelFanoutList* list);
+
+        void AddMember(ChannelFanoutList* list, Player* player);
+        void RemoveMember(ChannelFanoutList* list, uint64 guid);
+        void UpdateIgnores(ChannelFanoutList* list, Player* player);
+        void Broadcast(ChannelFanoutList* list, WorldPacket const* packet, uint64 speaker);
+
+        uint32 GetQueuedBatches() const { return m_queuedBatches.value(); }
+
+        // fan-out thread side
+        void ExecuteBatch(std::vector<ChannelFanoutOp>& ops);
+        // a batch the executor dropped without running it
+        void Requeue(std::vector<ChannelFanoutOp>& ops);
+
+    private:
+        ChannelFanout() : m_queuedBatches(0) { }
+        ~ChannelFanout();
+
+        void Execute(std::vector<ChannelFanoutOp>& ops);
+        void Queue(ChannelFanoutOp const& op, bool flush);
+        void Flush();
+
+        static void FillIgnores(Player* player, std::vector<uint32>& ignores);
+
+        DelayExecutor m_executor;
+        std::vector<ChannelFanoutOp> m_pending;
+        ACE_Thread_Mutex m_lock;
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> m_queuedBatches;
+};
+
+#define sChannelFanout ACE_Singleton<ChannelFanout, ACE_Null_Mutex>::instance()
+
+#endif
@@ -253,12 +253,36 @@ Unit* HostileReference::getSourceUnit()
 
 void ThreatContainer::clearReferences()
 {
-    for (std::list<HostileReference*>::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
+    for (StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
     {
         (*i)->unlink();
         delete (*i);
     }
     iThreatList.clear();
+    iThreatGuids.clear();
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    iThreatList.push_back(hostileRef);
+    iThreatGuids.push_back(hostileRef->getUnitGuid());
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    for (size_t i = 0; i < iThreatList.size(); ++i)
+    {
+        if (iThreatList[i] == hostileRef)
+        {
+            iThreatList.erase(iThreatList.begin() + i);
+            iThreatGuids.erase(iThreatGuids.begin() + i);
+            return;
+        }
+    }
 }
 
 //============================================================
@@ -269,9 +293,9 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
         return NULL;
 
     uint64 guid = victim->GetGUID();
-    for (std::list<HostileReference*>::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-        if ((*i) && (*i)->getUnitGuid() == guid)
-            return (*i);
+    for (size_t i = 0; i < iThreatGuids.size(); ++i)
+        if (iThreatGuids[i] == guid)
+            return iThreatList[i];
 
     return NULL;
 }
@@ -296,14 +320,22 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 percent)
 }
 
 //============================================================
-// Check if the list is dirty and sort if necessary
+// Check if the list is dirty and move the changed references back into place
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(WoWSource::ThreatOrderPred());
+    if (iDirty && iThreatList.size() > 1 && WoWSource::RestoreThreatOrder(iThreatList))
+        for (size_t i = 0; i < iThreatList.size(); ++i)
+            iThreatGuids[i] = iThreatList[i]->getUnitGuid();
 
     iDirty = false;
+
+    // nobody walks the list here, grow it now rather than under a caller adding threat in a loop
+    if (iThreatList.capacity() < iThreatList.size() + THREAT_LIST_HEADROOM)
+    {
+        iThreatList.reserve(iThreatList.size() * 2 + THREAT_LIST_HEADROOM);
+        iThreatGuids.reserve(iThreatList.capacity());
+    }
 }
 
 //============================================================
@@ -316,10 +348,13 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* attacker, HostileR
     bool found = false;
     bool noPriorityTargetFound = false;
 
-    std::list<HostileReference*>::const_iterator lastRef = iThreatList.end();
+    if (iThreatList.empty())
+        return NULL;
+
+    StorageType::const_iterator lastRef = iThreatList.end();
     --lastRef;
 
-    for (std::list<HostileReference*>::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
+    for (StorageType::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
     {
         currentRef = (*iter);
 
@@ -584,14 +619,13 @@ bool ThreatManager::isNeedUpdateToClient(uint32 time)
 // Reset all aggro without modifying the threadlist.
 void ThreatManager::resetAllAggro()
 {
-    std::list<HostileReference*> &threatList = getThreatList();
+    ThreatContainer::StorageType &threatList = getThreatList();
     if (threatList.empty())
         return;
 
-    for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
-    {
-        (*itr)->setThreat(0);
-    }
+    // a reference already at 0 pulls in the owner of its pet, which can reallocate the list: walk by index
+    for (size_t i = 0; i < threatList.size(); ++i)
+        threatList[i]->setThreat(0);
 
     setDirty(true);
 }
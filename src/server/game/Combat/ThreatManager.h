@@ -24,7 +24,7 @@
 #include "LinkedReference/Reference.h"
 #include "UnitEvents.h"
 
-#include <list>
+#include <vector>
 
 //==============================================================
 
@@ -34,6 +34,7 @@ class ThreatManager;
 class SpellInfo;
 
 #define THREAT_UPDATE_INTERVAL 1 * IN_MILLISECONDS    // Server should send threat update to client periodically each second
+#define THREAT_LIST_HEADROOM 8                          // spare capacity update() keeps so that a few new references do not reallocate the list
 
 //==============================================================
 // Class to calculate the real threat based
@@ -140,19 +141,29 @@ class HostileReference : public Reference<Unit, ThreatManager>
 //==============================================================
 class ThreatManager;
 
+// The references are kept in one array ordered by threat, with the guids of their
+// targets in a parallel array so that finding a reference does not touch the others.
+// Threat changes only mark the container dirty, update() then moves the few references
+// that changed back into place. Removing a reference shifts the ones behind it and adding
+// one can reallocate the array (the headroom kept by update() only covers a few), so
+// iterators into the list are only valid while nothing is added or removed.
 class ThreatContainer
 {
+    public:
+        typedef std::vector<HostileReference*> StorageType;
+
     private:
-        std::list<HostileReference*> iThreatList;
+        StorageType iThreatList;
+        std::vector<uint64> iThreatGuids;
         bool iDirty;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* hostileRef) { iThreatList.remove(hostileRef); }
-        void addReference(HostileReference* hostileRef) { iThreatList.push_back(hostileRef); }
+        void remove(HostileReference* hostileRef);
+        void addReference(HostileReference* hostileRef);
         void clearReferences();
 
-        // Sort the list if necessary
+        // Restore the order if necessary
         void update();
     public:
         ThreatContainer() { iDirty = false; }
@@ -174,7 +185,12 @@ class ThreatContainer
 
         HostileReference* getReferenceByTarget(Unit* victim);
 
-        std::list<HostileReference*>& getThreatList() { return iThreatList; }
+        // Only for loops that read the list. A loop that changes threat (any change that is not negative
+        // also pulls in the owner of a pet), casts, kills, teleports or evades can add or remove references
+        // and has to walk a copy of the guids, ThreatManager::getThreatListGuids(), or walk by index.
+        StorageType& getThreatList() { return iThreatList; }
+
+        std::vector<uint64> const& getThreatGuids() const { return iThreatGuids; }
 };
 
 //=================================================
@@ -223,13 +239,14 @@ class ThreatManager
         // Reset all aggro of unit in threadlist satisfying the predicate.
         template<class PREDICATE> void resetAggro(PREDICATE predicate)
         {
-            std::list<HostileReference*> &threatList = getThreatList();
+            ThreatContainer::StorageType &threatList = getThreatList();
             if (threatList.empty())
                 return;
 
-            for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
+            // setThreat() can add the owner of a pet to the list, walk by index (see resetAllAggro())
+            for (size_t i = 0; i < threatList.size(); ++i)
             {
-                HostileReference* ref = (*itr);
+                HostileReference* ref = threatList[i];
 
                 if (predicate(ref->getTarget()))
                 {
@@ -241,8 +258,11 @@ class ThreatManager
 
         // methods to access the lists from the outside to do some dirty manipulation (scriping and such)
         // I hope they are used as little as possible.
-        std::list<HostileReference*>& getThreatList() { return iThreatContainer.getThreatList(); }
-        std::list<HostileReference*>& getOfflineThreatList() { return iThreatOfflineContainer.getThreatList(); }
+        // Walking the lists in place is only safe while no reference is added or removed, see ThreatContainer::getThreatList().
+        ThreatContainer::StorageType& getThreatList() { return iThreatContainer.getThreatList(); }
+        ThreatContainer::StorageType& getOfflineThreatList() { return iThreatOfflineContainer.getThreatList(); }
+        // copy of the online target guids in threat order, safe to walk while references are added or removed
+        std::vector<uint64> getThreatListGuids() const { return iThreatContainer.getThreatGuids(); }
         ThreatContainer& getOnlineContainer() { return iThreatContainer; }
         ThreatContainer& getOfflineContainer() { return iThreatOfflineContainer; }
     private:
@@ -264,13 +284,36 @@ namespace WoWSource
     {
         public:
             ThreatOrderPred(bool ascending = false) : m_ascending(ascending) {}
-            bool operator() (HostileReference const* a, HostileReference const* b) const
+            template<class T>
+            bool operator() (T const* a, T const* b) const
             {
                 return m_ascending ? a->getThreat() < b->getThreat() : a->getThreat() > b->getThreat();
             }
         private:
             const bool m_ascending;
     };
+
+    // Stable insertion pass putting a list back in descending threat order, linear when
+    // only a few entries moved by small amounts. Returns true if anything moved.
+    template<class T>
+    bool RestoreThreatOrder(std::vector<T*>& list)
+    {
+        bool moved = false;
+        for (size_t i = 1; i < list.size(); ++i)
+        {
+            T* entry = list[i];
+            float threat = entry->getThreat();
+            if (!(list[i - 1]->getThreat() < threat))
+                continue;
+
+            size_t j = i;
+            for (; j > 0 && list[j - 1]->getThreat() < threat; --j)
+                list[j] = list[j - 1];
+            list[j] = entry;
+            moved = true;
+        }
+        return moved;
+    }
 }
 #endif
 
@@ -20,6 +20,7 @@
 #include "SharedDefines.h"
 #include "SpellMgr.h"
 #include "DB2fmt.h"
+#include "WorldLoader.h"
 
 #include <map>
 
@@ -60,8 +61,6 @@ inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const st
     // compatibility format and C++ structure sizes
     ASSERT(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDB2_assert_print(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DB2FilesCount;
-
     std::string db2_filename = db2_path + filename;
     if (!storage.Load(db2_filename.c_str()))
     {
@@ -78,20 +77,58 @@ inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const st
     }
 }
 
-void LoadDB2Stores(const std::string& dataPath)
+template<class T>
+class DB2StoreLoadStep : public WorldLoaderStep
+{
+    public:
+        DB2StoreLoadStep(StoreProblemList1& errors, ACE_Thread_Mutex& errorsLock, DB2Storage<T>& storage, std::string const& db2Path, std::string const& filename)
+            : m_errors(errors), m_errorsLock(errorsLock), m_storage(storage), m_db2Path(db2Path), m_filename(filename) { }
+
+        void Load()
+        {
+            StoreProblemList1 errors;
+            LoadDB2(errors, m_storage, m_db2Path, m_filename);
+
+            if (!errors.empty())
+            {
+                TRINITY_GUARD(ACE_Thread_Mutex, m_errorsLock);
+                m_errors.splice(m_errors.end(), errors);
+            }
+        }
+
+    private:
+        StoreProblemList1& m_errors;
+        ACE_Thread_Mutex& m_errorsLock;
+        DB2Storage<T>& m_storage;
+        std::string m_db2Path;
+        std::string m_filename;
+};
+
+template<class T>
+inline void QueueDB2(WorldLoader& loader, StoreProblemList1& errors, ACE_Thread_Mutex& errorsLock, DB2Storage<T>& storage, std::string const& db2Path, std::string const& filename)
+{
+    ++DB2FilesCount;
+    loader.AddStep(filename.c_str(), new DB2StoreLoadStep<T>(errors, errorsLock, storage, db2Path, filename));
+}
+
+void LoadDB2Stores(const std::string& dataPath, uint32 threads)
 {
     std::string db2Path = dataPath + "dbc/";
 
     StoreProblemList1 bad_db2_files;
-
-    LoadDB2(bad_db2_files, sBattlePetSpeciesStore, db2Path, "BattlePetSpecies.db2");
-    LoadDB2(bad_db2_files, sItemStore, db2Path, "Item.db2");
-    LoadDB2(bad_db2_files, sItemCurrencyCostStore, db2Path, "ItemCurrencyCost.db2");
-    LoadDB2(bad_db2_files, sItemSparseStore, db2Path, "Item-sparse.db2");
-    LoadDB2(bad_db2_files, sItemExtendedCostStore, db2Path, "ItemExtendedCost.db2");
-    LoadDB2(bad_db2_files, sSpellReagentsStore, db2Path, "SpellReagents.db2");                                                 // 17399
-    LoadDB2(bad_db2_files, sItemUpgradeStore, db2Path, "ItemUpgrade.db2");
-    LoadDB2(bad_db2_files, sRulesetItemUpgradeStore, db2Path, "RulesetItemUpgrade.db2");
+    ACE_Thread_Mutex errorsLock;
+
+    ///- The stores do not read each other
+    WorldLoader db2Loader("DB2 stores", false);
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sBattlePetSpeciesStore, db2Path, "BattlePetSpecies.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sItemStore, db2Path, "Item.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sItemCurrencyCostStore, db2Path, "ItemCurrencyCost.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sItemSparseStore, db2Path, "Item-sparse.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sItemExtendedCostStore, db2Path, "ItemExtendedCost.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sSpellReagentsStore, db2Path, "SpellReagents.db2");                        // 17399
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sItemUpgradeStore, db2Path, "ItemUpgrade.db2");
+    QueueDB2(db2Loader, bad_db2_files, errorsLock, sRulesetItemUpgradeStore, db2Path, "RulesetItemUpgrade.db2");
+    db2Loader.Run(threads);
 
     // error checks
     if (bad_db2_files.size() >= DB2FilesCount)
@@ -33,6 +33,6 @@ extern DB2Storage <SpellReagentsEntry> sSpellReagentsStore;
 extern DB2Storage <ItemUpgradeEntry> sItemUpgradeStore;
 extern DB2Storage <RulesetItemUpgradeEntry> sRulesetItemUpgradeStore;
 
-void LoadDB2Stores(const std::string& dataPath);
+void LoadDB2Stores(const std::string& dataPath, uint32 threads);
 
 #endif
\ No newline at end of file
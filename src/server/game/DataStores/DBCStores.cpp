@@ -21,6 +21,7 @@
 #include "SharedDefines.h"
 #include "SpellMgr.h"
 #include "DBCfmt.h"
+#include "WorldLoader.h"
 #include "ItemPrototype.h"
 #include <iostream>
 #include <fstream>
@@ -273,7 +274,6 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     // Compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
     std::string dbcFilename = dbcPath + filename;
     SqlDbc * sql = NULL;
     if (customFormat)
@@ -312,16 +312,224 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     delete sql;
 }
 
-void LoadDBCStores(const std::string& dataPath)
+/// State shared by the DBC stores loaded in parallel
+struct DBCLoadState
+{
+    explicit DBCLoadState(std::string const& path) : dbcPath(path), availableDbcLocales(0xFFFFFFFF)
+    {
+        // Probe the locale folders once, every store then skips the missing ones
+        for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+        {
+            std::string localizedName(dbcPath);
+            localizedName.append(localeNames[i]);
+            localizedName.append("/AreaTable.dbc");
+
+            if (FILE* f = fopen(localizedName.c_str(), "rb"))
+                fclose(f);
+            else
+                availableDbcLocales &= ~(1 << i);
+        }
+    }
+
+    std::string dbcPath;
+    uint32 availableDbcLocales;
+    StoreProblemList errors;
+    ACE_Thread_Mutex errorsLock;
+};
+
+template<class T>
+class DBCStoreLoadStep : public WorldLoaderStep
+{
+    public:
+        DBCStoreLoadStep(DBCLoadState& state, DBCStorage<T>& storage, std::string const& filename, std::string const* customFormat, std::string const* customIndexName)
+            : m_state(state), m_storage(storage), m_filename(filename), m_customFormat(customFormat), m_customIndexName(customIndexName) { }
+
+        void Load()
+        {
+            uint32 availableDbcLocales = m_state.availableDbcLocales;
+            StoreProblemList errors;
+            LoadDBC(availableDbcLocales, errors, m_storage, m_state.dbcPath, m_filename, m_customFormat, m_customIndexName);
+
+            if (!errors.empty())
+            {
+                TRINITY_GUARD(ACE_Thread_Mutex, m_state.errorsLock);
+                m_state.errors.splice(m_state.errors.end(), errors);
+            }
+        }
+
+    private:
+        DBCLoadState& m_state;
+        DBCStorage<T>& m_storage;
+        std::string m_filename;
+        std::string const* m_customFormat;
+        std::string const* m_customIndexName;
+};
+
+template<class T>
+inline void QueueDBC(WorldLoader& loader, DBCLoadState& state, DBCStorage<T>& storage, std::string const& filename, std::string const* customFormat = NULL, std::string const* customIndexName = NULL)
+{
+    ++DBCFileCount;
+    loader.AddStep(filename.c_str(), new DBCStoreLoadStep<T>(state, storage, filename, customFormat, customIndexName));
+}
+
+void LoadDBCStores(const std::string& dataPath, uint32 threads)
 {
     uint32 oldMSTime = getMSTime();
 
     std::string dbcPath = dataPath+"dbc/";
 
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaStore,                   dbcPath, "AreaTable.dbc");
+    DBCLoadState dbcState(dbcPath);
+    StoreProblemList& bad_dbc_files = dbcState.errors;
+
+    ///- The stores do not read each other, load them all first and build the lookup tables from them afterwards
+    WorldLoader dbcLoader("DBC stores", false);
+    QueueDBC(dbcLoader, dbcState, sAreaStore,                   "AreaTable.dbc");
+    QueueDBC(dbcLoader, dbcState, sAchievementStore,            "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);  // 17399
+    QueueDBC(dbcLoader, dbcState, sAchievementCriteriaStore,    "Achievement_Criteria.dbc");                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sAreaTriggerStore,            "AreaTrigger.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sAreaGroupStore,              "AreaGroup.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sAreaPOIStore,                "AreaPOI.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sAuctionHouseStore,           "AuctionHouse.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sArmorLocationStore,          "ArmorLocation.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sBankBagSlotPricesStore,      "BankBagSlotPrices.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sBattlemasterListStore,       "BattlemasterList.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sBarberShopStyleStore,        "BarberShopStyle.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sCharStartOutfitStore,        "CharStartOutfit.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sCharTitlesStore,             "CharTitles.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sChatChannelsStore,           "ChatChannels.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sChrClassesStore,             "ChrClasses.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sChrRacesStore,               "ChrRaces.dbc");                                                     // 17399
+    QueueDBC(dbcLoader, dbcState, sChrPowerTypesStore,          "ChrClassesXPowerTypes.dbc");                                        // 17399
+    QueueDBC(dbcLoader, dbcState, sChrSpecializationsStore,     "ChrSpecialization.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sCinematicSequencesStore,     "CinematicSequences.dbc");                                           // 17399
+    QueueDBC(dbcLoader, dbcState, sCreatureDisplayInfoStore,    "CreatureDisplayInfo.dbc");                                          // 17399
+    QueueDBC(dbcLoader, dbcState, sCreatureFamilyStore,         "CreatureFamily.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sCreatureModelDataStore,      "CreatureModelData.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sCreatureSpellDataStore,      "CreatureSpellData.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sCreatureTypeStore,           "CreatureType.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sCurrencyTypesStore,          "CurrencyTypes.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sDestructibleModelDataStore,  "DestructibleModelData.dbc");                                        // 17399
+    QueueDBC(dbcLoader, dbcState, sDungeonEncounterStore,       "DungeonEncounter.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sDurabilityCostsStore,        "DurabilityCosts.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sDurabilityQualityStore,      "DurabilityQuality.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sEmotesStore,                 "Emotes.dbc");                                                       // 17399
+    QueueDBC(dbcLoader, dbcState, sEmotesTextStore,             "EmotesText.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sFactionStore,                "Faction.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sFactionTemplateStore,        "FactionTemplate.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sGameObjectDisplayInfoStore,  "GameObjectDisplayInfo.dbc");                                        // 17399
+    QueueDBC(dbcLoader, dbcState, sGemPropertiesStore,          "GemProperties.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sGlyphPropertiesStore,        "GlyphProperties.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sGlyphSlotStore,              "GlyphSlot.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sGtBarberShopCostBaseStore,   "gtBarberShopCostBase.dbc");                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sGtCombatRatingsStore,        "gtCombatRatings.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sGtChanceToMeleeCritBaseStore,"gtChanceToMeleeCritBase.dbc");                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sGtChanceToMeleeCritStore,    "gtChanceToMeleeCrit.dbc");                                          // 17399
+    QueueDBC(dbcLoader, dbcState, sGtChanceToSpellCritBaseStore,"gtChanceToSpellCritBase.dbc");                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sGtChanceToSpellCritStore,    "gtChanceToSpellCrit.dbc");                                          // 17399
+    QueueDBC(dbcLoader, dbcState, sGtOCTClassCombatRatingScalarStore,    "gtOCTClassCombatRatingScalar.dbc");                        // 17399
+    //LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTRegenHPStore,           dbcPath, "gtOCTRegenHP.dbc");                                               // Not used currently
+    QueueDBC(dbcLoader, dbcState, sGtOCTHpPerStaminaStore,      "gtOCTHpPerStamina.dbc");                                            //17399
+    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sGtOCTRegenMPStore,           dbcPath, "gtOCTRegenMP.dbc");                                     // Not used currently
+    QueueDBC(dbcLoader, dbcState, sGtRegenMPPerSptStore,        "gtRegenMPPerSpt.dbc");                                              //17399
+    QueueDBC(dbcLoader, dbcState, sGtSpellScalingStore,         "gtSpellScaling.dbc");                                               //17399
+    QueueDBC(dbcLoader, dbcState, sGtOCTBaseHPByClassStore,     "gtOCTBaseHPByClass.dbc");                                           //17399
+    QueueDBC(dbcLoader, dbcState, sGtOCTBaseMPByClassStore,     "gtOCTBaseMPByClass.dbc");                                           //17399
+    QueueDBC(dbcLoader, dbcState, sGuildPerkSpellsStore,        "GuildPerkSpells.dbc");                                              //17399
+    QueueDBC(dbcLoader, dbcState, sHolidaysStore,               "Holidays.dbc");                                                     // 17399
+    QueueDBC(dbcLoader, dbcState, sImportPriceArmorStore,       "ImportPriceArmor.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sImportPriceQualityStore,     "ImportPriceQuality.dbc");                                           // 17399
+    QueueDBC(dbcLoader, dbcState, sImportPriceShieldStore,      "ImportPriceShield.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sImportPriceWeaponStore,      "ImportPriceWeapon.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sItemPriceBaseStore,          "ItemPriceBase.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sItemReforgeStore,            "ItemReforge.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sItemBagFamilyStore,          "ItemBagFamily.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sItemClassStore,              "ItemClass.dbc");                                                    // 17399
+    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemDisplayInfoStore,        dbcPath, "ItemDisplayInfo.dbc");                                  // Not used currently
+    QueueDBC(dbcLoader, dbcState, sItemLimitCategoryStore,      "ItemLimitCategory.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sItemRandomPropertiesStore,   "ItemRandomProperties.dbc");                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sItemRandomSuffixStore,       "ItemRandomSuffix.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sItemSetStore,                "ItemSet.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sItemArmorQualityStore,       "ItemArmorQuality.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sItemArmorShieldStore,        "ItemArmorShield.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sItemArmorTotalStore,         "ItemArmorTotal.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageAmmoStore,         "ItemDamageAmmo.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageOneHandStore,      "ItemDamageOneHand.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageOneHandCasterStore,"ItemDamageOneHandCaster.dbc");                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageRangedStore,       "ItemDamageRanged.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageThrownStore,       "ItemDamageThrown.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageTwoHandStore,      "ItemDamageTwoHand.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageTwoHandCasterStore,"ItemDamageTwoHandCaster.dbc");                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDamageWandStore,         "ItemDamageWand.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sItemDisenchantLootStore,     "ItemDisenchantLoot.dbc");
+    QueueDBC(dbcLoader, dbcState, sLFGDungeonStore,             "LFGDungeons.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sLiquidTypeStore,             "LiquidType.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sLockStore,                   "Lock.dbc");                                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sPhaseStores,                 "Phase.dbc");                                                        // 17399
+    QueueDBC(dbcLoader, dbcState, sMailTemplateStore,           "MailTemplate.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sMapStore,                    "Map.dbc");                                                          // 17399
+    QueueDBC(dbcLoader, dbcState, sMapDifficultyStore,          "MapDifficulty.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sMountCapabilityStore,        "MountCapability.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sMountTypeStore,              "MountType.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sNameGenStore,                "NameGen.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sMovieStore,                  "Movie.dbc");                                                        // 17399
+    QueueDBC(dbcLoader, dbcState, sOverrideSpellDataStore,      "OverrideSpellData.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sPvPDifficultyStore,          "PvpDifficulty.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sQuestXPStore,                "QuestXP.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sQuestFactionRewardStore,     "QuestFactionReward.dbc");                                           // 17399
+    QueueDBC(dbcLoader, dbcState, sQuestSortStore,              "QuestSort.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sRandomPropertiesPointsStore, "RandPropPoints.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sResearchBranchStore,      "ResearchBranch.dbc");
+    QueueDBC(dbcLoader, dbcState, sResearchProjectStore,     "ResearchProject.dbc");
+    QueueDBC(dbcLoader, dbcState, sResearchSiteStore,        "ResearchSite.dbc");
+    QueueDBC(dbcLoader, dbcState, sScalingStatDistributionStore,"ScalingStatDistribution.dbc");                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sScalingStatValuesStore,      "ScalingStatValues.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sSkillLineStore,              "SkillLine.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sSkillLineAbilityStore,       "SkillLineAbility.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sSoundEntriesStore,           "SoundEntries.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sSpecializationSpellStore,    "SpecializationSpells.dbc");
+    QueueDBC(dbcLoader, dbcState, sSpellStore,                  "Spell.dbc"/*, &CustomSpellEntryfmt, &CustomSpellEntryIndex*/);      // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellMiscStore,              "SpellMisc.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellScalingStore,           "SpellScaling.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellTotemsStore,            "SpellTotems.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellTargetRestrictionsStore,"SpellTargetRestrictions.dbc");                                       // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellPowerStore,             "SpellPower.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellLevelsStore,            "SpellLevels.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellInterruptsStore,        "SpellInterrupts.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellEquippedItemsStore,     "SpellEquippedItems.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellClassOptionsStore,      "SpellClassOptions.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellCooldownsStore,         "SpellCooldowns.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellAuraOptionsStore,       "SpellAuraOptions.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellProcsPerMinuteStore,    "SpellProcsPerMinute.dbc");                                           // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellAuraRestrictionsStore,  "SpellAuraRestrictions.dbc");                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellCastingRequirementsStore, "SpellCastingRequirements.dbc");                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellCategoriesStore,        "SpellCategories.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellCategoryStores,         "SpellCategory.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellEffectStore,            "SpellEffect.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellEffectScalingStore,     "SpellEffectScaling.dbc");                                            // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellCastTimesStore,         "SpellCastTimes.dbc");                                               // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellDurationStore,          "SpellDuration.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellFocusObjectStore,       "SpellFocusObject.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellItemEnchantmentStore,   "SpellItemEnchantment.dbc");                                         // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellItemEnchantmentConditionStore, "SpellItemEnchantmentCondition.dbc");                         // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellRadiusStore,            "SpellRadius.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellRangeStore,             "SpellRange.dbc");                                                   // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellRuneCostStore,          "SpellRuneCost.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellShapeshiftStore,        "SpellShapeshift.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sSpellShapeshiftFormStore,    "SpellShapeshiftForm.dbc");                                          // 17399
+    QueueDBC(dbcLoader, dbcState, sSummonPropertiesStore,       "SummonProperties.dbc");                                             // 17399
+    QueueDBC(dbcLoader, dbcState, sTalentStore,                 "Talent.dbc");                                                       // 17399
+    QueueDBC(dbcLoader, dbcState, sTaxiNodesStore,              "TaxiNodes.dbc");                                                    // 17399
+    QueueDBC(dbcLoader, dbcState, sTaxiPathStore,               "TaxiPath.dbc");                                                     // 17399
+    QueueDBC(dbcLoader, dbcState, sTaxiPathNodeStore,           "TaxiPathNode.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sTotemCategoryStore,          "TotemCategory.dbc");                                                // 17399
+    QueueDBC(dbcLoader, dbcState, sVehicleStore,                "Vehicle.dbc");                                                      // 17399
+    QueueDBC(dbcLoader, dbcState, sVehicleSeatStore,            "VehicleSeat.dbc");                                                  // 17399
+    QueueDBC(dbcLoader, dbcState, sWMOAreaTableStore,           "WMOAreaTable.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sWorldMapAreaStore,           "WorldMapArea.dbc");                                                 // 17399
+    QueueDBC(dbcLoader, dbcState, sWorldMapOverlayStore,        "WorldMapOverlay.dbc");                                              // 17399
+    QueueDBC(dbcLoader, dbcState, sWorldSafeLocsStore,          "WorldSafeLocs.dbc");                                                // 17399
+
+    dbcLoader.Run(threads);
 
     // Must be after sAreaStore loading
     for (uint32 i = 0; i < sAreaStore.GetNumRows(); ++i)           // Areaflag numbered from 0
@@ -337,22 +545,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementStore,            dbcPath, "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementCriteriaStore,    dbcPath, "Achievement_Criteria.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaTriggerStore,            dbcPath, "AreaTrigger.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaGroupStore,              dbcPath, "AreaGroup.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaPOIStore,                dbcPath, "AreaPOI.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAuctionHouseStore,           dbcPath, "AuctionHouse.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sArmorLocationStore,          dbcPath, "ArmorLocation.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBankBagSlotPricesStore,      dbcPath, "BankBagSlotPrices.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBattlemasterListStore,       dbcPath, "BattlemasterList.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBarberShopStyleStore,        dbcPath, "BarberShopStyle.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharStartOutfitStore,        dbcPath, "CharStartOutfit.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharTitlesStore,             dbcPath, "CharTitles.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChatChannelsStore,           dbcPath, "ChatChannels.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrClassesStore,             dbcPath, "ChrClasses.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrRacesStore,               dbcPath, "ChrRaces.dbc");                                                     // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrPowerTypesStore,          dbcPath, "ChrClassesXPowerTypes.dbc");                                        // 17399
     for (uint32 i = 0; i < MAX_CLASSES; ++i)
     {
         for (uint32 j = 0; j < MAX_POWERS; ++j)
@@ -379,21 +571,6 @@ void LoadDBCStores(const std::string& dataPath)
 
         sChrClassXPowerTypesStore[entry->classId][entry->power] = index;
     }
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrSpecializationsStore,     dbcPath, "ChrSpecialization.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCinematicSequencesStore,     dbcPath, "CinematicSequences.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureDisplayInfoStore,    dbcPath, "CreatureDisplayInfo.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureFamilyStore,         dbcPath, "CreatureFamily.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureModelDataStore,      dbcPath, "CreatureModelData.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureSpellDataStore,      dbcPath, "CreatureSpellData.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureTypeStore,           dbcPath, "CreatureType.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCurrencyTypesStore,          dbcPath, "CurrencyTypes.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDestructibleModelDataStore,  dbcPath, "DestructibleModelData.dbc");                                        // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDungeonEncounterStore,       dbcPath, "DungeonEncounter.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityCostsStore,        dbcPath, "DurabilityCosts.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityQualityStore,      dbcPath, "DurabilityQuality.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesStore,                 dbcPath, "Emotes.dbc");                                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesTextStore,             dbcPath, "EmotesText.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionStore,                dbcPath, "Faction.dbc");                                                      // 17399
     for (uint32 i=0; i<sFactionStore.GetNumRows(); ++i)
     {
         FactionEntry const* faction = sFactionStore.LookupEntry(i);
@@ -404,8 +581,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionTemplateStore,        dbcPath, "FactionTemplate.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGameObjectDisplayInfoStore,  dbcPath, "GameObjectDisplayInfo.dbc");                                        // 17399
     for (uint32 i = 0; i < sGameObjectDisplayInfoStore.GetNumRows(); ++i)
     {
         if (GameObjectDisplayInfoEntry const* info = sGameObjectDisplayInfoStore.LookupEntry(i))
@@ -419,61 +594,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGemPropertiesStore,          dbcPath, "GemProperties.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphPropertiesStore,        dbcPath, "GlyphProperties.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphSlotStore,              dbcPath, "GlyphSlot.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtBarberShopCostBaseStore,   dbcPath, "gtBarberShopCostBase.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtCombatRatingsStore,        dbcPath, "gtCombatRatings.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritBaseStore,dbcPath, "gtChanceToMeleeCritBase.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritStore,    dbcPath, "gtChanceToMeleeCrit.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritBaseStore,dbcPath, "gtChanceToSpellCritBase.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritStore,    dbcPath, "gtChanceToSpellCrit.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTClassCombatRatingScalarStore,    dbcPath, "gtOCTClassCombatRatingScalar.dbc");                        // 17399
-    //LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTRegenHPStore,           dbcPath, "gtOCTRegenHP.dbc");                                               // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTHpPerStaminaStore,      dbcPath, "gtOCTHpPerStamina.dbc");                                            //17399
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sGtOCTRegenMPStore,           dbcPath, "gtOCTRegenMP.dbc");                                     // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtRegenMPPerSptStore,        dbcPath, "gtRegenMPPerSpt.dbc");                                              //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtSpellScalingStore,         dbcPath, "gtSpellScaling.dbc");                                               //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTBaseHPByClassStore,     dbcPath, "gtOCTBaseHPByClass.dbc");                                           //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTBaseMPByClassStore,     dbcPath, "gtOCTBaseMPByClass.dbc");                                           //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGuildPerkSpellsStore,        dbcPath, "GuildPerkSpells.dbc");                                              //17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sHolidaysStore,               dbcPath, "Holidays.dbc");                                                     // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceArmorStore,       dbcPath, "ImportPriceArmor.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceQualityStore,     dbcPath, "ImportPriceQuality.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceShieldStore,      dbcPath, "ImportPriceShield.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceWeaponStore,      dbcPath, "ImportPriceWeapon.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemPriceBaseStore,          dbcPath, "ItemPriceBase.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemReforgeStore,            dbcPath, "ItemReforge.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemBagFamilyStore,          dbcPath, "ItemBagFamily.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemClassStore,              dbcPath, "ItemClass.dbc");                                                    // 17399
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemDisplayInfoStore,        dbcPath, "ItemDisplayInfo.dbc");                                  // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemLimitCategoryStore,      dbcPath, "ItemLimitCategory.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomPropertiesStore,   dbcPath, "ItemRandomProperties.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomSuffixStore,       dbcPath, "ItemRandomSuffix.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemSetStore,                dbcPath, "ItemSet.dbc");                                                      // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorQualityStore,       dbcPath, "ItemArmorQuality.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorShieldStore,        dbcPath, "ItemArmorShield.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorTotalStore,         dbcPath, "ItemArmorTotal.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageAmmoStore,         dbcPath, "ItemDamageAmmo.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageOneHandStore,      dbcPath, "ItemDamageOneHand.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageOneHandCasterStore,dbcPath, "ItemDamageOneHandCaster.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageRangedStore,       dbcPath, "ItemDamageRanged.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageThrownStore,       dbcPath, "ItemDamageThrown.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageTwoHandStore,      dbcPath, "ItemDamageTwoHand.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageTwoHandCasterStore,dbcPath, "ItemDamageTwoHandCaster.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageWandStore,         dbcPath, "ItemDamageWand.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDisenchantLootStore,     dbcPath, "ItemDisenchantLoot.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLFGDungeonStore,             dbcPath, "LFGDungeons.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLiquidTypeStore,             dbcPath, "LiquidType.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLockStore,                   dbcPath, "Lock.dbc");                                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPhaseStores,                 dbcPath, "Phase.dbc");                                                        // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMailTemplateStore,           dbcPath, "MailTemplate.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapStore,                    dbcPath, "Map.dbc");                                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapDifficultyStore,          dbcPath, "MapDifficulty.dbc");                                                // 17399
     // Fill data
     sMapDifficultyMap[MAKE_PAIR32(0, 0)] = MapDifficulty(0, 0, false);                                                                                      //Map 0 is missingg from MapDifficulty.dbc use this till its ported to sql
     for (uint32 i = 0; i < sMapDifficultyStore.GetNumRows(); ++i)
@@ -481,33 +601,21 @@ void LoadDBCStores(const std::string& dataPath)
             sMapDifficultyMap[MAKE_PAIR32(entry->MapId, entry->Difficulty)] = MapDifficulty(entry->resetTime, entry->maxPlayers, entry->areaTriggerText[0] > 0);
     sMapDifficultyStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMountCapabilityStore,        dbcPath, "MountCapability.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMountTypeStore,              dbcPath, "MountType.dbc");                                                    // 17399
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sNameGenStore,                dbcPath, "NameGen.dbc");                                                      // 17399
     for (uint32 i = 0; i < sNameGenStore.GetNumRows(); ++i)
         if (NameGenEntry const* entry = sNameGenStore.LookupEntry(i))
             sGenNameVectoArraysMap[entry->race].stringVectorArray[entry->gender].push_back(std::string(entry->name));
     sNameGenStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMovieStore,                  dbcPath, "Movie.dbc");                                                        // 17399
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sOverrideSpellDataStore,      dbcPath, "OverrideSpellData.dbc");                                            // 17399
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPvPDifficultyStore,          dbcPath, "PvpDifficulty.dbc");                                                // 17399
     for (uint32 i = 0; i < sPvPDifficultyStore.GetNumRows(); ++i)
         if (PvPDifficultyEntry const* entry = sPvPDifficultyStore.LookupEntry(i))
             if (entry->bracketId > MAX_BATTLEGROUND_BRACKETS)
                 ASSERT(false && "Need update MAX_BATTLEGROUND_BRACKETS by DBC data");
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestXPStore,                dbcPath, "QuestXP.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestFactionRewardStore,     dbcPath, "QuestFactionReward.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestSortStore,              dbcPath, "QuestSort.dbc");                                                    // 17399
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sRandomPropertiesPointsStore, dbcPath, "RandPropPoints.dbc");                                               // 17399
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchBranchStore,      dbcPath, "ResearchBranch.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchProjectStore,     dbcPath, "ResearchProject.dbc");
     for (uint32 i =0; i < sResearchProjectStore.GetNumRows(); ++i)
     {
         ResearchProjectEntry const* rp = sResearchProjectStore.LookupEntry(i);
@@ -518,7 +626,6 @@ void LoadDBCStores(const std::string& dataPath)
         sResearchProjectSet.insert(rp);
     }
     //sResearchProjectStore.Clear();
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchSiteStore,        dbcPath, "ResearchSite.dbc");
     for (uint32 i =0; i < sResearchSiteStore.GetNumRows(); ++i)
     {
         ResearchSiteEntry const* rs = sResearchSiteStore.LookupEntry(i);
@@ -535,14 +642,6 @@ void LoadDBCStores(const std::string& dataPath)
     }
     //sResearchSiteStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatDistributionStore,dbcPath, "ScalingStatDistribution.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatValuesStore,      dbcPath, "ScalingStatValues.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineStore,              dbcPath, "SkillLine.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineAbilityStore,       dbcPath, "SkillLineAbility.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSoundEntriesStore,           dbcPath, "SoundEntries.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpecializationSpellStore,    dbcPath, "SpecializationSpells.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellStore,                  dbcPath, "Spell.dbc"/*, &CustomSpellEntryfmt, &CustomSpellEntryIndex*/);      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellMiscStore,              dbcPath, "SpellMisc.dbc");                                                    // 17399
 
     for (uint32 i = 1; i < sSpellStore.GetNumRows(); ++i)
     {
@@ -585,23 +684,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellScalingStore,           dbcPath,"SpellScaling.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellTotemsStore,            dbcPath,"SpellTotems.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellTargetRestrictionsStore,dbcPath,"SpellTargetRestrictions.dbc");                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellPowerStore,             dbcPath,"SpellPower.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellLevelsStore,            dbcPath,"SpellLevels.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellInterruptsStore,        dbcPath,"SpellInterrupts.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEquippedItemsStore,     dbcPath,"SpellEquippedItems.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellClassOptionsStore,      dbcPath,"SpellClassOptions.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCooldownsStore,         dbcPath,"SpellCooldowns.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellAuraOptionsStore,       dbcPath,"SpellAuraOptions.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellProcsPerMinuteStore,    dbcPath,"SpellProcsPerMinute.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellAuraRestrictionsStore,  dbcPath,"SpellAuraRestrictions.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCastingRequirementsStore, dbcPath,"SpellCastingRequirements.dbc");                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCategoriesStore,        dbcPath,"SpellCategories.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCategoryStores,         dbcPath,"SpellCategory.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEffectStore,            dbcPath,"SpellEffect.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEffectScalingStore,     dbcPath,"SpellEffectScaling.dbc");                                            // 17399
 
     for (uint32 i = 1; i < sSpellEffectStore.GetNumRows(); ++i)
     {
@@ -619,17 +701,6 @@ void LoadDBCStores(const std::string& dataPath)
                     sSpellSkillingList.push_back(spell);
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCastTimesStore,         dbcPath, "SpellCastTimes.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellDurationStore,          dbcPath, "SpellDuration.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellFocusObjectStore,       dbcPath, "SpellFocusObject.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentStore,   dbcPath, "SpellItemEnchantment.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentConditionStore, dbcPath, "SpellItemEnchantmentCondition.dbc");                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRadiusStore,            dbcPath, "SpellRadius.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRangeStore,             dbcPath, "SpellRange.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRuneCostStore,          dbcPath, "SpellRuneCost.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellShapeshiftStore,        dbcPath, "SpellShapeshift.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellShapeshiftFormStore,    dbcPath, "SpellShapeshiftForm.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSummonPropertiesStore,       dbcPath, "SummonProperties.dbc");                                             // 17399
 
     // Since mop, we count 7 entries with slot = -1, we must set them at 0, if not, crash !
     for (uint32 i = 0; i < sSummonPropertiesStore.GetNumRows(); ++i)
@@ -641,16 +712,12 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTalentStore,                 dbcPath, "Talent.dbc");                                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiNodesStore,              dbcPath, "TaxiNodes.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathStore,               dbcPath, "TaxiPath.dbc");                                                     // 17399
     for (uint32 i = 1; i < sTaxiPathStore.GetNumRows(); ++i)
         if (TaxiPathEntry const* entry = sTaxiPathStore.LookupEntry(i))
             sTaxiPathSetBySource[entry->from][entry->to] = TaxiPathBySourceAndDestination(entry->ID, entry->price);
     uint32 pathCount = sTaxiPathStore.GetNumRows();
 
     //## TaxiPathNode.dbc ## Loaded only for initialization different structures
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathNodeStore,           dbcPath, "TaxiPathNode.dbc");                                                 // 17399
     // Calculate path nodes count
     std::vector<uint32> pathLength;
     pathLength.resize(pathCount);                           // 0 and some other indexes not used
@@ -729,16 +796,9 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTotemCategoryStore,          dbcPath, "TotemCategory.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleStore,                dbcPath, "Vehicle.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleSeatStore,            dbcPath, "VehicleSeat.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWMOAreaTableStore,           dbcPath, "WMOAreaTable.dbc");                                                 // 17399
     for (uint32 i = 0; i < sWMOAreaTableStore.GetNumRows(); ++i)
         if (WMOAreaTableEntry const* entry = sWMOAreaTableStore.LookupEntry(i))
             sWMOAreaInfoByTripple.insert(WMOAreaInfoByTripple::value_type(WMOAreaTableTripple(entry->rootId, entry->adtId, entry->groupId), entry));
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapAreaStore,           dbcPath, "WorldMapArea.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapOverlayStore,        dbcPath, "WorldMapOverlay.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldSafeLocsStore,          dbcPath, "WorldSafeLocs.dbc");                                                // 17399
 
     // error checks
     if (bad_dbc_files.size() >= DBCFileCount)
@@ -232,6 +232,6 @@ extern DBCStorage <WorldMapAreaEntry>            sWorldMapAreaStore; //-- use Zo
 extern DBCStorage <WorldMapOverlayEntry>         sWorldMapOverlayStore;
 extern DBCStorage <WorldSafeLocsEntry>           sWorldSafeLocsStore;
 
-void LoadDBCStores(const std::string& dataPath);
+void LoadDBCStores(const std::string& dataPath, uint32 threads);
 
 #endif
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Common.h"
+#include "SharedDefines.h"
+#include "DBCStores.h"
+#include "ObjectMgr.h"
+#include "LFGMatcher.h"
+#include "LFGMgr.h"
+
+#include <algorithm>
+
+namespace
+{
+    uint8 const MatcherRoles[3] = { ROLE_TANK, ROLE_HEALER, ROLE_DAMAGE };
+    uint8 const MatcherRoleSlots[3] = { LFG_TANKS_NEEDED, LFG_HEALERS_NEEDED, LFG_DPS_NEEDED };
+    uint32 const MatcherGroupSize = LFG_TANKS_NEEDED + LFG_HEALERS_NEEDED + LFG_DPS_NEEDED;
+
+    // candidates of a role looked at per open slot, keeps a bucket full of misfits from being walked over and over
+    uint32 const MatcherMaxScan = 64;
+
+    bool AssignRoles(std::vector<uint8> const& roles, uint32 index, uint8* freeSlots)
+    {
+        if (index == roles.size())
+            return true;
+
+        for (uint8 i = 0; i < 3; ++i)
+        {
+            if (!(roles[index] & MatcherRoles[i]) || !freeSlots[i])
+                continue;
+
+            --freeSlots[i];
+            bool assigned = AssignRoles(roles, index + 1, freeSlots);
+            ++freeSlots[i];
+
+            if (assigned)
+                return true;
+        }
+        return false;
+    }
+}
+
+LfgMatcher::LfgMatcher(LfgMatcherQueue const& queue, LfgMatcherConflictMap const& conflicts) :
+    m_queue(queue), m_conflicts(conflicts), m_matched(queue.size(), false)
+{
+    for (uint32 i = 0; i < m_queue.size(); ++i)
+    {
+        LfgMatcherEntry const& entry = m_queue[i];
+        if (!CanAssignRoles(entry.roles))                  // Could never be part of a group
+        {
+            m_matched[i] = true;
+            continue;
+        }
+
+        for (std::vector<uint32>::const_iterator itDungeon = entry.dungeons.begin(); itDungeon != entry.dungeons.end(); ++itDungeon)
+        {
+            DungeonBuckets& buckets = m_buckets[*itDungeon];
+            for (uint8 role = 0; role < 3; ++role)
+            {
+                for (std::vector<uint8>::const_iterator itRoles = entry.roles.begin(); itRoles != entry.roles.end(); ++itRoles)
+                {
+                    if (*itRoles & MatcherRoles[role])
+                    {
+                        buckets.roles[role].push_back(i);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+   Matches the whole queue, oldest entries first
+
+   @param[out]    groups Guids of every group formed, the entry it was formed for first
+*/
+void LfgMatcher::Match(std::vector<LfgMatcherGroup>& groups)
+{
+    std::vector<uint32> members;
+    for (uint32 i = 0; i < m_queue.size(); ++i)
+    {
+        if (m_matched[i])
+            continue;
+
+        LfgMatcherEntry const& entry = m_queue[i];
+        for (std::vector<uint32>::const_iterator itDungeon = entry.dungeons.begin(); itDungeon != entry.dungeons.end(); ++itDungeon)
+        {
+            if (!Form(i, *itDungeon, members))
+                continue;
+
+            LfgMatcherGroup group;
+            for (std::vector<uint32>::const_iterator itMember = members.begin(); itMember != members.end(); ++itMember)
+            {
+                m_matched[*itMember] = true;
+                group.push_back(m_queue[*itMember].guid);
+            }
+            groups.push_back(group);
+            break;
+        }
+    }
+}
+
+/**
+   Completes a group for an entry from the buckets of one dungeon
+
+   @param[in]     anchor Queue index of the entry the group is formed for
+   @param[in]     dungeon Dungeon all members selected
+   @param[out]    members Queue indexes of the group, anchor first
+   @return true if a full group was found
+*/
+bool LfgMatcher::Form(uint32 anchor, uint32 dungeon, std::vector<uint32>& members)
+{
+    DungeonBuckets& buckets = m_buckets[dungeon];
+    members.assign(1, anchor);
+    std::vector<uint8> roles = m_queue[anchor].roles;
+
+    while (roles.size() < MatcherGroupSize)
+    {
+        bool added = false;
+        for (uint8 role = 0; role < 3 && !added; ++role)
+        {
+            // Someone of this role still fits next to the members found so far?
+            roles.push_back(MatcherRoles[role]);
+            bool open = CanAssignRoles(roles);
+            roles.pop_back();
+            if (!open)
+                continue;
+
+            int32 candidate = FindCandidate(buckets, role, members, roles);
+            if (candidate < 0)
+                continue;
+
+            members.push_back(uint32(candidate));
+            roles.insert(roles.end(), m_queue[candidate].roles.begin(), m_queue[candidate].roles.end());
+            added = true;
+        }
+
+        if (!added)
+            return false;
+    }
+    return true;
+}
+
+/**
+   Finds the oldest entry of a role bucket that still fits in the group
+
+   @return Queue index of the entry or -1 if there is none
+*/
+int32 LfgMatcher::FindCandidate(DungeonBuckets& buckets, uint8 role, std::vector<uint32> const& members, std::vector<uint8> const& roles)
+{
+    Bucket const& bucket = buckets.roles[role];
+    uint32& start = buckets.start[role];
+    while (start < bucket.size() && m_matched[bucket[start]])
+        ++start;
+
+    uint32 scanned = 0;
+    for (uint32 i = start; i < bucket.size() && scanned < MatcherMaxScan; ++i)
+    {
+        uint32 index = bucket[i];
+        if (m_matched[index] || std::find(members.begin(), members.end(), index) != members.end())
+            continue;
+
+        ++scanned;
+        LfgMatcherEntry const& entry = m_queue[index];
+        if (roles.size() + entry.roles.size() > MatcherGroupSize || IsConflicting(index, members))
+            continue;
+
+        std::vector<uint8> joined(roles);
+        joined.insert(joined.end(), entry.roles.begin(), entry.roles.end());
+        if (CanAssignRoles(joined))
+            return int32(index);
+    }
+    return -1;
+}
+
+bool LfgMatcher::IsConflicting(uint32 index, std::vector<uint32> const& members) const
+{
+    LfgMatcherConflictMap::const_iterator itConflicts = m_conflicts.find(m_queue[index].guid);
+    if (itConflicts == m_conflicts.end())
+        return false;
+
+    for (std::vector<uint32>::const_iterator itMember = members.begin(); itMember != members.end(); ++itMember)
+        if (itConflicts->second.find(m_queue[*itMember].guid) != itConflicts->second.end())
+            return true;
+
+    return false;
+}
+
+bool LfgMatcher::CanAssignRoles(std::vector<uint8> const& roles)
+{
+    if (roles.empty() || roles.size() > MatcherGroupSize)
+        return false;
+
+    uint8 freeSlots[3] = { MatcherRoleSlots[0], MatcherRoleSlots[1], MatcherRoleSlots[2] };
+    return AssignRoles(roles, 0, freeSlots);
+}
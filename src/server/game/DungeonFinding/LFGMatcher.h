@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LFGMATCHER_H
+#define _LFGMATCHER_H
+
+#include "Define.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+/// A queued player or group as the matcher sees it, copied out of LfgQueueInfo
+struct LfgMatcherEntry
+{
+    uint64 guid;
+    std::vector<uint32> dungeons;                          ///< Selected dungeons
+    std::vector<uint8> roles;                              ///< Selected roles of every member, leader flag removed
+};
+
+typedef std::vector<LfgMatcherEntry> LfgMatcherQueue;
+typedef std::vector<uint64> LfgMatcherGroup;
+typedef std::map<uint64, std::set<uint64> > LfgMatcherConflictMap;
+
+/**
+   Forms dungeon groups of one tank, one healer and three damage dealers.
+
+   Entries are bucketed by dungeon and by role. Every entry not matched yet, in
+   queue order, is completed greedily from the buckets of the dungeons it
+   selected: the oldest entry that can fill a role still open is taken, scarce
+   roles first. Each entry is looked at a bounded number of times, so a queue is
+   matched in about linear time instead of walking every combination of it.
+
+   The matcher only reads the copies it is given and can run on any thread.
+   Its groups are candidates, LFGMgr checks them against the live queue before
+   making a proposal out of them.
+*/
+class LfgMatcher
+{
+    public:
+        LfgMatcher(LfgMatcherQueue const& queue, LfgMatcherConflictMap const& conflicts);
+
+        void Match(std::vector<LfgMatcherGroup>& groups);
+
+        /// True if members with the given roles fit in one dungeon group at the same time
+        static bool CanAssignRoles(std::vector<uint8> const& roles);
+
+    private:
+        typedef std::vector<uint32> Bucket;                ///< Queue indexes in queue order
+
+        struct DungeonBuckets
+        {
+            DungeonBuckets() { start[0] = start[1] = start[2] = 0; }
+
+            Bucket roles[3];                               ///< Tank, healer and damage candidates
+            uint32 start[3];                               ///< Everything before is matched already
+        };
+
+        bool Form(uint32 anchor, uint32 dungeon, std::vector<uint32>& members);
+        int32 FindCandidate(DungeonBuckets& buckets, uint8 role, std::vector<uint32> const& members, std::vector<uint8> const& roles);
+        bool IsConflicting(uint32 index, std::vector<uint32> const& members) const;
+
+        LfgMatcherQueue const& m_queue;
+        LfgMatcherConflictMap const& m_conflicts;
+        std::map<uint32, DungeonBuckets> m_buckets;
+        std::vector<bool> m_matched;
+};
+
+#endif
@@ -31,10 +31,53 @@
 
 #include "Group.h"
 #include "Player.h"
+#include "Threading.h"
+
+#include <ace/Method_Request.h>
+
+/// Copy of the dungeon queues handed to the matcher thread
+struct LfgMatchJob
+{
+    struct Queue
+    {
+        uint8 queueId;
+        LfgMatcherQueue entries;
+        std::vector<LfgMatcherGroup> groups;               ///< Filled by the matcher
+    };
+
+    LfgMatchJob() : done(false) {}
+
+    void Run()
+    {
+        for (std::vector<Queue>::iterator it = queues.begin(); it != queues.end(); ++it)
+            LfgMatcher(it->entries, conflicts).Match(it->groups);
+        done = true;
+    }
+
+    std::vector<Queue> queues;
+    LfgMatcherConflictMap conflicts;
+    ACE_Atomic_Op<ACE_Thread_Mutex, bool> done;
+};
+
+class LfgMatchRequest : public ACE_Method_Request
+{
+    public:
+        LfgMatchRequest(LfgMatchJob& job) : m_job(job) {}
+
+        virtual int call()
+        {
+            m_job.Run();
+            return 0;
+        }
+
+    private:
+        LfgMatchJob& m_job;
+};
 
 LFGMgr::LFGMgr(): m_update(true), m_QueueTimer(0), m_lfgProposalId(1),
 m_WaitTimeAvg(-1), m_WaitTimeTank(-1), m_WaitTimeHealer(-1), m_WaitTimeDps(-1),
-m_NumWaitTimeAvg(0), m_NumWaitTimeTank(0), m_NumWaitTimeHealer(0), m_NumWaitTimeDps(0)
+m_NumWaitTimeAvg(0), m_NumWaitTimeTank(0), m_NumWaitTimeHealer(0), m_NumWaitTimeDps(0),
+m_MatchJob(NULL), m_MatchPending(false)
 {
     m_update = sWorld->getBoolConfig(CONFIG_DUNGEON_FINDER_ENABLE);
     if (m_update)
@@ -58,6 +101,8 @@ m_NumWaitTimeAvg(0), m_NumWaitTimeTank(0), m_NumWaitTimeHealer(0), m_NumWaitTime
 
 LFGMgr::~LFGMgr()
 {
+    Unload();
+
     for (LfgRewardMap::iterator itr = m_RewardMap.begin(); itr != m_RewardMap.end(); ++itr)
         delete itr->second;
 
@@ -74,6 +119,23 @@ LFGMgr::~LFGMgr()
         delete it->second;
 }
 
+/// Stops the matcher thread, a match still running is waited for and dropped
+void LFGMgr::Unload()
+{
+    if (m_MatchJob)
+    {
+        if (m_MatchExecutor.activated())
+            while (!m_MatchJob->done.value())
+                ACE_Based::Thread::Sleep(1);
+
+        delete m_MatchJob;
+        m_MatchJob = NULL;
+    }
+
+    if (m_MatchExecutor.activated())
+        m_MatchExecutor.deactivate();
+}
+
 void LFGMgr::_LoadFromDB(Field* fields, uint64 guid)
 {
     if (!fields)
@@ -289,137 +351,34 @@ void LFGMgr::Update(uint32 diff)
             sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Update: QueueId %u: checking [" UI64FMTD "] newToQueue(%u), currentQueue(%u)", queueId, frontguid, uint32(newToQueue.size()), uint32(currentQueue.size()));
             firstNew.push_back(frontguid);
             newToQueue.pop_front();
-            uint8 alreadyInQueue = 0;
-            LfgGuidList temporalList = currentQueue;
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, TYPEID_DUNGEON)) // Group found!
-            {
-                // Remove groups in the proposal from new and current queues (not from queue map)
-                for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
-                {
-                    currentQueue.remove(*itQueue);
-                    newToQueue.remove(*itQueue);
-                }
-                m_Proposals[++m_lfgProposalId] = pProposal;
 
-                uint64 guid = 0;
-                for (LfgProposalPlayerMap::const_iterator itPlayers = pProposal->players.begin(); itPlayers != pProposal->players.end(); ++itPlayers)
-                {
-                    guid = itPlayers->first;
-                    SetState(guid, LFG_STATE_PROPOSAL);
-                    if (Player* player = ObjectAccessor::FindPlayer(itPlayers->first))
-                    {
-                        Group* grp = player->GetGroup();
-                        if (grp)
-                         {
-                            uint64 gguid = grp->GetGUID();
-                            SetState(gguid, LFG_STATE_PROPOSAL);
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        }
-                        else
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        player->GetSession()->SendLfgUpdateProposal(m_lfgProposalId, pProposal);
-                    }
-                }
+            // Dungeon groups are formed by the matcher from the whole queue, see ScheduleDungeonMatch
+            m_MatchPending = true;
 
-                if (pProposal->state == LFG_PROPOSAL_SUCCESS)
-                    UpdateProposal(m_lfgProposalId, guid, true);
-            }
-            else
-            {
-                if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
-                    ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
-            }
+            LfgGuidList temporalList;
+            GetQueueCandidates(frontguid, currentQueue, temporalList);
+            ClearCompatibles();
 
             if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_SUBTYPEID_RAID)) // Group found!
-            {
-                // Remove groups in the proposal from new and current queues (not from queue map)
-                for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
-                {
-                    currentQueue.remove(*itQueue);
-                    newToQueue.remove(*itQueue);
-                }
-                m_Proposals[++m_lfgProposalId] = pProposal;
-
-                uint64 guid = 0;
-                for (LfgProposalPlayerMap::const_iterator itPlayers = pProposal->players.begin(); itPlayers != pProposal->players.end(); ++itPlayers)
-                {
-                    guid = itPlayers->first;
-                    SetState(guid, LFG_STATE_PROPOSAL);
-                    if (Player* player = ObjectAccessor::FindPlayer(itPlayers->first))
-                    {
-                        Group* grp = player->GetGroup();
-                        if (grp)
-                         {
-                            uint64 gguid = grp->GetGUID();
-                            SetState(gguid, LFG_STATE_PROPOSAL);
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        }
-                        else
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        player->GetSession()->SendLfgUpdateProposal(m_lfgProposalId, pProposal);
-                    }
-                }
-
-                if (pProposal->state == LFG_PROPOSAL_SUCCESS)
-                    UpdateProposal(m_lfgProposalId, guid, true);
-            }
+                AddProposal(pProposal, currentQueue, newToQueue);
             else
             {
-                if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
-                    ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
+                temporalList.clear();
+                GetQueueCandidates(frontguid, currentQueue, temporalList);
+                ClearCompatibles();
+
+                if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_SUBTYPEID_SCENARIO)) // Group found!
+                    AddProposal(pProposal, currentQueue, newToQueue);
+                else if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end())
+                    currentQueue.push_back(frontguid);  // Lfg group not found, add this group to the queue.
             }
 
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_SUBTYPEID_SCENARIO)) // Group found!
-            {
-                // Remove groups in the proposal from new and current queues (not from queue map)
-                for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
-                {
-                    currentQueue.remove(*itQueue);
-                    newToQueue.remove(*itQueue);
-                }
-                m_Proposals[++m_lfgProposalId] = pProposal;
-
-                uint64 guid = 0;
-                for (LfgProposalPlayerMap::const_iterator itPlayers = pProposal->players.begin(); itPlayers != pProposal->players.end(); ++itPlayers)
-                {
-                    guid = itPlayers->first;
-                    SetState(guid, LFG_STATE_PROPOSAL);
-                    if (Player* player = ObjectAccessor::FindPlayer(itPlayers->first))
-                    {
-                        Group* grp = player->GetGroup();
-                        if (grp)
-                         {
-                            uint64 gguid = grp->GetGUID();
-                            SetState(gguid, LFG_STATE_PROPOSAL);
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        }
-                        else
-                            sLFGMgr->SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
-                        player->GetSession()->SendLfgUpdateProposal(m_lfgProposalId, pProposal);
-                    }
-                }
-
-                if (pProposal->state == LFG_PROPOSAL_SUCCESS)
-                    UpdateProposal(m_lfgProposalId, guid, true);
-            }
-            else
-            {
-                if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
-                    ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-            }
-
-            if (alreadyInQueue == 3 && std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end())
-                currentQueue.push_back(frontguid);
-
             firstNew.clear();
         }
     }
 
+    ProcessDungeonMatches();
+
     // Update all players status queue info
     if (m_QueueTimer > LFG_QUEUEUPDATE_INTERVAL)
     {
@@ -510,6 +469,7 @@ bool LFGMgr::RemoveFromQueue(uint64 guid)
         it->second.remove(guid);
 
     RemoveFromCompatibles(guid);
+    RemoveMatchConflicts(guid);
 
     LfgQueueInfoMap::iterator it = m_QueueInfoMap.find(guid);
     if (it != m_QueueInfoMap.end())
@@ -974,6 +934,212 @@ void LFGMgr::OfferContinue(Group* grp)
     }
 }
 
+/**
+   Registers a proposal found for a queue and sends it to its players
+
+   @param[in]     pProposal Proposal to register
+   @param[in,out] currentQueue Queue the proposal was formed from
+   @param[in,out] newToQueue Guids of the same queue not processed yet
+*/
+void LFGMgr::AddProposal(LfgProposal* pProposal, LfgGuidList& currentQueue, LfgGuidList& newToQueue)
+{
+    // Remove groups in the proposal from new and current queues (not from queue map)
+    for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
+    {
+        currentQueue.remove(*itQueue);
+        newToQueue.remove(*itQueue);
+    }
+    m_Proposals[++m_lfgProposalId] = pProposal;
+
+    uint64 guid = 0;
+    for (LfgProposalPlayerMap::const_iterator itPlayers = pProposal->players.begin(); itPlayers != pProposal->players.end(); ++itPlayers)
+    {
+        guid = itPlayers->first;
+        SetState(guid, LFG_STATE_PROPOSAL);
+        if (Player* player = ObjectAccessor::FindPlayer(itPlayers->first))
+        {
+            if (Group* grp = player->GetGroup())
+                SetState(grp->GetGUID(), LFG_STATE_PROPOSAL);
+
+            SendUpdateStatus(player, LfgUpdateData(LFG_UPDATETYPE_PROPOSAL_BEGIN, GetSelectedDungeons(guid), GetComment(guid)));
+            player->GetSession()->SendLfgUpdateProposal(m_lfgProposalId, pProposal);
+        }
+    }
+
+    if (pProposal->state == LFG_PROPOSAL_SUCCESS)
+        UpdateProposal(m_lfgProposalId, guid, true);
+}
+
+/**
+   Hands a copy of the queued dungeon groups and players to the matcher thread
+*/
+void LFGMgr::ScheduleDungeonMatch()
+{
+    m_MatchPending = false;
+
+    LfgMatchJob* job = new LfgMatchJob();
+    for (LfgGuidListMap::const_iterator itQueue = m_currentQueue.begin(); itQueue != m_currentQueue.end(); ++itQueue)
+    {
+        job->queues.push_back(LfgMatchJob::Queue());
+        LfgMatchJob::Queue& queue = job->queues.back();
+        queue.queueId = itQueue->first;
+
+        for (LfgGuidList::const_iterator it = itQueue->second.begin(); it != itQueue->second.end(); ++it)
+        {
+            LfgQueueInfo const* info = GetLfgQueueInfo(*it);
+            if (!info || info->type != TYPEID_DUNGEON || GetState(*it) != LFG_STATE_QUEUED)
+                continue;
+
+            queue.entries.push_back(LfgMatcherEntry());
+            LfgMatcherEntry& entry = queue.entries.back();
+            entry.guid = *it;
+            entry.dungeons.assign(info->dungeons.begin(), info->dungeons.end());
+            for (LfgRolesMap::const_iterator itRoles = info->roles.begin(); itRoles != info->roles.end(); ++itRoles)
+                entry.roles.push_back(itRoles->second & ~ROLE_LEADER);
+        }
+
+        if (queue.entries.empty())
+            job->queues.pop_back();
+    }
+
+    if (job->queues.empty())
+    {
+        delete job;
+        return;
+    }
+
+    job->conflicts = m_MatchConflicts;
+    m_MatchJob = job;
+
+    if (!m_MatchExecutor.activated() && m_MatchExecutor.activate(1) == -1)
+        sLog->outError(LOG_FILTER_LFG, "LFGMgr::ScheduleDungeonMatch: could not start the matcher thread, dungeon groups are matched by the world thread.");
+
+    if (!m_MatchExecutor.activated() || m_MatchExecutor.execute(new LfgMatchRequest(*job)) == -1)
+        job->Run();
+}
+
+/**
+   Turns the groups of a finished match into proposals and starts the next match
+*/
+void LFGMgr::ProcessDungeonMatches()
+{
+    if (m_MatchJob)
+    {
+        if (!m_MatchJob->done.value())
+            return;
+
+        LfgMatchJob* job = m_MatchJob;
+        m_MatchJob = NULL;
+
+        // Answers cached for raids and scenarios are not valid for dungeons
+        ClearCompatibles();
+        for (std::vector<LfgMatchJob::Queue>::const_iterator itQueue = job->queues.begin(); itQueue != job->queues.end(); ++itQueue)
+        {
+            LfgGuidList& currentQueue = m_currentQueue[itQueue->queueId];
+            LfgGuidList& newToQueue = m_newToQueue[itQueue->queueId];
+            for (std::vector<LfgMatcherGroup>::const_iterator itGroup = itQueue->groups.begin(); itGroup != itQueue->groups.end(); ++itGroup)
+            {
+                // Members may have left the queue or got a proposal while the matcher was running
+                LfgGuidList check;
+                for (LfgMatcherGroup::const_iterator it = itGroup->begin(); it != itGroup->end(); ++it)
+                    if (std::find(currentQueue.begin(), currentQueue.end(), *it) != currentQueue.end() && GetState(*it) == LFG_STATE_QUEUED)
+                        check.push_back(*it);
+
+                if (check.size() != itGroup->size())
+                {
+                    m_MatchPending = true;
+                    continue;
+                }
+
+                LfgProposal* pProposal = NULL;
+                if (CheckCompatibility(check, pProposal, TYPEID_DUNGEON) && pProposal)
+                    AddProposal(pProposal, currentQueue, newToQueue);
+                else
+                {
+                    delete pProposal;
+                    AddMatchConflicts(check);
+                    m_MatchPending = true;
+                }
+            }
+        }
+        ClearCompatibles();
+
+        delete job;
+    }
+
+    if (m_MatchPending)
+        ScheduleDungeonMatch();
+}
+
+/**
+   Records why a group formed by the matcher was not compatible, so the next
+   match does not form it again. Pairs that can not be grouped are stored, if
+   every pair is fine the first guid is kept away from all the others.
+
+   @param[in]     check Guids of the group, the one it was formed for first
+*/
+void LFGMgr::AddMatchConflicts(const LfgGuidList& check)
+{
+    bool found = false;
+    for (LfgGuidList::const_iterator itFirst = check.begin(); itFirst != check.end(); ++itFirst)
+    {
+        LfgGuidList::const_iterator itSecond = itFirst;
+        for (++itSecond; itSecond != check.end(); ++itSecond)
+        {
+            LfgGuidList pair;
+            pair.push_back(*itFirst);
+            pair.push_back(*itSecond);
+
+            LfgProposal* pProposal = NULL;
+            bool compatibles = CheckCompatibility(pair, pProposal, TYPEID_DUNGEON);
+            delete pProposal;
+            if (compatibles)
+                continue;
+
+            // Removed from the queue while checking
+            if (!GetLfgQueueInfo(*itFirst) || !GetLfgQueueInfo(*itSecond))
+                continue;
+
+            m_MatchConflicts[*itFirst].insert(*itSecond);
+            m_MatchConflicts[*itSecond].insert(*itFirst);
+            found = true;
+        }
+    }
+
+    if (found || !GetLfgQueueInfo(check.front()))
+        return;
+
+    LfgGuidList::const_iterator it = check.begin();
+    for (++it; it != check.end(); ++it)
+    {
+        if (!GetLfgQueueInfo(*it))
+            continue;
+
+        m_MatchConflicts[check.front()].insert(*it);
+        m_MatchConflicts[*it].insert(check.front());
+    }
+}
+
+void LFGMgr::RemoveMatchConflicts(uint64 guid)
+{
+    LfgMatcherConflictMap::iterator itConflicts = m_MatchConflicts.find(guid);
+    if (itConflicts == m_MatchConflicts.end())
+        return;
+
+    for (std::set<uint64>::const_iterator it = itConflicts->second.begin(); it != itConflicts->second.end(); ++it)
+    {
+        LfgMatcherConflictMap::iterator itOther = m_MatchConflicts.find(*it);
+        if (itOther == m_MatchConflicts.end())
+            continue;
+
+        itOther->second.erase(guid);
+        if (itOther->second.empty())
+            m_MatchConflicts.erase(itOther);
+    }
+
+    m_MatchConflicts.erase(itConflicts);
+}
+
 /**
    Checks que main queue to try to form a Lfg group. Returns first match found (if any)
 
@@ -983,7 +1149,8 @@ void LFGMgr::OfferContinue(Group* grp)
 */
 LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
+    if (sLog->ShouldLog(LOG_FILTER_LFG, LOG_LEVEL_DEBUG))
+        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
 
     uint8 maxGroupSize = 5;
     if (type == LFG_SUBTYPEID_RAID)
@@ -1013,7 +1180,7 @@ LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType
    @param[out]    pProposal Proposal found if groups are compatibles and Match
    @return true if group are compatibles
 */
-bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgType type)
+bool LFGMgr::CheckCompatibility(LfgGuidList& check, LfgProposal*& pProposal, LfgType type)
 {
     if (pProposal)                                         // Do not check anything if we already have a proposal
         return false;
@@ -1024,22 +1191,22 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     if (type == LFG_SUBTYPEID_SCENARIO)
         maxGroupSize = 3;
 
-    std::string strGuids = ConcatenateGuids(check);
-
     if (check.size() > maxGroupSize || check.empty())
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s): Size wrong - Not compatibles", strGuids.c_str());
+        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%u guids): Size wrong - Not compatibles", uint32(check.size()));
         return false;
     }
 
     if (check.size() == 1 && IS_PLAYER_GUID(check.front())) // Player joining dungeon... compatible
         return true;
 
+    uint64 key = GetCompatibilityKey(check);
+
     // Previously cached?
-    LfgAnswer answer = GetCompatibles(strGuids);
+    LfgAnswer answer = GetCompatibles(check, key);
     if (answer != LFG_ANSWER_PENDING)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) compatibles (cached): %d", strGuids.c_str(), answer);
+        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") compatibles (cached): %d", key, answer);
         return bool(answer);
     }
 
@@ -1050,13 +1217,14 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
         check.pop_front();
 
         // Check all-but-new compatibilities (New, A, B, C, D) --> check(A, B, C, D)
-        if (!CheckCompatibility(check, pProposal, type))          // Group not compatible
+        bool compatibles = CheckCompatibility(check, pProposal, type);
+        check.push_front(frontGuid);
+        if (!compatibles)                                  // Group not compatible
         {
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) not compatibles (%s not compatibles)", strGuids.c_str(), ConcatenateGuids(check).c_str());
-            SetCompatibles(strGuids, false);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") not compatibles (all but [" UI64FMTD "] not compatibles)", key, frontGuid);
+            SetCompatibles(check, key, false);
             return false;
         }
-        check.push_front(frontGuid);
         // all-but-new compatibles, now check with new
     }
 
@@ -1100,11 +1268,11 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     // Do not match - groups already in a lfgDungeon or too much players
     if (numLfgGroups > 1 || numPlayers > maxGroupSize)
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(check, key, false);
         if (numLfgGroups > 1)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) More than one Lfggroup (%u)", strGuids.c_str(), numLfgGroups);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") More than one Lfggroup (%u)", key, numLfgGroups);
         else
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Too much players (%u)", strGuids.c_str(), numPlayers);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") Too much players (%u)", key, numPlayers);
         return false;
     }
 
@@ -1131,7 +1299,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     {
         Player* player = ObjectAccessor::FindPlayer(it->first);
         if (!player)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Warning! [" UI64FMTD "] offline! Marking as not compatibles!", strGuids.c_str(), it->first);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") Warning! [" UI64FMTD "] offline! Marking as not compatibles!", key, it->first);
         else
         {
             for (PlayerSet::const_iterator itPlayer = players.begin(); itPlayer != players.end() && player; ++itPlayer)
@@ -1139,7 +1307,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
                 // Do not form a group with ignoring candidates
                 if (player->GetSocial()->HasIgnore((*itPlayer)->GetGUIDLow()) || (*itPlayer)->GetSocial()->HasIgnore(player->GetGUIDLow()))
                 {
-                    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Players [" UI64FMTD "] and [" UI64FMTD "] ignoring", strGuids.c_str(), (*itPlayer)->GetGUID(), player->GetGUID());
+                    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") Players [" UI64FMTD "] and [" UI64FMTD "] ignoring", key, (*itPlayer)->GetGUID(), player->GetGUID());
                     player = NULL;
                 }
             }
@@ -1153,8 +1321,8 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     if (players.size() != numPlayers || !CheckGroupRoles(rolesMap, type))
     {
         if (players.size() == numPlayers)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Roles not compatible", strGuids.c_str());
-        SetCompatibles(strGuids, false);
+            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") Roles not compatible", key);
+        SetCompatibles(check, key, false);
         return false;
     }
 
@@ -1180,15 +1348,15 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
 
     if (compatibleDungeons.empty())
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(check, key, false);
         return false;
     }
-    SetCompatibles(strGuids, true);
+    SetCompatibles(check, key, true);
 
     // ----- Group is compatible, if we have MAXGROUPSIZE members then match is found
     if (numPlayers != maxGroupSize)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Compatibles but not match. Players(%u)", strGuids.c_str(), numPlayers);
+        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") Compatibles but not match. Players(%u)", key, numPlayers);
         uint8 Tanks_Needed = LFG_TANKS_NEEDED;
         uint8 Healers_Needed = LFG_HEALERS_NEEDED;
         uint8 Dps_Needed = LFG_DPS_NEEDED;
@@ -1251,7 +1419,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
         }
         return true;
     }
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) MATCH! Group formed", strGuids.c_str());
+    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (" UI64FMTD ") MATCH! Group formed", key);
 
     // GROUP FORMED!
     // TODO - Improve algorithm to select proper group based on Item Level
@@ -1454,46 +1622,144 @@ void LFGMgr::UpdateRoleCheck(uint64 gguid, uint64 guid /* = 0 */, uint8 roles /*
 */
 void LFGMgr::RemoveFromCompatibles(uint64 guid)
 {
-    std::stringstream out;
-    out << guid;
-    std::string strGuid = out.str();
-
     sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveFromCompatibles: Removing [" UI64FMTD "]", guid);
-    for (LfgCompatibleMap::iterator itNext = m_CompatibleMap.begin(); itNext != m_CompatibleMap.end();)
+    LfgCompatibleKeyMap::iterator itKeys = m_CompatibleKeys.find(guid);
+    if (itKeys == m_CompatibleKeys.end())
+        return;
+
+    // EraseCompatibles takes the keys out of this list as well
+    std::vector<uint64> keys;
+    keys.swap(itKeys->second);
+    for (std::vector<uint64>::const_iterator it = keys.begin(); it != keys.end(); ++it)
     {
-        LfgCompatibleMap::iterator it = itNext++;
-        if (it->first.find(strGuid) != std::string::npos)  // Found, remove it
-            m_CompatibleMap.erase(it);
+        LfgCompatibleMap::iterator itCompatible = m_CompatibleMap.find(*it);
+        if (itCompatible != m_CompatibleMap.end())
+            EraseCompatibles(itCompatible);
     }
+
+    m_CompatibleKeys.erase(guid);
 }
 
 /**
    Stores the compatibility of a list of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     check List of guids the answer belongs to
+   @param[in]     key Compatibility key of the list (see GetCompatibilityKey)
    @param[in]     compatibles Compatibles or not
 */
-void LFGMgr::SetCompatibles(std::string key, bool compatibles)
+void LFGMgr::SetCompatibles(const LfgGuidList& check, uint64 key, bool compatibles)
 {
-    m_CompatibleMap[key] = LfgAnswer(compatibles);
+    LfgCompatibleMap::iterator itCompatible = m_CompatibleMap.find(key);
+    if (itCompatible != m_CompatibleMap.end())
+    {
+        if (itCompatible->second.guids == check)
+        {
+            itCompatible->second.answer = LfgAnswer(compatibles);
+            return;
+        }
+
+        // Another list with the same key, the newest answer takes its place
+        EraseCompatibles(itCompatible);
+    }
+
+    LfgCompatibleEntry& entry = m_CompatibleMap[key];
+    entry.guids = check;
+    entry.answer = LfgAnswer(compatibles);
+
+    for (LfgGuidList::const_iterator it = check.begin(); it != check.end(); ++it)
+        m_CompatibleKeys[*it].push_back(key);
 }
 
 /**
    Get the compatibility of a group of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     check List of guids
+   @param[in]     key Compatibility key of the list (see GetCompatibilityKey)
    @return 1 (Compatibles), 0 (Not compatibles), -1 (Not set)
 */
-LfgAnswer LFGMgr::GetCompatibles(std::string key)
+LfgAnswer LFGMgr::GetCompatibles(const LfgGuidList& check, uint64 key) const
 {
     LfgAnswer answer = LFG_ANSWER_PENDING;
-    LfgCompatibleMap::iterator it = m_CompatibleMap.find(key);
-    if (it != m_CompatibleMap.end())
-        answer = it->second;
+    LfgCompatibleMap::const_iterator it = m_CompatibleMap.find(key);
+    if (it != m_CompatibleMap.end() && it->second.guids == check)
+        answer = it->second.answer;
 
     return answer;
 }
 
+/**
+   Removes a cached answer and its key from the lists of all guids it belongs to
+
+   @param[in]     itCompatible Cached answer to remove
+*/
+void LFGMgr::EraseCompatibles(LfgCompatibleMap::iterator itCompatible)
+{
+    uint64 key = itCompatible->first;
+    for (LfgGuidList::const_iterator it = itCompatible->second.guids.begin(); it != itCompatible->second.guids.end(); ++it)
+    {
+        LfgCompatibleKeyMap::iterator itKeys = m_CompatibleKeys.find(*it);
+        if (itKeys == m_CompatibleKeys.end())
+            continue;
+
+        std::vector<uint64>& keys = itKeys->second;
+        keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+        if (keys.empty())
+            m_CompatibleKeys.erase(itKeys);
+    }
+
+    m_CompatibleMap.erase(itCompatible);
+}
+
+/**
+   Drops every cached compatibility answer
+*/
+void LFGMgr::ClearCompatibles()
+{
+    m_CompatibleMap.clear();
+    m_CompatibleKeys.clear();
+}
+
+/**
+   Collects the guids of a queue that share at least one selected dungeon with
+   the given guid. Groups without a common dungeon can never be matched, so
+   leaving them out keeps FindNewGroups from walking every combination of the
+   whole queue.
+
+   @param[in]     guid Player or group guid looking for a group
+   @param[in]     queue Queue to take the candidates from
+   @param[out]    candidates Queued guids that may be matched with guid, in queue order
+*/
+void LFGMgr::GetQueueCandidates(uint64 guid, const LfgGuidList& queue, LfgGuidList& candidates) const
+{
+    LfgQueueInfo const* info = GetLfgQueueInfo(guid);
+    if (!info)
+        return;
+
+    for (LfgGuidList::const_iterator it = queue.begin(); it != queue.end(); ++it)
+    {
+        if (*it == guid)
+            continue;
+
+        LfgQueueInfo const* other = GetLfgQueueInfo(*it);
+        if (!other)                                        // Keep it, CheckCompatibility will remove it from the queue
+        {
+            candidates.push_back(*it);
+            continue;
+        }
+
+        LfgDungeonSet const& smaller = info->dungeons.size() < other->dungeons.size() ? info->dungeons : other->dungeons;
+        LfgDungeonSet const& bigger = info->dungeons.size() < other->dungeons.size() ? other->dungeons : info->dungeons;
+        for (LfgDungeonSet::const_iterator itDungeon = smaller.begin(); itDungeon != smaller.end(); ++itDungeon)
+        {
+            if (bigger.find(*itDungeon) != bigger.end())
+            {
+                candidates.push_back(*it);
+                break;
+            }
+        }
+    }
+}
+
 /**
    Given a list of dungeons remove the dungeons players have restrictions.
 
@@ -2438,7 +2704,7 @@ LfgType LFGMgr::GetDungeonType(uint32 dungeonId)
    @param[in]     check list of guids
    @returns Concatenated string
 */
-std::string LFGMgr::ConcatenateGuids(LfgGuidList check)
+std::string LFGMgr::ConcatenateGuids(const LfgGuidList& check)
 {
     if (check.empty())
         return "";
@@ -2451,6 +2717,30 @@ std::string LFGMgr::ConcatenateGuids(LfgGuidList check)
     return o.str();
 }
 
+/**
+   Given a list of guids returns a hash of the ordered list, used as key of the
+   compatibility cache. Lists sharing a key are told apart by the list stored
+   with the answer.
+
+   @param[in]     check list of guids
+   @returns Compatibility key
+*/
+uint64 LFGMgr::GetCompatibilityKey(const LfgGuidList& check)
+{
+    uint64 key = UI64LIT(0xCBF29CE484222325);
+    for (LfgGuidList::const_iterator it = check.begin(); it != check.end(); ++it)
+    {
+        uint64 h = *it;
+        h ^= h >> 33;
+        h *= UI64LIT(0xFF51AFD7ED558CCD);
+        h ^= h >> 33;
+        h *= UI64LIT(0xC4CEB9FE1A85EC53);
+        h ^= h >> 33;
+        key = (key ^ h) * UI64LIT(0x100000001B3);
+    }
+    return key;
+}
+
 HolidayIds LFGMgr::GetDungeonSeason(uint32 dungeonId)
 {
     HolidayIds holiday = HOLIDAY_NONE;
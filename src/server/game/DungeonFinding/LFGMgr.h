@@ -19,10 +19,13 @@
 #define _LFGMGR_H
 
 #include "Common.h"
+#include "UnorderedMap.h"
 #include <ace/Singleton.h>
 #include "LFG.h"
 #include "LockedMap.h"
 #include "LFGPlayerData.h"
+#include "LFGMatcher.h"
+#include "DelayExecutor.h"
 
 class LfgGroupData;
 class LfgPlayerData;
@@ -147,7 +150,7 @@ typedef std::set<Player*> PlayerSet;
 typedef std::list<Player*> LfgPlayerList;
 typedef std::multimap<uint32, LfgReward const*> LfgRewardMap;
 typedef std::pair<LfgRewardMap::const_iterator, LfgRewardMap::const_iterator> LfgRewardMapBounds;
-typedef std::map<std::string, LfgAnswer> LfgCompatibleMap;
+typedef std::map<uint64, std::vector<uint64> > LfgCompatibleKeyMap;
 typedef std::map<uint64, LfgDungeonSet> LfgDungeonMap;
 typedef std::map<uint64, uint8> LfgRolesMap;
 typedef std::map<uint64, LfgAnswer> LfgAnswerMap;
@@ -219,6 +222,17 @@ struct LfgQueueInfo
     uint8 category;
 };
 
+/// Cached compatibility of a list of guids
+struct LfgCompatibleEntry
+{
+    LfgGuidList guids;                                     ///< List the answer belongs to, compared on every lookup
+    LfgAnswer answer;                                      ///< Compatibles or not
+};
+
+typedef UNORDERED_MAP<uint64, LfgCompatibleEntry> LfgCompatibleMap;
+
+struct LfgMatchJob;
+
 /// Stores player data related to proposal to join
 struct LfgProposalPlayer
 {
@@ -280,6 +294,7 @@ class LFGMgr
 
     public:
         void Update(uint32 diff);
+        void Unload();
 
         // Reward
         void LoadRewards();
@@ -358,16 +373,27 @@ class LFGMgr
         // Group Matching
         LfgProposal* FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type);
         bool CheckGroupRoles(LfgRolesMap &groles, LfgType type, bool removeLeaderFlag = true);
-        bool CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgType type);
+        bool CheckCompatibility(LfgGuidList& check, LfgProposal*& pProposal, LfgType type);
         void GetCompatibleDungeons(LfgDungeonSet& dungeons, const PlayerSet& players, LfgLockPartyMap& lockMap);
-        void SetCompatibles(std::string concatenatedGuids, bool compatibles);
-        LfgAnswer GetCompatibles(std::string concatenatedGuids);
+        void GetQueueCandidates(uint64 guid, const LfgGuidList& queue, LfgGuidList& candidates) const;
+        void SetCompatibles(const LfgGuidList& check, uint64 key, bool compatibles);
+        LfgAnswer GetCompatibles(const LfgGuidList& check, uint64 key) const;
+        void EraseCompatibles(LfgCompatibleMap::iterator itCompatible);
+        void ClearCompatibles();
         void RemoveFromCompatibles(uint64 guid);
+        void AddProposal(LfgProposal* pProposal, LfgGuidList& currentQueue, LfgGuidList& newToQueue);
+
+        // Dungeon matching (see LfgMatcher)
+        void ScheduleDungeonMatch();
+        void ProcessDungeonMatches();
+        void AddMatchConflicts(const LfgGuidList& check);
+        void RemoveMatchConflicts(uint64 guid);
 
         // Generic
         const LfgDungeonSet& GetDungeonsByRandom(uint32 randomdungeon, bool check = false);
         LfgType GetDungeonType(uint32 dungeon);
-        std::string ConcatenateGuids(LfgGuidList check);
+        std::string ConcatenateGuids(const LfgGuidList& check);
+        static uint64 GetCompatibilityKey(const LfgGuidList& check);
 
         // General variables
         bool m_update;                                     ///< Doing an update?
@@ -389,7 +415,12 @@ class LFGMgr
         LfgQueueInfoMap m_QueueInfoMap;                    ///< Queued groups
         LfgGuidListMap m_currentQueue;                     ///< Ordered list. Used to find groups
         LfgGuidListMap m_newToQueue;                       ///< New groups to add to queue
-        LfgCompatibleMap m_CompatibleMap;                  ///< Compatible dungeons
+        LfgCompatibleMap m_CompatibleMap;                  ///< Compatible dungeons, keyed by GetCompatibilityKey
+        LfgCompatibleKeyMap m_CompatibleKeys;              ///< Compatibility keys each queued guid takes part in
+        LfgMatcherConflictMap m_MatchConflicts;            ///< Queued guids that failed to form a group with each other
+        LfgMatchJob* m_MatchJob;                           ///< Dungeon match running on m_MatchExecutor, NULL if none
+        DelayExecutor m_MatchExecutor;                     ///< Thread running the dungeon matcher
+        bool m_MatchPending;                               ///< Dungeon queue changed since the last match was started
         LfgGuidList m_teleport;                            ///< Players being teleported
         // Rolecheck - Proposal - Vote Kicks
         LfgRoleCheckMap m_RoleChecks;                      ///< Current Role checks
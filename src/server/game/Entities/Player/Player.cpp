@@ -43,6 +43,7 @@
 #include "CellImpl.h"
 #include "ObjectMgr.h"
 #include "GuildMgr.h"
+#include "MaintenanceMgr.h"
 #include "GroupMgr.h"
 #include "ObjectAccessor.h"
 #include "CreatureAI.h"
@@ -798,6 +799,8 @@ Player::Player(WorldSession* session): Unit(true), m_achievementMgr(this), m_rep
     SetGroupInvite(0);
     m_groupUpdateMask = 0;
     m_auraRaidUpdateMask = 0;
+    m_groupStatusGroup = 0;
+    m_groupStatusSequence = 0;
     m_bPassOnGroupLoot = false;
 
     duel = NULL;
@@ -2262,6 +2265,17 @@ void Player::Update(uint32 p_time)
     else
         m_groupUpdateDelay -= p_time;
 
+    // what the other members published since the last update
+    if (Group* group = GetGroup())
+    {
+        if (group->GetLowGUID() != m_groupStatusGroup)
+        {
+            m_groupStatusGroup = group->GetLowGUID();
+            m_groupStatusSequence = 0;
+        }
+        group->SendMemberStatusUpdates(this, m_groupStatusSequence);
+    }
+
     Pet* pet = GetPet();
     if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityRange()) && !pet->isPossessed())
         RemovePet(pet, PET_SLOT_ACTUAL_PET_SLOT, true, pet->m_Stampeded);
@@ -6826,6 +6840,12 @@ void Player::CleanupChannels()
     sLog->outDebug(LOG_FILTER_CHATSYS, "Player: channels cleaned up!");
 }
 
+void Player::UpdateChannelIgnores()
+{
+    for (JoinedChannelsList::iterator itr = m_channels.begin(); itr != m_channels.end(); ++itr)
+        (*itr)->UpdateIgnores(this);
+}
+
 void Player::UpdateLocalChannels(uint32 newZone)
 {
     if (GetSession()->PlayerLoading() && !IsBeingTeleportedFar())
@@ -20498,6 +20518,9 @@ void Player::_LoadMail()
         while (result->NextRow());
     }
     m_mailsLoaded = true;
+
+    // an expired mail job running from an older query must leave this mailbox alone
+    sMaintenanceMgr->OnMailboxLoaded(GetGUIDLow());
 }
 
 void Player::LoadPet(PreparedQueryResult result)
@@ -25866,7 +25889,7 @@ void Player::SendUpdateToOutOfRangeGroupMembers()
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
     if (Group* group = GetGroup())
-        group->UpdatePlayerOutOfRange(this);
+        group->PublishMemberStatus(this);
 
     m_groupUpdateMask = GROUP_UPDATE_FLAG_NONE;
     m_auraRaidUpdateMask = 0;
@@ -2338,6 +2338,7 @@ class Player : public Unit, public GridObject<Player>
         void JoinedChannel(Channel* c);
         void LeftChannel(Channel* c);
         void CleanupChannels();
+        void UpdateChannelIgnores();
         void UpdateLocalChannels(uint32 newZone);
         void LeaveLFGChannel();
 
@@ -3274,6 +3275,8 @@ class Player : public Unit, public GridObject<Player>
         uint32 m_groupInviteGUID;
         uint32 m_groupUpdateMask;
         uint64 m_auraRaidUpdateMask;
+        uint32 m_groupStatusGroup;                      // group m_groupStatusSequence belongs to
+        uint32 m_groupStatusSequence;                   // last member status of that group sent to us
         bool m_bPassOnGroupLoot;
 
         // last used pet number (for BG's)
@@ -201,6 +201,15 @@ bool PlayerSocial::HasIgnore(uint32 ignore_guid)
     return false;
 }
 
+// sorted, the social map is ordered by guid
+void PlayerSocial::GetIgnoredGuids(std::vector<uint32>& guids) const
+{
+    guids.clear();
+    for (PlayerSocialMap::const_iterator itr = m_playerSocialMap.begin(); itr != m_playerSocialMap.end(); ++itr)
+        if (itr->second.Flags & SOCIAL_FLAG_IGNORED)
+            guids.push_back(itr->first);
+}
+
 SocialMgr::SocialMgr()
 {
 }
@@ -85,6 +85,9 @@ void MapManager::UnLoadTransportFromMap(Transport* t)
     t->m_NPCPassengerSet.clear();         
     m_TransportsByInstanceIdMap[t->GetInstanceId()].erase(t);
     m_Transports.erase(t);
+    map->RemoveTransport(t);
+    if (t->IsTeleportPending())
+        UnscheduleTransportTeleport(t);
     t->m_WayPoints.clear();
     t->RemoveFromWorld();
 
@@ -277,13 +280,19 @@ void MapManager::LoadTransportNPCs()
 }
 
 Transport::Transport(uint32 period, uint32 script) : GameObject(), m_pathTime(0), m_timer(0),
-currenttguid(0), m_period(period), ScriptId(script), m_nextNodeTime(0), shouldBeStopped(false)
+currenttguid(0), m_period(period), ScriptId(script), shouldBeStopped(false), m_teleportPending(false), m_nextNodeTime(0)
 {
     m_updateFlag = (UPDATEFLAG_TRANSPORT | UPDATEFLAG_STATIONARY_POSITION | UPDATEFLAG_ROTATION);
 }
 
 Transport::~Transport()
 {
+    if (m_teleportPending)
+        sMapMgr->UnscheduleTransportTeleport(this);
+
+    if (Map* map = FindMap())
+        map->RemoveTransport(this);
+
     for (CreatureSet::iterator itr = m_NPCPassengerSet.begin(); itr != m_NPCPassengerSet.end(); ++itr)
     {
         (*itr)->SetTransport(NULL);
@@ -570,6 +579,13 @@ bool Transport::GenerateWaypoints(uint32 pathid, std::set<uint32> &mapids)
     return true;
 }
 
+// the first node is always at time 0, so some node is at or before any time on the path
+Transport::WayPointMap::const_iterator Transport::GetWayPointAt(uint32 pathTime) const
+{
+    WayPointMap::const_iterator itr = m_WayPoints.upper_bound(pathTime);
+    return --itr;
+}
+
 Transport::WayPointMap::const_iterator Transport::GetNextWayPoint()
 {
     WayPointMap::const_iterator iter = m_curr;
@@ -615,6 +631,18 @@ void Transport::TeleportTransport(uint32 newMapid, float x, float y, float z)
         (*itr)->FarTeleportTo(newMap, x, y, z, (*itr)->GetOrientation());
 }
 
+void Transport::SetMap(Map* map)
+{
+    GameObject::SetMap(map);
+    map->AddTransport(this);
+}
+
+void Transport::ResetMap()
+{
+    GetMap()->RemoveTransport(this);
+    GameObject::ResetMap();
+}
+
 bool Transport::AddPassenger(Player* passenger)
 {
     if (m_passengers.insert(passenger).second)
@@ -649,42 +677,66 @@ void Transport::Update(uint32 p_diff)
     if (!m_period)
         return;
 
+    // the other map cannot be touched from this map's thread, MapManager moves the transport once all maps are updated
+    if (m_teleportPending)
+        return;
+
     m_timer = getMSTime() % m_period;
-    while (((m_timer - m_curr->first) % m_pathTime) > ((m_next->first - m_curr->first) % m_pathTime))
+    WayPointMap::const_iterator target = GetWayPointAt(m_timer % m_pathTime);
+    if (target != m_curr)
     {
-        DoEventIfAny(*m_curr, true);
+        // the position is taken from the node the path time falls in, the nodes passed on the way
+        // only contribute their events and teleport flags
+        bool teleport = false;
+        do
+        {
+            DoEventIfAny(*m_curr, true);
+            m_curr = GetNextWayPoint();
+            DoEventIfAny(*m_curr, false);
+            teleport |= m_curr->second.teleport;
+        }
+        while (m_curr != target);
 
-        m_curr = GetNextWayPoint();
         m_next = GetNextWayPoint();
 
-        DoEventIfAny(*m_curr, false);
-
         // first check help in case client-server transport coordinates de-synchronization
-        if (m_curr->second.mapid != GetMapId() || m_curr->second.teleport)
-        {
-            TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
-        }
-        else
+        if (teleport || m_curr->second.mapid != GetMapId())
         {
-            Relocate(m_curr->second.x, m_curr->second.y, m_curr->second.z, GetAngle(m_next->second.x, m_next->second.y) + float(M_PI));
-            UpdateNPCPositions(); // COME BACK MARKER
-            // This forces the server to update positions in transportation for players -- gunship
-            UpdatePlayerPositions();
+            m_teleportPending = true;
+            sMapMgr->ScheduleTransportTeleport(this);
+            return;
         }
 
-        sScriptMgr->OnRelocate(this, m_curr->first, m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
+        Relocate(m_curr->second.x, m_curr->second.y, m_curr->second.z, GetAngle(m_next->second.x, m_next->second.y) + float(M_PI));
+        UpdateNPCPositions(); // COME BACK MARKER
+        // This forces the server to update positions in transportation for players -- gunship
+        UpdatePlayerPositions();
 
-        m_nextNodeTime = m_curr->first;
-
-        if (m_curr == m_WayPoints.begin())
-            sLog->outDebug(LOG_FILTER_TRANSPORTS, " ************ BEGIN ************** %s", m_name.c_str());
-
-        sLog->outDebug(LOG_FILTER_TRANSPORTS, "%s moved to %d %f %f %f %d", m_name.c_str(), m_curr->second.id, m_curr->second.x, m_curr->second.y, m_curr->second.z, m_curr->second.mapid);
+        NodeReached();
     }
 
     sScriptMgr->OnTransportUpdate(this, p_diff);
 }
 
+void Transport::FinishTeleport()
+{
+    m_teleportPending = false;
+    TeleportTransport(m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
+    NodeReached();
+}
+
+void Transport::NodeReached()
+{
+    sScriptMgr->OnRelocate(this, m_curr->first, m_curr->second.mapid, m_curr->second.x, m_curr->second.y, m_curr->second.z);
+
+    m_nextNodeTime = m_curr->first;
+
+    if (m_curr == m_WayPoints.begin())
+        sLog->outDebug(LOG_FILTER_TRANSPORTS, " ************ BEGIN ************** %s", m_name.c_str());
+
+    sLog->outDebug(LOG_FILTER_TRANSPORTS, "%s moved to %d %f %f %f %d", m_name.c_str(), m_curr->second.id, m_curr->second.x, m_curr->second.y, m_curr->second.z, m_curr->second.mapid);
+}
+
 void Transport::UpdateForMap(Map const* targetMap)
 {
     Map::PlayerList const& player = targetMap->GetPlayers();
@@ -35,6 +35,11 @@ class Transport : public GameObject, public TransportBase
         bool Create(uint32 guidlow, uint32 entry, uint32 mapid, float x, float y, float z, float ang, uint32 animprogress, uint32 dynflags);
         bool GenerateWaypoints(uint32 pathid, std::set<uint32> &mapids);
         void Update(uint32 p_time);
+        void FinishTeleport();
+        bool IsTeleportPending() const { return m_teleportPending; }
+
+        void SetMap(Map* map);
+        void ResetMap();
         bool AddPassenger(Player* passenger);
         bool RemovePassenger(Player* passenger);
 
@@ -114,6 +119,7 @@ class Transport : public GameObject, public TransportBase
         uint32 m_period;
         uint32 ScriptId;
         bool shouldBeStopped;
+        bool m_teleportPending;
     public:
         WayPointMap m_WayPoints;
         uint32 m_nextNodeTime;
@@ -122,7 +128,9 @@ class Transport : public GameObject, public TransportBase
         void TeleportTransport(uint32 newMapid, float x, float y, float z);
         void UpdateForMap(Map const* map);
         void DoEventIfAny(WayPointMap::value_type const& node, bool departure);
+        void NodeReached();
         WayPointMap::const_iterator GetNextWayPoint();
+        WayPointMap::const_iterator GetWayPointAt(uint32 pathTime) const;
 };
 #endif
 
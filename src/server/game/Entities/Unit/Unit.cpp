@@ -213,8 +213,6 @@ Unit::Unit(bool isWorldObject): WorldObject(isWorldObject)
     for (uint8 i = 0; i < MAX_GAMEOBJECT_SLOT; ++i)
         m_ObjectSlot[i] = 0;
 
-    m_auraUpdateIterator = m_ownedAuras.end();
-
     m_interruptMask = 0;
     m_transform = 0;
     m_canModifyStats = false;
@@ -3287,31 +3285,17 @@ void Unit::_UpdateSpells(uint32 time)
         }
     }
 
-    // m_auraUpdateIterator can be updated in indirect called code at aura remove to skip next planned to update but removed auras
-    for (m_auraUpdateIterator = m_ownedAuras.begin(); m_auraUpdateIterator != m_ownedAuras.end();)
-    {
-        AuraPtr i_aura = m_auraUpdateIterator->second;
-        ++m_auraUpdateIterator;                            // need shift to next for allow update if need into aura update
-        i_aura->UpdateOwner(time, this);
-    }
-
-    // remove expired auras - do that after updates(used in scripts?)
-    for (AuraMap::iterator i = m_ownedAuras.begin(); i != m_ownedAuras.end();)
-    {
-        if (i->second->IsExpired())
-            RemoveOwnedAura(i, AURA_REMOVE_BY_EXPIRE);
-        else
-            ++i;
-    }
+    // only the auras that have something to do are updated, see AuraUpdateQueue
+    m_auraUpdateQueue.Update(this, time);
 
-    for (VisibleAuraMap::iterator itr = m_visibleAuras.begin(); itr != m_visibleAuras.end(); ++itr)
+    // a slot may be queued more than once or already sent, the flag tells
+    for (uint32 i = 0; i < m_visibleAuraUpdates.size(); ++i)
     {
-        if (!itr->second)
-            continue;
-
-        if (itr->second->IsNeedClientUpdate())
-            itr->second->ClientUpdate();
+        AuraApplication* aurApp = GetVisibleAura(m_visibleAuraUpdates[i]);
+        if (aurApp && aurApp->IsNeedClientUpdate())
+            aurApp->ClientUpdate();
     }
+    m_visibleAuraUpdates.clear();
 
     _DeleteRemovedAuras();
 
@@ -3713,6 +3697,7 @@ void Unit::_AddAura(UnitAuraPtr aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
     m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
+    m_auraUpdateQueue.Add(aura.get());
 
     _RemoveNoStackAurasDueToAura(aura);
 
@@ -3766,6 +3751,9 @@ AuraApplication * Unit::_CreateAuraApplication(AuraPtr aura, uint32 effMask)
     AuraApplication * aurApp = new AuraApplication(this, caster, AuraPtr(aura), effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
 
+    if (GetAuraProcHook(aurId))
+        ++m_auraProcHooks[aurId];
+
     if (aurSpellInfo->AuraInterruptFlags)
     {
         m_interruptableAuras.push_back(aurApp);
@@ -3863,6 +3851,10 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator &i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    AuraProcHookMap::iterator procHook = m_auraProcHooks.find(aura->GetId());
+    if (procHook != m_auraProcHooks.end() && --procHook->second == 0)
+        m_auraProcHooks.erase(procHook);
+
     if (aura->GetSpellInfo()->AuraInterruptFlags)
     {
         m_interruptableAuras.remove(aurApp);
@@ -3995,9 +3987,8 @@ void Unit::RemoveOwnedAura(AuraMap::iterator &i, AuraRemoveMode removeMode)
     AuraPtr aura = i->second;
     ASSERT(!aura->IsRemoved());
 
-    // if unit currently update aura list then make safe update iterator shift to next
-    if (m_auraUpdateIterator == i)
-        ++m_auraUpdateIterator;
+    // if unit currently update aura list the queue leaves a hole for it
+    m_auraUpdateQueue.Remove(aura.get());
 
     m_ownedAuras.erase(i);
     m_removedAuras.push_back(aura);
@@ -17547,6 +17538,152 @@ uint32 createProcExtendMask(SpellNonMeleeDamage* damageInfo, SpellMissInfo missC
     return procEx;
 }
 
+Unit::AuraProcHook Unit::GetAuraProcHook(uint32 spellId)
+{
+    switch (spellId)
+    {
+        case 17007:  return &Unit::HandleLeaderOfThePackProcHook;
+        case 51124:  return &Unit::HandleKillingMachineProcHook;
+        case 53257:  return &Unit::HandleCobraStrikesProcHook;
+        case 78203:  return &Unit::HandleShadowyApparitionsProcHook;
+        case 84654:  return &Unit::HandleBanditsGuileProcHook;
+        case 108839: return &Unit::HandleIceFloesProcHook;
+        case 121152: return &Unit::HandleBlindsightProcHook;
+        default:
+            break;
+    }
+
+    return NULL;
+}
+
+void Unit::CallAuraProcHooks(AuraProcHookInfo const& info)
+{
+    // hooks may remove auras, walk a copy and skip the ones that are gone meanwhile
+    std::vector<uint32> spellIds;
+    spellIds.reserve(m_auraProcHooks.size());
+    for (AuraProcHookMap::const_iterator itr = m_auraProcHooks.begin(); itr != m_auraProcHooks.end(); ++itr)
+        spellIds.push_back(itr->first);
+
+    for (std::vector<uint32>::const_iterator itr = spellIds.begin(); itr != spellIds.end(); ++itr)
+        if (m_auraProcHooks.find(*itr) != m_auraProcHooks.end())
+            (this->*GetAuraProcHook(*itr))(info);
+}
+
+// Leader of the Pack - 17007
+void Unit::HandleLeaderOfThePackProcHook(AuraProcHookInfo const& info)
+{
+    if (info.target && GetTypeId() == TYPEID_PLAYER && (info.procExtra & PROC_EX_CRITICAL_HIT) && (info.attType == BASE_ATTACK || (info.procSpell && info.procSpell->GetSchoolMask() == SPELL_SCHOOL_MASK_NORMAL)))
+    {
+        if (!ToPlayer()->HasSpellCooldown(34299))
+        {
+            CastSpell(this, 34299, true); // Heal
+            EnergizeBySpell(this, 68285, CountPctFromMaxMana(8), POWER_MANA);
+            ToPlayer()->AddSpellCooldown(34299, 0, time(NULL) + 6); // 6s ICD
+        }
+    }
+}
+
+// Bandit's Guile - 84654
+// Your Sinister Strike and Revealing Strike abilities increase your damage dealt by up to 30%
+void Unit::HandleBanditsGuileProcHook(AuraProcHookInfo const& info)
+{
+    if (GetTypeId() != TYPEID_PLAYER || !info.procSpell || (info.procSpell->Id != 84617 && info.procSpell->Id != 1752))
+        return;
+
+    insightCount++;
+
+    // it takes a total of 4 strikes to get a proc, or a level up
+    if (insightCount >= 4)
+    {
+        insightCount = 0;
+
+        // it takes 4 strikes to get Shallow insight
+        // than 4 strikes to get Moderate insight
+        // and than 4 strikes to get Deep Insight
+
+        // Shallow Insight
+        if (HasAura(84745))
+        {
+            RemoveAura(84745);
+            CastSpell(this, 84746, true); // Moderate Insight
+        }
+        else if (HasAura(84746))
+        {
+            RemoveAura(84746);
+            CastSpell(this, 84747, true); // Deep Insight
+        }
+        // the cycle will begin
+        else if (!HasAura(84747))
+            CastSpell(this, 84745, true); // Shallow Insight
+    }
+    else
+    {
+        // Each strike refreshes the duration of shallow insight or Moderate insight
+        // but you can't refresh Deep Insight without starting from shallow insight.
+        // Shallow Insight
+        if (AuraPtr shallowInsight = GetAura(84745))
+            shallowInsight->RefreshDuration();
+        // Moderate Insight
+        else if (AuraPtr moderateInsight = GetAura(84746))
+            moderateInsight->RefreshDuration();
+    }
+}
+
+// Hack Fix Ice Floes - Drop charges
+void Unit::HandleIceFloesProcHook(AuraProcHookInfo const& info)
+{
+    SpellInfo const* procSpell = info.procSpell;
+    if (GetTypeId() == TYPEID_PLAYER && procSpell && procSpell->Id != 108839 &&
+        ((procSpell->CastTimeEntry && procSpell->CastTimeEntry->CastTime > 0 && procSpell->CastTimeEntry->CastTime < 4000)
+        || (procSpell->DurationEntry && procSpell->DurationEntry->Duration[0] > 0 && procSpell->DurationEntry->Duration[0] < 4000 && procSpell->AttributesEx & SPELL_ATTR1_CHANNELED_2)))
+        if (AuraApplication* aura = GetAuraApplication(108839, GetGUID()))
+            aura->GetBase()->DropCharge();
+}
+
+// Hack Fix Cobra Strikes - Drop charge
+void Unit::HandleCobraStrikesProcHook(AuraProcHookInfo const& info)
+{
+    if (GetTypeId() == TYPEID_UNIT && info.damage > 0)
+    {
+        if (AuraPtr aura = GetAura(53257))
+        {
+            aura->DropCharge();
+            if (GetOwner())
+                if (AuraPtr cobra = GetOwner()->GetAura(53257))
+                    cobra->DropCharge();
+        }
+    }
+}
+
+// Fix Drop charge for Killing Machine
+void Unit::HandleKillingMachineProcHook(AuraProcHookInfo const& info)
+{
+    if (GetTypeId() == TYPEID_PLAYER && getClass() == CLASS_DEATH_KNIGHT && info.procSpell)
+    {
+        if (haveOffhandWeapon())
+        {
+            if (info.procSpell->Id == 66198 || info.procSpell->Id == 66196)
+                RemoveAura(51124);
+        }
+        else if (info.procSpell->Id == 49020 || info.procSpell->Id == 49143)
+            RemoveAura(51124);
+    }
+}
+
+// Fix Drop charge for Blindsight
+void Unit::HandleBlindsightProcHook(AuraProcHookInfo const& info)
+{
+    if (GetTypeId() == TYPEID_PLAYER && getClass() == CLASS_ROGUE && info.procSpell && info.procSpell->Id == 111240)
+        RemoveAura(121153);
+}
+
+// Cast Shadowy Apparitions when Shadow Word : Pain is crit
+void Unit::HandleShadowyApparitionsProcHook(AuraProcHookInfo const& info)
+{
+    if (GetTypeId() == TYPEID_PLAYER && info.procSpell && info.procSpell->Id == 589 && info.procExtra & PROC_EX_CRITICAL_HIT)
+        CastSpell(info.target, 147193, true);
+}
+
 void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpell, uint32 damage, uint32 absorb, SpellInfo const* procAura)
 {
     // Player is loaded now - do not allow passive spell casts to proc
@@ -17606,16 +17743,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
     }
 
-    // Leader of the Pack
-    if (target && GetTypeId() == TYPEID_PLAYER && (procExtra & PROC_EX_CRITICAL_HIT) && HasAura(17007) && (attType == BASE_ATTACK || (procSpell && procSpell->GetSchoolMask() == SPELL_SCHOOL_MASK_NORMAL)))
-    {
-        if (!ToPlayer()->HasSpellCooldown(34299))
-        {
-            CastSpell(this, 34299, true); // Heal
-            EnergizeBySpell(this, 68285, CountPctFromMaxMana(8), POWER_MANA);
-            ToPlayer()->AddSpellCooldown(34299, 0, time(NULL) + 6); // 6s ICD
-        }
-    }
+    // Hacks bound to an aura of this unit (Leader of the Pack, Bandit's Guile, Ice Floes...)
+    if (!m_auraProcHooks.empty())
+        CallAuraProcHooks(AuraProcHookInfo(isVictim, target, procExtra, attType, procSpell, damage));
 
     // Dematerialize
     if (target && target->GetTypeId() == TYPEID_PLAYER && procSpell && (procSpell->GetAllEffectsMechanicMask() & (1 << MECHANIC_STUN)) && target->HasAura(122464))
@@ -17632,68 +17762,6 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         if (roll_chance_i(20))
             ToPlayer()->AddComboPoints(target, 1);
 
-    // Bandit's Guile - 84654
-    // Your Sinister Strike and Revealing Strike abilities increase your damage dealt by up to 30%
-    if (GetTypeId() == TYPEID_PLAYER && procSpell && (procSpell->Id == 84617 || procSpell->Id == 1752) && HasAura(84654))
-    {
-        insightCount++;
-
-        // it takes a total of 4 strikes to get a proc, or a level up
-        if (insightCount >= 4)
-        {
-            insightCount = 0;
-
-            // it takes 4 strikes to get Shallow insight
-            // than 4 strikes to get Moderate insight
-            // and than 4 strikes to get Deep Insight
-
-            // Shallow Insight
-            if (HasAura(84745))
-            {
-                RemoveAura(84745);
-                CastSpell(this, 84746, true); // Moderate Insight
-            }
-            else if (HasAura(84746))
-            {
-                RemoveAura(84746);
-                CastSpell(this, 84747, true); // Deep Insight
-            }
-            // the cycle will begin
-            else if (!HasAura(84747))
-                CastSpell(this, 84745, true); // Shallow Insight
-        }
-        else
-        {
-            // Each strike refreshes the duration of shallow insight or Moderate insight
-            // but you can't refresh Deep Insight without starting from shallow insight.
-            // Shallow Insight
-            if (AuraPtr shallowInsight = GetAura(84745))
-                shallowInsight->RefreshDuration();
-            // Moderate Insight
-            else if (AuraPtr moderateInsight = GetAura(84746))
-                moderateInsight->RefreshDuration();
-        }
-    }
-
-    // Hack Fix Ice Floes - Drop charges
-    if (GetTypeId() == TYPEID_PLAYER && procSpell && procSpell->Id != 108839 && HasAura(108839) &&
-        ((procSpell->CastTimeEntry && procSpell->CastTimeEntry->CastTime > 0 && procSpell->CastTimeEntry->CastTime < 4000)
-        || (procSpell->DurationEntry && procSpell->DurationEntry->Duration[0] > 0 && procSpell->DurationEntry->Duration[0] < 4000 && procSpell->AttributesEx & SPELL_ATTR1_CHANNELED_2)))
-        if (AuraApplication* aura = GetAuraApplication(108839, GetGUID()))
-            aura->GetBase()->DropCharge();
-
-    // Hack Fix Cobra Strikes - Drop charge
-    if (GetTypeId() == TYPEID_UNIT && damage > 0 && HasAura(53257))
-    {
-        if (AuraPtr aura = GetAura(53257))
-        {
-            aura->DropCharge();
-            if (GetOwner())
-                if (AuraPtr cobra = GetOwner()->GetAura(53257))
-                    cobra->DropCharge();
-        }
-    }
-
     // Hack Fix Frenzy
     if (GetTypeId() == TYPEID_UNIT && isHunterPet() && GetOwner() && GetOwner()->ToPlayer() && ToPet()->IsPermanentPetFor(GetOwner()->ToPlayer()) && !procSpell && GetOwner()->HasAura(19623))
         if (roll_chance_i(40))
@@ -17704,22 +17772,6 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         if (roll_chance_i(15))
             GetOwner()->EnergizeBySpell(GetOwner(), 53253, 20, POWER_FOCUS);
 
-    // Fix Drop charge for Killing Machine
-    if (GetTypeId() == TYPEID_PLAYER && getClass() == CLASS_DEATH_KNIGHT && procSpell && HasAura(51124))
-    {
-        if (haveOffhandWeapon())
-        {
-            if (procSpell->Id == 66198 || procSpell->Id == 66196)
-                RemoveAura(51124);
-        }
-        else if (procSpell->Id == 49020 || procSpell->Id == 49143)
-            RemoveAura(51124);
-    }
-
-    // Fix Drop charge for Blindsight
-    if (GetTypeId() == TYPEID_PLAYER && getClass() == CLASS_ROGUE && procSpell && procSpell->Id == 111240 && HasAura(121152))
-        RemoveAura(121153);
-
     // Fix Drop charge for Fingers of Frost
     if (GetTypeId() == TYPEID_PLAYER && getClass() == CLASS_MAGE && procSpell && (procSpell->Id == 30455 || procSpell->Id == 44572))
     {
@@ -17734,10 +17786,6 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         if (roll_chance_i(50))
             SetPower(POWER_BURNING_EMBERS, GetPower(POWER_BURNING_EMBERS) + 1);
 
-    // Cast Shadowy Apparitions when Shadow Word : Pain is crit
-    if (GetTypeId() == TYPEID_PLAYER && procSpell && procSpell->Id == 589 && HasAura(78203) && procExtra & PROC_EX_CRITICAL_HIT)
-        CastSpell(target, 147193, true);
-
     Unit* actor = isVictim ? target : this;
     Unit* actionTarget = !isVictim ? target : this;
 
@@ -20305,15 +20353,12 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
             // modify threat lists for new phasemask
             if (GetTypeId() != TYPEID_PLAYER)
             {
-                std::list<HostileReference*> threatList = getThreatManager().getThreatList();
-                std::list<HostileReference*> offlineThreatList = getThreatManager().getOfflineThreatList();
-
-                // merge expects sorted lists
-                threatList.sort();
-                offlineThreatList.sort();
-                threatList.merge(offlineThreatList);
+                // copied, the references move between both lists while they are updated
+                ThreatContainer::StorageType threatList = getThreatManager().getThreatList();
+                ThreatContainer::StorageType const& offlineThreatList = getThreatManager().getOfflineThreatList();
+                threatList.insert(threatList.end(), offlineThreatList.begin(), offlineThreatList.end());
 
-                for (std::list<HostileReference*>::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
+                for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
                     if (Unit* unit = (*itr)->getTarget())
                         unit->getHostileRefManager().setOnlineOfflineState(ToCreature(), unit->InSamePhase(newPhaseMask));
             }
@@ -21889,8 +21934,8 @@ void Unit::SendThreatListUpdate()
 
         data.WriteBits(count, 21);
 
-        std::list<HostileReference*>& tlist = getThreatManager().getThreatList();
-        for (std::list<HostileReference*>::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
+        ThreatContainer::StorageType& tlist = getThreatManager().getThreatList();
+        for (ThreatContainer::StorageType::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
         {
             ObjectGuid unitGuid = (*itr)->getUnitGuid();
 
@@ -21902,7 +21947,7 @@ void Unit::SendThreatListUpdate()
         uint8 bitsOrder[8] = { 7, 2, 4, 5, 0, 6, 1, 3 };
         data.WriteBitInOrder(thisGuid, bitsOrder);
 
-        for (std::list<HostileReference*>::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
+        for (ThreatContainer::StorageType::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
         {
             ObjectGuid unitGuid = (*itr)->getUnitGuid();
 
@@ -21949,8 +21994,8 @@ void Unit::SendChangeCurrentVictimOpcode(HostileReference* pHostileReference)
         data.WriteBit(thisGuid[2]);
         data.WriteBit(thisGuid[1]);
 
-        std::list<HostileReference*>& tlist = getThreatManager().getThreatList();
-        for (std::list<HostileReference*>::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
+        ThreatContainer::StorageType& tlist = getThreatManager().getThreatList();
+        for (ThreatContainer::StorageType::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
         {
             ObjectGuid iterGuid = (*itr)->getUnitGuid();
 
@@ -21966,7 +22011,7 @@ void Unit::SendChangeCurrentVictimOpcode(HostileReference* pHostileReference)
 
         data.WriteByteSeq(hostileGuid[7]);
 
-        for (std::list<HostileReference*>::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
+        for (ThreatContainer::StorageType::const_iterator itr = tlist.begin(); itr != tlist.end(); ++itr)
         {
             ObjectGuid iterGuid = (*itr)->getUnitGuid();
 
@@ -22746,445 +22791,41 @@ uint32 Unit::GetDamageTakenInPastSecs(uint32 secs)
 
 void Unit::ReadMovementInfo(WorldPacket& data, MovementInfo* mi, ExtraMovementStatusElement* extras)
 {
-    bool hasTransportData = false;
-    bool hasSpline = false;
-
-    uint32 bitcounterLoop = 0;
-
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(data.GetOpcode());
-    if (sequence == NULL)
+    MovementStatusCodec const* codec = GetMovementStatusCodec(data.GetOpcode());
+    if (codec == NULL)
     {
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSession::ReadMovementInfo: No movement sequence found for opcode 0x%04X", uint32(data.GetOpcode()));
         return;
     }
 
-    ObjectGuid guid;
-    ObjectGuid tguid;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-        if (element == MSEEnd)
-            break;
-
-        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
-        {
-            guid[element - MSEHasGuidByte0] = data.ReadBit();
-            continue;
-        }
-
-        if (element >= MSEHasTransportGuidByte0 &&
-            element <= MSEHasTransportGuidByte7)
-        {
-            if (hasTransportData)
-                tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
-            continue;
-        }
-
-        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
-        {
-            data.ReadByteSeq(guid[element - MSEGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSETransportGuidByte0 &&
-            element <= MSETransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.ReadByteSeq(tguid[element - MSETransportGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEGenericDword0 &&
-            element <= MSEGenericDword7)
-        {
-            data.read_skip<uint32>();
-            continue;
-        }
-
-        switch (element)
-        {
-            case MSEExtraElement:
-                extras->ReadNextElement(data);
-                break;
-            case MSEGeneric2bits0:
-                data.ReadBits(2);
-                break;
-            case MSEUnkUIntCount:
-                bitcounterLoop = data.ReadBits(22);
-                break;
-            case MSEUnkUIntLoop:
-                data.read_skip(bitcounterLoop * sizeof(uint32));
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEHasMovementFlags:
-                mi->flags = !data.ReadBit();
-                break;
-            case MSEHasMovementFlags2:
-                mi->flags2 = !data.ReadBit();
-                break;
-            case MSEHasTimestamp:
-                mi->time = !data.ReadBit();
-                break;
-            case MSEHasOrientation:
-                mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
-                break;
-            case MSEHasTransportData:
-                hasTransportData = data.ReadBit();
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    mi->has_t_time2 = data.ReadBit();
-                break;
-            case MSEHasTransportTime3:
-                if (hasTransportData)
-                    mi->has_t_time3 = data.ReadBit();
-                break;
-            case MSEHasPitch:
-                mi->HavePitch = !data.ReadBit();
-                break;
-            case MSEHasFallData:
-                mi->hasFallData = data.ReadBit();
-                break;
-            case MSEHasFallDirection:
-                if (mi->hasFallData)
-                    mi->hasFallDirection = data.ReadBit();
-                break;
-            case MSEHasSplineElevation:
-                mi->HaveSplineElevation = !data.ReadBit();
-                break;
-            case MSEHasSpline:
-                hasSpline = data.ReadBit();
-                break;
-            case MSEMovementFlags:
-                if (mi->flags)
-                    mi->flags = data.ReadBits(30);
-                break;
-            case MSEMovementFlags2:
-                if (mi->flags2)
-                    mi->flags2 = data.ReadBits(13);
-                break;
-            case MSETimestamp:
-                if (mi->time)
-                    data >> mi->time;
-                break;
-            case MSEPositionX:
-                data >> mi->pos.m_positionX;
-                break;
-            case MSEPositionY:
-                data >> mi->pos.m_positionY;
-                break;
-            case MSEPositionZ:
-                data >> mi->pos.m_positionZ;
-                break;
-            case MSEOrientation:
-                if (mi->pos.m_orientation != 0.0f)
-                    mi->pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionX;
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionY;
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data >> mi->t_pos.m_positionZ;
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    mi->t_pos.SetOrientation(data.read<float>());
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data >> mi->t_seat;
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data >> mi->t_time;
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && mi->has_t_time2)
-                    data >> mi->t_time2;
-                break;
-            case MSETransportTime3:
-                if (hasTransportData && mi->has_t_time3)
-                    data >> mi->t_time3;
-                break;
-            case MSEPitch:
-                if (mi->HavePitch)
-                    data >> mi->pitch;
-                break;
-            case MSEFallTime:
-                if (mi->hasFallData)
-                    data >> mi->fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (mi->hasFallData)
-                    data >> mi->j_zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data >> mi->j_xyspeed;
-                break;
-            case MSESplineElevation:
-                if (mi->HaveSplineElevation)
-                    data >> mi->splineElevation;
-                break;
-            case MSEZeroBit:
-            case MSEOneBit:
-                data.ReadBit();
-                break;
-            case MSEHasUnkTime:
-                mi->Alive32 = !data.ReadBit();
-                break;
-            case MSEUnkTime:
-                if (mi->Alive32)
-                    data >> mi->Alive32;
-                break;
-            case MSECounter:
-                data.read_skip<uint32>();
-                break;
-            default:
-                ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
-                break;
-        }
-    }
-
-    mi->guid = guid;
-    mi->t_guid = tguid;
+    bool hasTransportData = codec->Read(data, mi, extras);
 
     if (hasTransportData && mi->pos.m_positionX != mi->t_pos.m_positionX)
        if (GetTransport())
            GetTransport()->UpdatePosition(mi);
 }
 
+void Unit::SendMovementMessageToSet(WorldPacket* data, Player const* skipped_rcvr, bool stateChange)
+{
+    if (Player* player = ToPlayer())
+        if (skipped_rcvr != player)
+            player->GetSession()->SendPacket(data);
+
+    MovementRelay relay(m_movementRelay, stateChange, GetVisibilityRange(), getMSTime());
+    WoWSource::MessageDistDeliverer notifier(this, data, GetVisibilityRange(), false, skipped_rcvr, &relay);
+    VisitNearbyWorldObject(GetVisibilityRange(), notifier);
+}
+
 void Unit::WriteMovementInfo(WorldPacket &data, ExtraMovementStatusElement* extras) const
 {
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(data.GetOpcode());
-    if (!sequence)
+    MovementStatusCodec const* codec = GetMovementStatusCodec(data.GetOpcode());
+    if (!codec)
     {
         //sLog->outError(LOG_FILTER_NETWORKIO, "WorldSession::WriteMovementInfo: No movement sequence found for opcode 0x%04X", uint32(data.GetOpcode()));
         return;
     }
 
-    MovementInfo const* mi = &m_movementInfo;
-
-    bool hasMovementFlags = mi->GetMovementFlags() != 0;
-    bool hasMovementFlags2 = mi->GetExtraMovementFlags() != 0;
-    bool hasTransportData = mi->t_guid != 0LL;
-
-    ObjectGuid guid = mi->guid;
-    ObjectGuid tguid = mi->t_guid;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-        if (element == MSEEnd)
-            break;
-
-        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
-        {
-            data.WriteBit(guid[element - MSEHasGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEHasTransportGuidByte0 &&
-            element <= MSEHasTransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
-        {
-            data.WriteByteSeq(guid[element - MSEGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSETransportGuidByte0 &&
-            element <= MSETransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
-            continue;
-        }
-
-        switch (element)
-        {
-            case MSEExtraElement:
-                extras->WriteNextElement(data);
-                break;
-            case MSEUnkUIntCount:
-                data.WriteBits(0, 22);
-                break;
-            case MSEUnkUIntLoop:
-                for (uint8 m = 0; m < 0; ++m)
-                {
-                    data << uint32(0);
-                }
-                break;
-            case MSECounter:
-                data << uint32(0); // movement counter
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEHasMovementFlags:
-                data.WriteBit(!hasMovementFlags);
-                break;
-            case MSEHasMovementFlags2:
-                data.WriteBit(!hasMovementFlags2);
-                break;
-            case MSEHasTimestamp:
-                data.WriteBit(!mi->time);
-                break;
-            case MSEHasOrientation:
-                data.WriteBit(!mi->pos.HaveOrientation());
-                break;
-            case MSEHasTransportData:
-                data.WriteBit(hasTransportData);
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    data.WriteBit(mi->has_t_time2);
-                break;
-            case MSEHasTransportTime3:
-                if (hasTransportData)
-                    data.WriteBit(mi->has_t_time3);
-                break;
-            case MSEHasPitch:
-                data.WriteBit(!mi->HavePitch);
-                break;
-            case MSEHasFallData:
-                data.WriteBit(mi->hasFallData);
-                break;
-            case MSEHasFallDirection:
-                if (mi->hasFallData)
-                    data.WriteBit(mi->hasFallDirection);
-                break;
-            case MSEHasSplineElevation:
-                data.WriteBit(!mi->HaveSplineElevation);
-                break;
-            case MSEHasSpline:
-                data.WriteBit(false);
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    data.WriteBits(mi->flags, 30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    data.WriteBits(mi->flags2, 13);
-                break;
-            case MSETimestamp:
-                if (mi->time)
-                    data << mi->time;
-                break;
-            case MSEPositionX:
-                data << mi->pos.m_positionX;
-                break;
-            case MSEPositionY:
-                data << mi->pos.m_positionY;
-                break;
-            case MSEPositionZ:
-                data << mi->pos.m_positionZ;
-                break;
-            case MSEOrientation:
-                if (mi->pos.HaveOrientation())
-                    data << mi->pos.GetOrientation();
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionX;
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionY;
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionZ;
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    data << mi->t_pos.GetOrientation();
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data << mi->t_seat;
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data << mi->t_time;
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && mi->has_t_time2)
-                    data << mi->t_time2;
-                break;
-            case MSETransportTime3:
-                if (hasTransportData && mi->has_t_time3)
-                    data << mi->t_time3;
-                break;
-            case MSEPitch:
-                if (mi->HavePitch)
-                    data << mi->pitch;
-                break;
-            case MSEFallTime:
-                if (mi->hasFallData)
-                    data << mi->fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (mi->hasFallData)
-                    data << mi->j_zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_xyspeed;
-                break;
-            case MSESplineElevation:
-                if (mi->HaveSplineElevation)
-                    data << mi->splineElevation;
-                break;
-            case MSEZeroBit:
-                data.WriteBit(0);
-                break;
-            case MSEOneBit:
-                data.WriteBit(1);
-                break;
-            case MSEHasUnkTime:
-                data.WriteBit(!mi->Alive32);
-                break;
-            case MSEUnkTime:
-                if (mi->Alive32)
-                    data << mi->Alive32;
-                break;
-            default:
-                ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
-                break;
-        }
-    }
+    codec->Write(data, &m_movementInfo, extras);
 }
 
 void Unit::RemoveSoulSwapDOT(Unit* target)
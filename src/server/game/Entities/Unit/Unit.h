@@ -42,6 +42,8 @@
 #include "../DynamicObject/DynamicObject.h"
 #include "../AreaTrigger/AreaTrigger.h"
 #include "MovementStructures.h"
+#include "MovementRelay.h"
+#include "AuraUpdateQueue.h"
 
 #define WORLD_TRIGGER   12999
 
@@ -825,6 +827,20 @@ struct CleanDamage
 
 struct CalcDamageInfo;
 
+// Arguments of Unit::ProcDamageAndSpellFor handed to the aura proc hooks
+struct AuraProcHookInfo
+{
+    AuraProcHookInfo(bool _isVictim, Unit* _target, uint32 _procExtra, WeaponAttackType _attType, SpellInfo const* _procSpell, uint32 _damage) :
+    isVictim(_isVictim), target(_target), procExtra(_procExtra), attType(_attType), procSpell(_procSpell), damage(_damage) {}
+
+    bool isVictim;
+    Unit* target;
+    uint32 procExtra;
+    WeaponAttackType attType;
+    SpellInfo const* procSpell;
+    uint32 damage;
+};
+
 class DamageInfo
 {
 private:
@@ -1244,6 +1260,9 @@ class Unit : public WorldObject
 
         typedef std::map<uint8, AuraApplication*> VisibleAuraMap;
 
+        typedef void (Unit::*AuraProcHook)(AuraProcHookInfo const& info);
+        typedef std::map<uint32, uint32> AuraProcHookMap;  // spell id -> number of applications on the unit
+
         virtual ~Unit();
 
         UnitAI* GetAI() { return i_AI; }
@@ -1477,6 +1496,17 @@ class Unit : public WorldObject
         void ProcDamageAndSpell(Unit* victim, uint32 procAttacker, uint32 procVictim, uint32 procEx, uint32 amount, uint32 absorb = 0, WeaponAttackType attType = BASE_ATTACK, SpellInfo const* procSpell = NULL, SpellInfo const* procAura = NULL);
         void ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpell, uint32 damage, uint32 absorb = 0, SpellInfo const* procAura = NULL);
 
+        // Proc behaviours bound to an aura of the unit itself, only run while the unit has that aura
+        static AuraProcHook GetAuraProcHook(uint32 spellId);
+        void CallAuraProcHooks(AuraProcHookInfo const& info);
+        void HandleLeaderOfThePackProcHook(AuraProcHookInfo const& info);
+        void HandleBanditsGuileProcHook(AuraProcHookInfo const& info);
+        void HandleIceFloesProcHook(AuraProcHookInfo const& info);
+        void HandleCobraStrikesProcHook(AuraProcHookInfo const& info);
+        void HandleKillingMachineProcHook(AuraProcHookInfo const& info);
+        void HandleBlindsightProcHook(AuraProcHookInfo const& info);
+        void HandleShadowyApparitionsProcHook(AuraProcHookInfo const& info);
+
         bool IsNoBreakingCC(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpell, uint32 damage, uint32 absorb, SpellInfo const* procAura, SpellInfo const* spellProto) const;
 
         void GetProcAurasTriggeredOnEvent(std::list<AuraApplication*>& aurasTriggeringProc, std::list<AuraApplication*>* procAuras, ProcEventInfo eventInfo);
@@ -1785,6 +1815,8 @@ class Unit : public WorldObject
         // m_ownedAuras container management
         AuraMap      & GetOwnedAuras()       { return m_ownedAuras; }
         AuraMap const& GetOwnedAuras() const { return m_ownedAuras; }
+        AuraUpdateQueue& GetAuraUpdateQueue() { return m_auraUpdateQueue; }
+        AuraUpdateQueue const& GetAuraUpdateQueue() const { return m_auraUpdateQueue; }
 
         void RemoveOwnedAura(AuraMap::iterator &i, AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT);
         void RemoveOwnedAura(uint32 spellId, uint64 casterGUID = 0, uint32 reqEffMask = 0, AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT);
@@ -2030,6 +2062,7 @@ class Unit : public WorldObject
         }
         void SetVisibleAura(uint8 slot, AuraApplication * aur){ m_visibleAuras[slot]=aur; UpdateAuraForGroup(slot);}
         void RemoveVisibleAura(uint8 slot){ m_visibleAuras.erase(slot); UpdateAuraForGroup(slot);}
+        void AddVisibleAuraUpdate(uint8 slot) { m_visibleAuraUpdates.push_back(slot); }
 
         uint32 GetInterruptMask() const { return m_interruptMask; }
         void AddInterruptMask(uint32 mask) { m_interruptMask |= mask; }
@@ -2173,6 +2206,8 @@ class Unit : public WorldObject
 
         void ReadMovementInfo(WorldPacket& data, MovementInfo* mi, ExtraMovementStatusElement* extras = NULL);
         void WriteMovementInfo(WorldPacket &data, ExtraMovementStatusElement* extras = NULL) const;
+        // sends a movement update to the set, heartbeats (stateChange == false) are thinned out for distant observers
+        void SendMovementMessageToSet(WorldPacket* data, Player const* skipped_rcvr, bool stateChange);
 
         float GetPositionZMinusOffset() const
         {
@@ -2381,13 +2416,14 @@ class Unit : public WorldObject
         AuraMap m_ownedAuras;
         AuraApplicationMap m_appliedAuras;
         AuraList m_removedAuras;
-        AuraMap::iterator m_auraUpdateIterator;
+        AuraUpdateQueue m_auraUpdateQueue;
         uint32 m_removedAurasCount;
 
         AuraEffectList m_modAuras[TOTAL_AURAS];
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
+        AuraProcHookMap m_auraProcHooks;           // applied auras that have a proc hook
         uint32 m_interruptMask;
         AuraIdList _SoulSwapDOTList;
 
@@ -2398,6 +2434,7 @@ class Unit : public WorldObject
         float m_weaponDamage[MAX_ATTACK][2];
         bool m_canModifyStats;
         VisibleAuraMap m_visibleAuras;
+        std::vector<uint8> m_visibleAuraUpdates;   // slots of visible auras waiting for a client update
 
         float m_speed_rate[MAX_MOVE_TYPE];
 
@@ -2476,6 +2513,7 @@ class Unit : public WorldObject
         uint32 m_state;                                     // Even derived shouldn't modify
         uint32 m_CombatTimer;
         TimeTrackerSmall m_movesplineTimer;
+        MovementRelayState m_movementRelay;
 
         uint64 simulacrumTargetGUID;
         uint64 iciclesTargetGUID;
@@ -379,6 +379,15 @@ void ObjectAccessor::RemoveOldCorpses()
     }
 }
 
+void ObjectAccessor::GetExpiredCorpseOwners(time_t now, std::vector<uint64>& owners)
+{
+    TRINITY_READ_GUARD(ACE_RW_Thread_Mutex, i_corpseLock);
+
+    for (Player2CorpsesMapType::const_iterator itr = i_player2corpse.begin(); itr != i_player2corpse.end(); ++itr)
+        if (itr->second->IsExpired(now))
+            owners.push_back(itr->first);
+}
+
 void ObjectAccessor::Update(uint32 /*diff*/)
 {
     UpdateDataMapType update_players;
@@ -249,6 +249,7 @@ class ObjectAccessor
         void AddCorpse(Corpse* corpse);
         void AddCorpsesToGrid(GridCoord const& gridpair, GridType& grid, Map* map);
         Corpse* ConvertCorpseForPlayer(uint64 player_guid, bool insignia = false);
+        void GetExpiredCorpseOwners(time_t now, std::vector<uint64>& owners);
 
         //Thread unsafe
         void Update(uint32 diff);
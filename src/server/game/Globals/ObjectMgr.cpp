@@ -5395,62 +5395,72 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             continue;
         }
 
-        // Delete or return mail
+        // read items from cache
         if (has_items)
-        {
-            // read items from cache
             m->items.swap(itemsCache[m->messageID]);
 
-            // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
-            {
-                // mail open and then not returned
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->setUInt32(0, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
-            }
-            else
+        if (ReturnOrDeleteExpiredMail(m, has_items, basetime))
+            ++returnedCount;
+        else
+            ++deletedCount;
+        delete m;
+    }
+    while (result->NextRow());
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+}
+
+// returns true if the mail went back to its sender, false if it was deleted
+bool ObjectMgr::ReturnOrDeleteExpiredMail(Mail const* m, bool hasItems, uint64 basetime)
+{
+    PreparedStatement* stmt;
+
+    // Delete or return mail
+    if (hasItems)
+    {
+        // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
+        if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+        {
+            // mail open and then not returned
+            for (MailItemInfoVec::const_iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
             {
-                // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt32(0, m->receiver);
-                stmt->setUInt32(1, m->sender);
-                stmt->setUInt32(2, basetime + 30 * DAY);
-                stmt->setUInt32(3, basetime);
-                stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt32(5, m->messageID);
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
+                stmt->setUInt32(0, itr2->item_guid);
                 CharacterDatabase.Execute(stmt);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
-                delete m;
-                ++returnedCount;
-                continue;
             }
         }
+        else
+        {
+            // Mail will be returned
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+            stmt->setUInt32(0, m->receiver);
+            stmt->setUInt32(1, m->sender);
+            stmt->setUInt32(2, basetime + 30 * DAY);
+            stmt->setUInt32(3, basetime);
+            stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
+            stmt->setUInt32(5, m->messageID);
+            CharacterDatabase.Execute(stmt);
+            for (MailItemInfoVec::const_iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+            {
+                // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
+                stmt->setUInt32(0, m->sender);
+                stmt->setUInt32(1, itr2->item_guid);
+                CharacterDatabase.Execute(stmt);
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
-        ++deletedCount;
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
+                stmt->setUInt32(0, m->sender);
+                stmt->setUInt32(1, itr2->item_guid);
+                CharacterDatabase.Execute(stmt);
+            }
+            return true;
+        }
     }
-    while (result->NextRow());
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
+    stmt->setUInt32(0, m->messageID);
+    CharacterDatabase.Execute(stmt);
+    return false;
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
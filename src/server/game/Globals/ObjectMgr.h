@@ -1022,6 +1022,7 @@ class ObjectMgr
         }
 
         void ReturnOrDeleteOldMails(bool serverUp);
+        bool ReturnOrDeleteExpiredMail(Mail const* m, bool hasItems, uint64 basetime);
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
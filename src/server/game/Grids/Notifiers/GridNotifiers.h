@@ -32,6 +32,7 @@
 #include "Unit.h"
 #include "CreatureAI.h"
 #include "Spell.h"
+#include "MovementRelay.h"
 
 class Player;
 //class Map;
@@ -129,10 +130,11 @@ namespace WoWSource
         float i_distSq;
         uint32 team;
         Player const* skipped_receiver;
-        MessageDistDeliverer(WorldObject* src, WorldPacket* msg, float dist, bool own_team_only = false, Player const* skipped = NULL)
+        MovementRelay* i_relay;
+        MessageDistDeliverer(WorldObject* src, WorldPacket* msg, float dist, bool own_team_only = false, Player const* skipped = NULL, MovementRelay* relay = NULL)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , team((own_team_only && src->GetTypeId() == TYPEID_PLAYER) ? ((Player*)src)->GetTeam() : 0)
-            , skipped_receiver(skipped)
+            , skipped_receiver(skipped), i_relay(relay)
         {
         }
         void Visit(PlayerMapType &m);
@@ -149,6 +151,10 @@ namespace WoWSource
             if (!player->HaveAtClient(i_source))
                 return;
 
+            // movement updates may be thinned out for distant observers
+            if (i_relay && !i_relay->ShouldDeliver(player, i_source))
+                return;
+
             if (WorldSession* session = player->GetSession())
                 session->SendPacket(i_message);
         }
@@ -247,15 +253,16 @@ namespace WoWSource
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
-    template<class Check>
+    // Container can be any sequence of WorldObject* with push_back
+    template<class Check, class Container = std::list<WorldObject*> >
     struct WorldObjectListSearcher
     {
         uint32 i_mapTypeMask;
         uint32 i_phaseMask;
-        std::list<WorldObject*> &i_objects;
+        Container &i_objects;
         Check& i_check;
 
-        WorldObjectListSearcher(WorldObject const* searcher, std::list<WorldObject*> &objects, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
+        WorldObjectListSearcher(WorldObject const* searcher, Container &objects, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_objects(objects), i_check(check) {}
 
         void Visit(PlayerMapType &m);
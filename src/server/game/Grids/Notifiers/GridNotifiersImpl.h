@@ -282,8 +282,8 @@ void WoWSource::WorldObjectLastSearcher<Check>::Visit(AreaTriggerMapType  &m)
     }
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(PlayerMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
@@ -293,8 +293,8 @@ void WoWSource::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(CreatureMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(CreatureMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
@@ -304,8 +304,8 @@ void WoWSource::WorldObjectListSearcher<Check>::Visit(CreatureMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(CorpseMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(CorpseMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
         return;
@@ -315,8 +315,8 @@ void WoWSource::WorldObjectListSearcher<Check>::Visit(CorpseMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(GameObjectMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(GameObjectMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
         return;
@@ -326,8 +326,8 @@ void WoWSource::WorldObjectListSearcher<Check>::Visit(GameObjectMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(DynamicObjectMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
         return;
@@ -337,8 +337,8 @@ void WoWSource::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
-template<class Check>
-void WoWSource::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType &m)
+template<class Check, class Container>
+void WoWSource::WorldObjectListSearcher<Check, Container>::Visit(AreaTriggerMapType &m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_AREATRIGGER))
         return;
@@ -60,7 +60,7 @@ Loot* Roll::getLoot()
 Group::Group() : m_leaderGuid(0), m_leaderName(""), m_groupType(GROUPTYPE_NORMAL),
     m_dungeonDifficulty(REGULAR_DIFFICULTY), m_raidDifficulty(MAN10_DIFFICULTY),
     m_bgGroup(NULL), m_bfGroup(NULL), m_lootMethod(FREE_FOR_ALL), m_lootThreshold(ITEM_QUALITY_UNCOMMON), m_looterGuid(0),
-    m_subGroupsCounts(NULL), m_guid(0), m_counter(0), m_maxEnchantingLevel(0), m_dbStoreId(0), m_readyCheckCount(0), m_readyCheck(false), m_membersInInstance(0)
+    m_subGroupsCounts(NULL), m_guid(0), m_counter(0), m_maxEnchantingLevel(0), m_dbStoreId(0), m_readyCheckCount(0), m_readyCheck(false), m_membersInInstance(0), m_memberStatusSequence(0)
 {
     for (uint8 i = 0; i < TARGETICONCOUNT; ++i)
         m_targetIcons[i] = 0;
@@ -495,7 +495,7 @@ bool Group::AddMember(Player* player)
             }
         }
         player->SetGroupUpdateFlag(GROUP_UPDATE_FULL);
-        UpdatePlayerOutOfRange(player);
+        PublishMemberStatus(player);
 
         // quest related GO state dependent from raid membership
         if (isRaidGroup())
@@ -637,6 +637,11 @@ bool Group::RemoveMember(uint64 guid, const RemoveMethod &method /*= GROUP_REMOV
             m_memberSlots.erase(slot);
         }
 
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_memberStatusLock);
+            m_memberStatus.erase(guid);
+        }
+
         // Pick new leader if necessary
         if (m_leaderGuid == guid)
         {
@@ -2258,20 +2263,75 @@ void Group::SendUpdateToPlayer(uint64 playerGUID, MemberSlot* slot)
     player->GetSession()->SendPacket(&data);
 }
 
-void Group::UpdatePlayerOutOfRange(Player* player)
+/**
+ * Replaces the member's status with one built from its current state. Called from
+ * the member's own map thread, it only reads the member itself.
+ *
+ * The status holds the fields changed since the member's previous publish and,
+ * for readers that did not get that one (loading screen, long teleport, joined
+ * or changed group since), a full packet with every field and aura slot.
+ *
+ * The other members pick it up in SendMemberStatusUpdates on their own map
+ * threads, so nothing here touches a player that may be updated elsewhere.
+ */
+void Group::PublishMemberStatus(Player* player)
 {
     if (!player || !player->IsInWorld())
         return;
 
-    WorldPacket data;
-    player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &data, player->GetGroupUpdateFlag(), player->GetGUID());
+    GroupMemberStatusPtr status(new GroupMemberStatus);
+    player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &status->Packet, player->GetGroupUpdateFlag(), player->GetGUID());
+    player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &status->FullPacket, player->GetGroupUpdateFlag() | GROUP_UPDATE_FULL, player->GetGUID(), true);
+    status->MapId = player->GetMapId();
+    status->InstanceId = player->GetInstanceId();
+    status->PositionX = player->GetPositionX();
+    status->PositionY = player->GetPositionY();
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_memberStatusLock);
+    GroupMemberStatusPtr& slot = m_memberStatus[player->GetGUID()];
+    status->PreviousSequence = slot.get() ? slot->Sequence : 0;
+    status->Sequence = ++m_memberStatusSequence;
+    slot = status;
+}
+
+/**
+ * Sends the player the statuses other members published after lastSequence,
+ * unless the member was within sight of the player when it published, and
+ * moves lastSequence past them.
+ *
+ * The changed fields are enough when the player's last update already covered
+ * the member's previous status. Otherwise the player missed a publish (several
+ * since the last update, or the member's first one) and gets the full status.
+ *
+ * The early sequence check still locks the counter's own mutex, it only saves
+ * taking m_memberStatusLock and walking the slots when nothing was published.
+ */
+void Group::SendMemberStatusUpdates(Player* player, uint32& lastSequence)
+{
+    if (m_memberStatusSequence.value() == lastSequence)
+        return;
 
-    Player* member;
-    for (GroupReference* itr = GetFirstMember(); itr != NULL; itr = itr->next())
+    uint32 seenSequence = lastSequence;
+    std::vector<GroupMemberStatusPtr> updates;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_memberStatusLock);
+
+        for (MemberStatusMap::const_iterator itr = m_memberStatus.begin(); itr != m_memberStatus.end(); ++itr)
+            if (itr->second->Sequence > lastSequence && itr->first != player->GetGUID())
+                updates.push_back(itr->second);
+
+        lastSequence = m_memberStatusSequence.value();
+    }
+
+    float sightRange = player->GetSightRange();
+    for (std::vector<GroupMemberStatusPtr>::const_iterator itr = updates.begin(); itr != updates.end(); ++itr)
     {
-        member = itr->getSource();
-        if (member && !member->IsWithinDist(player, member->GetSightRange(), false))
-            member->GetSession()->SendPacket(&data);
+        GroupMemberStatus const* status = itr->get();
+        if (status->MapId == player->GetMapId() && status->InstanceId == player->GetInstanceId() &&
+            player->GetExactDist2dSq(status->PositionX, status->PositionY) < sightRange * sightRange)
+            continue;
+
+        player->GetSession()->SendPacket(!status->PreviousSequence || status->PreviousSequence > seenSequence ? &status->FullPacket : &status->Packet);
     }
 }
 
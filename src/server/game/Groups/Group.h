@@ -41,6 +41,21 @@ class WorldSession;
 
 struct MapEntry;
 
+// A member's latest SMSG_PARTY_MEMBER_STATS and where it was built, never changed once published
+struct GroupMemberStatus
+{
+    WorldPacket Packet;                                 // fields changed since the member's previous status
+    WorldPacket FullPacket;                             // every field, for readers that did not get the previous status
+    uint32 Sequence;
+    uint32 PreviousSequence;                            // sequence of the member's previous status, 0 if none
+    uint32 MapId;
+    uint32 InstanceId;
+    float PositionX;
+    float PositionY;
+};
+
+typedef WoWSource::AutoPtr<GroupMemberStatus, ACE_Thread_Mutex> GroupMemberStatusPtr;
+
 #define MAXGROUPSIZE 5
 #define MAXRAIDSIZE 40
 #define MAX_RAID_SUBGROUPS MAXRAIDSIZE/MAXGROUPSIZE
@@ -352,7 +367,8 @@ class Group
         void SendUpdate();
         void SendUpdateToPlayer(uint64 playerGUID, MemberSlot* slot = NULL);
         static void SendUpdatePlayerAtLeave(uint64 playerGUID, ObjectGuid groupGuid, ObjectGuid looterGuid, uint8 lootMethod, uint8 lootThreshold, uint32 raidDifficulty, uint32 dungeonDifficulty, uint32 counter);
-        void UpdatePlayerOutOfRange(Player* player);
+        void PublishMemberStatus(Player* player);
+        void SendMemberStatusUpdates(Player* player, uint32& lastSequence);
                                                             // ignore: GUID of player that will be ignored
         void BroadcastPacket(WorldPacket* packet, bool ignorePlayersInBGRaid, int group = -1, uint64 ignore = 0);
         void BroadcastAddonMessagePacket(WorldPacket* packet, const std::string& prefix, bool ignorePlayersInBGRaid, int group = -1, uint64 ignore = 0);
@@ -453,5 +469,10 @@ class Group
         uint8               m_membersInInstance;
         bool                m_readyCheck;
         ACE_RW_Thread_Mutex m_invitesLock;
+
+        typedef UNORDERED_MAP<uint64, GroupMemberStatusPtr> MemberStatusMap;
+        MemberStatusMap     m_memberStatus;
+        ACE_Thread_Mutex    m_memberStatusLock;
+        ACE_Atomic_Op<ACE_Thread_Mutex, uint32> m_memberStatusSequence;
 };
 #endif
@@ -560,6 +560,7 @@ void Guild::Member::SetStats(Player* player)
     m_class     = player->getClass();
     m_zoneId    = player->GetZoneId();
     m_accountId = player->GetSession()->GetAccountId();
+    InvalidateRosterData();
 }
 
 void Guild::Member::SetStats(const std::string& name, uint8 level, uint8 _class, uint32 zoneId, uint32 accountId)
@@ -569,6 +570,7 @@ void Guild::Member::SetStats(const std::string& name, uint8 level, uint8 _class,
     m_class     = _class;
     m_zoneId    = zoneId;
     m_accountId = accountId;
+    InvalidateRosterData();
 }
 
 void Guild::Member::SetPublicNote(const std::string& publicNote)
@@ -577,6 +579,7 @@ void Guild::Member::SetPublicNote(const std::string& publicNote)
         return;
 
     m_publicNote = publicNote;
+    InvalidateRosterData();
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_PNOTE);
     stmt->setString(0, publicNote);
@@ -590,6 +593,7 @@ void Guild::Member::SetOfficerNote(const std::string& officerNote)
         return;
 
     m_officerNote = officerNote;
+    InvalidateRosterData();
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_OFFNOTE);
     stmt->setString(0, officerNote);
@@ -600,6 +604,7 @@ void Guild::Member::SetOfficerNote(const std::string& officerNote)
 void Guild::Member::ChangeRank(uint8 newRank)
 {
     m_rankId = newRank;
+    InvalidateRosterData();
 
     // Update rank information in player's field, if he is online.
     if (Player* player = FindPlayer())
@@ -611,6 +616,95 @@ void Guild::Member::ChangeRank(uint8 newRank)
     CharacterDatabase.Execute(stmt);
 }
 
+void Guild::Member::WriteRosterBits(WorldPacket& data) const
+{
+    ObjectGuid guid = m_guid;
+
+    data.WriteBit(0); // Can Scroll of Ressurect
+    data.WriteBits(m_publicNote.length(), 8);
+    data.WriteBit(0); // Has Authenticator
+    data.WriteBit(guid[5]);
+    data.WriteBit(guid[4]);
+    data.WriteBits(m_name.length(), 6);
+    data.WriteBit(guid[6]);
+    data.WriteBit(guid[2]);
+    data.WriteBit(guid[7]);
+    data.WriteBits(m_officerNote.length(), 8);
+    data.WriteBit(guid[1]);
+    data.WriteBit(guid[3]);
+    data.WriteBit(guid[0]);
+}
+
+bool Guild::Member::IsRosterDataCurrent(uint32 now) const
+{
+    if (!m_rosterDataValid)
+        return false;
+
+    return getMSTimeDiff(m_rosterDataTime, now) < uint32(m_rosterDataOnline ? GUILD_ROSTER_ONLINE_REFRESH : GUILD_ROSTER_OFFLINE_REFRESH);
+}
+
+ByteBuffer const& Guild::Member::GetRosterData(uint32 now)
+{
+    if (IsRosterDataCurrent(now))
+        return m_rosterData;
+
+    Player* player = FindPlayer();
+    ObjectGuid guid = m_guid;
+
+    uint8 flags = GUILDMEMBER_STATUS_NONE;
+    if (player)
+    {
+        flags |= GUILDMEMBER_STATUS_ONLINE;
+        if (player->isAFK())
+            flags |= GUILDMEMBER_STATUS_AFK;
+        if (player->isDND())
+            flags |= GUILDMEMBER_STATUS_DND;
+    }
+
+    m_rosterData.clear();
+    m_rosterData << uint32(player ? player->GetReputation(REP_GUILD) : 0);
+    m_rosterData << uint8(m_class);
+    m_rosterData << uint8(m_level);
+    m_rosterData << uint32(sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP));
+    m_rosterData << uint64(0); // Total activity
+    m_rosterData.WriteString(m_publicNote);
+    m_rosterData.WriteByteSeq(guid[1]);
+    m_rosterData << float(player ? 0.0f : float(::time(NULL) - m_logoutTime) / DAY);
+    m_rosterData.WriteByteSeq(guid[2]);
+    m_rosterData.WriteByteSeq(guid[4]);
+    m_rosterData << uint32(player ? player->GetZoneId() : m_zoneId);
+    m_rosterData << uint8(1);
+    m_rosterData << uint32(50528283);
+    m_rosterData.WriteByteSeq(guid[7]);
+    m_rosterData.WriteByteSeq(guid[5]);
+    m_rosterData << uint32(player ? player->GetAchievementMgr().GetAchievementPoints() : 0);
+    m_rosterData.WriteByteSeq(guid[3]);
+    m_rosterData << uint8(flags);
+    m_rosterData.WriteByteSeq(guid[6]);
+    m_rosterData << uint64(0); // Weekly activity
+    m_rosterData.WriteString(m_name);
+    m_rosterData.WriteString(m_officerNote);
+
+    // for (2 professions)
+    for (int i = 0; i < 2; ++i)
+    {
+        uint32 id = player ? player->GetUInt32Value(PLAYER_PROFESSION_SKILL_LINE_1 + i) : 0;
+
+        if (id)
+            m_rosterData << uint32(id) << uint32(player->GetSkillValue(id)) << uint32(player->GetSkillStep(id));
+        else
+            m_rosterData << uint32(0) << uint32(0) << uint32(0);
+    }
+
+    m_rosterData.WriteByteSeq(guid[0]);
+    m_rosterData << uint32(m_rankId);
+
+    m_rosterDataValid = true;
+    m_rosterDataOnline = player != NULL;
+    m_rosterDataTime = now;
+    return m_rosterData;
+}
+
 void Guild::Member::SaveToDB(SQLTransaction& trans) const
 {
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_GUILD_MEMBER);
@@ -1090,7 +1184,8 @@ InventoryResult Guild::BankMoveItemData::CanStore(Item* pItem, bool swap)
 ///////////////////////////////////////////////////////////////////////////////
 // Guild
 Guild::Guild() : m_id(0), m_leaderGuid(0), m_createdDate(0), m_accountsNumber(0), m_bankMoney(0), m_eventLog(NULL),
-    m_achievementMgr(this), _level(1), _experience(0), _todayExperience(0), _newsLog(this)
+    m_achievementMgr(this), _level(1), _experience(0), _todayExperience(0), _newsLog(this), _experienceChanged(false),
+    m_rosterPacketValid(false)
 {
     memset(&m_bankEventLog, 0, (GUILD_BANK_MAX_TABS + 1) * sizeof(LogHolder*));
 }
@@ -1235,7 +1330,20 @@ void Guild::Disband()
 
 void Guild::SaveToDB()
 {
+    if (!NeedsSave())
+        return;
+
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    SaveToDB(trans);
+    CharacterDatabase.CommitTransaction(trans);
+}
+
+void Guild::SaveToDB(SQLTransaction& trans)
+{
+    if (!NeedsSave())
+        return;
+
+    _experienceChanged = false;
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_EXPERIENCE);
     stmt->setUInt32(0, GetLevel());
@@ -1245,8 +1353,6 @@ void Guild::SaveToDB()
     trans->Append(stmt);
 
     m_achievementMgr.SaveToDB(trans);
-
-    CharacterDatabase.CommitTransaction(trans);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1266,102 +1372,88 @@ bool Guild::SetName(std::string const& name)
 
 void Guild::HandleRoster(WorldSession* session /*= NULL*/)
 {
-    WorldPacket data(SMSG_GUILD_ROSTER, 100);
+    if (m_rosterPacketValid)
+        _UpdateRoster();
+    else
+        _BuildRoster();
+
+    if (session)
+        session->SendPacket(&m_rosterPacket);
+    else
+        BroadcastPacket(&m_rosterPacket);
+
+    sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_ROSTER)");
+}
+
+void Guild::_BuildRoster()
+{
+    uint32 now = getMSTime();
+
+    m_rosterPacket.Initialize(SMSG_GUILD_ROSTER, 100);
+    m_rosterEntries.clear();
+    m_rosterEntries.reserve(m_members.size());
     ByteBuffer memberData;
 
-    data << uint32(0);
-    data << uint32(m_accountsNumber);
-    data << uint32(secsToTimeBitFields(m_createdDate));
-    data << uint32(1/*sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP)*/);
+    m_rosterPacket << uint32(0);
+    m_rosterPacket << uint32(m_accountsNumber);
+    m_rosterPacket << uint32(secsToTimeBitFields(m_createdDate));
+    m_rosterPacket << uint32(1/*sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP)*/);
 
-    data.WriteBits(m_motd.length(), 10);
-    data.WriteBits(m_info.length(), 11);
-    data.WriteBits(m_members.size(), 17);
+    m_rosterPacket.WriteBits(m_motd.length(), 10);
+    m_rosterPacket.WriteBits(m_info.length(), 11);
+    m_rosterPacket.WriteBits(m_members.size(), 17);
 
     for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
     {
         Member* member = itr->second;
-        Player* player = member->FindPlayer();
-        size_t pubNoteLength = member->GetPublicNote().length();
-        size_t offNoteLength = member->GetOfficerNote().length();
+        member->WriteRosterBits(m_rosterPacket);
 
-        uint8 flags = GUILDMEMBER_STATUS_NONE;
-        if (player)
-        {
-            flags |= GUILDMEMBER_STATUS_ONLINE;
-            if (player->isAFK())
-                flags |= GUILDMEMBER_STATUS_AFK;
-            if (player->isDND())
-                flags |= GUILDMEMBER_STATUS_DND;
-        }
+        ByteBuffer const& data = member->GetRosterData(now);
+        RosterEntry entry;
+        entry.member = member;
+        entry.offset = memberData.size();
+        entry.size = data.size();
+        entry.layout = member->GetRosterLayout();
+        m_rosterEntries.push_back(entry);
 
-        ObjectGuid guid = member->GetGUID();
-
-        data.WriteBit(0); // Can Scroll of Ressurect
-        data.WriteBits(pubNoteLength, 8);
-        data.WriteBit(0); // Has Authenticator
-        data.WriteBit(guid[5]);
-        data.WriteBit(guid[4]);
-        data.WriteBits(member->GetName().length(), 6);
-        data.WriteBit(guid[6]);
-        data.WriteBit(guid[2]);
-        data.WriteBit(guid[7]);
-        data.WriteBits(offNoteLength, 8);
-        data.WriteBit(guid[1]);
-        data.WriteBit(guid[3]);
-        data.WriteBit(guid[0]);
-
-
-        memberData << uint32(player ? player->GetReputation(REP_GUILD) : 0);
-        memberData << uint8(member->GetClass());
-        memberData << uint8(member->GetLevel());
-        memberData << uint32(sWorld->getIntConfig(CONFIG_GUILD_WEEKLY_REP_CAP));
-        memberData << uint64(0); // Total activity
-        memberData.WriteString(member->GetPublicNote());
-        memberData.WriteByteSeq(guid[1]);
-        memberData << float(player ? 0.0f : float(::time(NULL) - member->GetLogoutTime()) / DAY);
-        memberData.WriteByteSeq(guid[2]);
-        memberData.WriteByteSeq(guid[4]);
-        memberData << uint32(player ? player->GetZoneId() : member->GetZone());
-        memberData << uint8(1);
-        memberData << uint32(50528283);
-        memberData.WriteByteSeq(guid[7]);
-        memberData.WriteByteSeq(guid[5]);
-        memberData << uint32(player ? player->GetAchievementMgr().GetAchievementPoints() : 0);
-        memberData.WriteByteSeq(guid[3]);
-        memberData << uint8(flags);
-        memberData.WriteByteSeq(guid[6]);
-        memberData << uint64(0); // Weekly activity
-        memberData.WriteString(member->GetName());
-        memberData.WriteString(member->GetOfficerNote());
-            
-        // for (2 professions)
-        for (int i = 0; i < 2; ++i)
-        {
-            uint32 id = player ? player->GetUInt32Value(PLAYER_PROFESSION_SKILL_LINE_1 + i) : 0;
-
-            if (id)
-                memberData << uint32(id) << uint32(player->GetSkillValue(id)) << uint32(player->GetSkillStep(id));
-            else
-                memberData << uint32(0) << uint32(0) << uint32(0);
-        }
-        
-        memberData.WriteByteSeq(guid[0]);
-        memberData << uint32(member->GetRankId());
+        memberData.append(data);
     }
 
-    data.FlushBits();
-    data.append(memberData);
+    m_rosterPacket.FlushBits();
 
-    data.WriteString(m_info);
-    data.WriteString(m_motd);
+    // entry offsets were taken relative to the byte part
+    size_t memberDataPos = m_rosterPacket.wpos();
+    for (RosterEntries::iterator itr = m_rosterEntries.begin(); itr != m_rosterEntries.end(); ++itr)
+        itr->offset += memberDataPos;
 
-    if (session)
-        session->SendPacket(&data);
-    else
-        BroadcastPacket(&data);
+    m_rosterPacket.append(memberData);
 
-    sLog->outDebug(LOG_FILTER_GUILD, "WORLD: Sent (SMSG_GUILD_ROSTER)");
+    m_rosterPacket.WriteString(m_info);
+    m_rosterPacket.WriteString(m_motd);
+
+    m_rosterPacketValid = true;
+}
+
+// Only the member entries that changed or expired are looked up again and written over their old bytes.
+// The packet is built again if an entry changed size, as the entries after it and the bit part would move.
+void Guild::_UpdateRoster()
+{
+    uint32 now = getMSTime();
+    for (RosterEntries::const_iterator itr = m_rosterEntries.begin(); itr != m_rosterEntries.end(); ++itr)
+    {
+        Member* member = itr->member;
+        if (member->IsRosterDataCurrent(now))
+            continue;
+
+        ByteBuffer const& data = member->GetRosterData(now);
+        if (data.size() != itr->size || member->GetRosterLayout() != itr->layout)
+        {
+            _BuildRoster();
+            return;
+        }
+
+        m_rosterPacket.put(itr->offset, data.contents(), data.size());
+    }
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1494,6 +1586,7 @@ void Guild::HandleSetMOTD(WorldSession* session, const std::string& motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, motd);
 
@@ -1525,6 +1618,7 @@ void Guild::HandleSetInfo(WorldSession* session, const std::string& info)
     else
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, info);
 
@@ -2351,6 +2445,10 @@ void Guild::SendLoginInfo(WorldSession* session)
           SMSG_GUILD_SEND_PLAYER_LOGIN_STATUS
     */
 
+    // Member is online now, its roster entry has to show it
+    if (Member* member = GetMember(session->GetGuidLow()))
+        member->InvalidateRosterData();
+
     WorldPacket data(SMSG_GUILD_SEND_MOTD, m_motd.size() + 2);
     data.WriteBits(m_motd.size(), 10);
     data.FlushBits();
@@ -2814,6 +2912,7 @@ bool Guild::AddMember(uint64 guid, uint8 rankId)
         }
     }
     m_members[lowguid] = member;
+    _InvalidateRoster();
 
     SQLTransaction trans(NULL);
     member->SaveToDB(trans);
@@ -2889,6 +2988,7 @@ void Guild::DeleteMember(uint64 guid, bool isDisbanding, bool isKicked, bool can
     if (Member* member = GetMember(guid))
         delete member;
     m_members.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -3600,6 +3700,8 @@ void Guild::GiveXP(uint32 xp, Player* source)
     if (!xp)
         return;
 
+    _experienceChanged = true;
+
     uint32 oldLevel = GetLevel();
 
     // Ding, mon!
@@ -3649,6 +3751,7 @@ void Guild::SendGuildXP(WorldSession* session) const
 void Guild::ResetDailyExperience()
 {
     _todayExperience = 0;
+    _experienceChanged = true;
 
     for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
         if (Player* player = itr->second->FindPlayer())
@@ -269,6 +269,8 @@ uint32 const MinNewsItemLevel[MAX_CONTENT] = { 61, 90, 200, 353 };
 typedef std::map<uint32, GuildNewsEntry> GuildNewsLogMap;
 
 #define GUILD_EXPERIENCE_UNCAPPED_LEVEL 20  ///> Hardcoded in client, starting from this level, guild daily experience 
+#define GUILD_ROSTER_ONLINE_REFRESH  (10 * IN_MILLISECONDS)             ///> Max age of an online member's zone, status and professions in the cached roster
+#define GUILD_ROSTER_OFFLINE_REFRESH (10 * MINUTE * IN_MILLISECONDS)    ///> Max age of an offline member's "days offline" in the cached roster
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 // Emblem info
@@ -348,7 +350,10 @@ class Guild
                     m_class(0),
                     m_logoutTime(::time(NULL)),
                     m_accountId(0),
-                    m_rankId(rankId) { }
+                    m_rankId(rankId),
+                    m_rosterDataValid(false),
+                    m_rosterDataOnline(false),
+                    m_rosterDataTime(0) { }
 
                 void SetStats(Player* player);
                 void SetStats(const std::string& name, uint8 level, uint8 _class, uint32 zoneId, uint32 accountId);
@@ -374,7 +379,7 @@ class Guild
 
                 void ChangeRank(uint8 newRank);
 
-                inline void UpdateLogoutTime() { m_logoutTime = ::time(NULL); }
+                inline void UpdateLogoutTime() { m_logoutTime = ::time(NULL); InvalidateRosterData(); }
                 inline bool IsRank(uint8 rankId) const { return m_rankId == rankId; }
                 inline bool IsRankNotLower(uint8 rankId) const { return m_rankId <= rankId; }
                 inline bool IsSamePlayer(uint64 guid) const { return m_guid == guid; }
@@ -389,6 +394,15 @@ class Guild
 
                 uint32 GetRemainingWeeklyReputation() const { return 0; }
 
+                // SMSG_GUILD_ROSTER entry of this member: the bit part is written each time,
+                // the byte part is cached and only rebuilt once changed or too old
+                void WriteRosterBits(WorldPacket& data) const;
+                ByteBuffer const& GetRosterData(uint32 now);
+                bool IsRosterDataCurrent(uint32 now) const;
+                inline void InvalidateRosterData() { m_rosterDataValid = false; }
+                // lengths written by WriteRosterBits, a cached roster entry can only be patched in place while they hold
+                inline uint32 GetRosterLayout() const { return uint32(m_name.length()) | uint32(m_publicNote.length()) << 8 | uint32(m_officerNote.length()) << 16; }
+
             private:
                 uint32 m_guildId;
                 // Fields from characters table
@@ -405,6 +419,11 @@ class Guild
                 std::string m_officerNote;
 
                 RemainingValue m_bankRemaining[GUILD_BANK_MAX_TABS + 1];
+
+                ByteBuffer m_rosterData;
+                bool m_rosterDataValid;
+                bool m_rosterDataOnline;                    // player was online when m_rosterData was built
+                uint32 m_rosterDataTime;
         };
 
         // News Log class
@@ -716,7 +735,9 @@ class Guild
         bool Create(Player* pLeader, const std::string& name);
         void Disband();
 
-        void SaveToDB();
+        void SaveToDB();                                            // writes pending experience and achievement changes
+        void SaveToDB(SQLTransaction& trans);
+        bool NeedsSave() const { return _experienceChanged || m_achievementMgr.HasUnsavedChanges(); }
 
         // Getters
         uint32 GetId() const { return m_id; }
@@ -864,9 +885,27 @@ class Guild
         uint32 _level;
         uint64 _experience;
         uint64 _todayExperience;
+        bool _experienceChanged;
+
+        // Last built SMSG_GUILD_ROSTER, see HandleRoster
+        struct RosterEntry
+        {
+            Member* member;
+            size_t offset;                                  // of the member's byte part in m_rosterPacket
+            size_t size;
+            uint32 layout;                                  // Member::GetRosterLayout() when the bit part was written
+        };
+        typedef std::vector<RosterEntry> RosterEntries;
+
+        WorldPacket m_rosterPacket;
+        RosterEntries m_rosterEntries;
+        bool m_rosterPacketValid;
 
     private:
         inline uint32 _GetRanksSize() const { return uint32(m_ranks.size()); }
+        inline void _InvalidateRoster() { m_rosterPacketValid = false; }
+        void _BuildRoster();
+        void _UpdateRoster();
         inline const RankInfo* GetRankInfo(uint32 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : NULL; }
         inline RankInfo* GetRankInfo(uint32 rankId) { return rankId < _GetRanksSize() ? &m_ranks[rankId] : NULL; }
         inline bool _HasRankRight(Player* player, uint32 right) const { return (_GetRankRights(player->GetRank()) & right) != GR_RIGHT_EMPTY; }
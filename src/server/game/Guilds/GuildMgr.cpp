@@ -41,13 +41,44 @@ void GuildMgr::RemoveGuild(uint32 guildId)
 
 void GuildMgr::SaveGuilds()
 {
+    // Guilds left from the previous pass are still changed and queued again below
+    GuildSaveQueue.clear();
+
     for (GuildContainer::iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        if (itr->second && itr->second->NeedsSave())
+            GuildSaveQueue.push_back(itr->first);
+
+    if (!GuildSaveQueue.empty())
+        sLog->outDebug(LOG_FILTER_GUILD, "GuildMgr: %u guilds queued for saving", uint32(GuildSaveQueue.size()));
+}
+
+void GuildMgr::UpdateSaveQueue()
+{
+    if (GuildSaveQueue.empty())
+        return;
+
+    // One transaction for the batch, committed by the async database worker
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    for (uint32 count = sWorld->getIntConfig(CONFIG_GUILD_SAVE_BATCH_SIZE); count && !GuildSaveQueue.empty(); --count)
     {
-        if (!itr->second)
-            continue;
+        // Guild may have been disbanded since it was queued
+        if (Guild* guild = GetGuildById(GuildSaveQueue.front()))
+            guild->SaveToDB(trans);
 
-        itr->second->SaveToDB();
+        GuildSaveQueue.pop_front();
     }
+
+    if (trans->GetSize())
+        CharacterDatabase.CommitTransaction(trans);
+}
+
+void GuildMgr::SaveAllGuilds()
+{
+    GuildSaveQueue.clear();
+
+    for (GuildContainer::iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        if (itr->second)
+            itr->second->SaveToDB();
 }
 
 uint32 GuildMgr::GenerateGuildId()
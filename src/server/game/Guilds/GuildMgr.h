@@ -43,7 +43,9 @@ public:
     void AddGuild(Guild* guild);
     void RemoveGuild(uint32 guildId);
 
-    void SaveGuilds();
+    void SaveGuilds();                                  // queue every guild with unsaved changes
+    void UpdateSaveQueue();                             // write the next Guild.SaveBatchSize queued guilds
+    void SaveAllGuilds();                               // write every changed guild now, at shutdown
 
     void ResetExperienceCaps();
      void ResetReputationCaps();
@@ -57,6 +59,7 @@ public:
 protected:
     uint32 NextGuildId;
     GuildContainer GuildStore;
+    std::deque<uint32> GuildSaveQueue;
     std::vector<uint64> GuildXPperLevel;
     std::vector<GuildReward> GuildRewards;
 };
@@ -50,11 +50,13 @@ class LoginQueryHolder : public SQLQueryHolder
     private:
         uint32 m_accountId;
         uint64 m_guid;
+        uint32 m_requestTime;
     public:
         LoginQueryHolder(uint32 accountId, uint64 guid)
-            : m_accountId(accountId), m_guid(guid) { }
+            : m_accountId(accountId), m_guid(guid), m_requestTime(getMSTime()) { }
         uint64 GetGuid() const { return m_guid; }
         uint32 GetAccountId() const { return m_accountId; }
+        uint32 GetRequestTime() const { return m_requestTime; }
         bool Initialize();
 };
 
@@ -865,7 +867,8 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder);
+    // the login queries are independent of each other, run them on all async connections at once
+    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder, MAX_PLAYER_LOGIN_QUERY);
     PreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_CHARACTER_SPELL);
     stmt->setUInt32(0, GetAccountId());
     _accountSpellCallback = LoginDatabase.AsyncQuery(stmt);
@@ -1312,6 +1315,17 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder, PreparedQueryResu
     // Fix chat with transfert / rename
     sWorld->AddCharacterNameData(pCurrChar->GetGUIDLow(), pCurrChar->GetName(), pCurrChar->getGender(), pCurrChar->getRace(), pCurrChar->getClass(), pCurrChar->getLevel());
 
+    uint32 stageTimes[MAX_LOGIN_STAGES];
+    stageTimes[LOGIN_STAGE_QUEUE] = getMSTimeDiff(holder->GetQueuedTime(), holder->GetStartTime());
+    stageTimes[LOGIN_STAGE_DATABASE] = getMSTimeDiff(holder->GetStartTime(), holder->GetReadyTime());
+    stageTimes[LOGIN_STAGE_DISPATCH] = getMSTimeDiff(holder->GetReadyTime(), time);
+    stageTimes[LOGIN_STAGE_WORLD] = GetMSTimeDiffToNow(time);
+    stageTimes[LOGIN_STAGE_TOTAL] = GetMSTimeDiffToNow(holder->GetRequestTime());
+    RecordLoginLatency(stageTimes);
+
+    sLog->outDebug(LOG_FILTER_NETWORKIO, "Player %s logged in after %u ms (queue %u ms, database %u ms, dispatch %u ms, world %u ms)", pCurrChar->GetName(),
+        stageTimes[LOGIN_STAGE_TOTAL], stageTimes[LOGIN_STAGE_QUEUE], stageTimes[LOGIN_STAGE_DATABASE], stageTimes[LOGIN_STAGE_DISPATCH], stageTimes[LOGIN_STAGE_WORLD]);
+
     delete holder;
 }
 
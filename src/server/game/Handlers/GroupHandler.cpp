@@ -1269,7 +1269,8 @@ void WorldSession::BuildPartyMemberStatsChangedPacket(Player* player, WorldPacke
 
     if (mask & GROUP_UPDATE_FLAG_AURAS)
     {
-        uint64 auramask = player->GetAuraUpdateMaskForRaid();
+        // a full update sends every slot so the reader also clears the auras it missed going away
+        uint64 auramask = full ? UI64LIT(0xFFFFFFFFFFFFFFFF) : player->GetAuraUpdateMaskForRaid();
 
         dataBuffer << uint8(1);
         dataBuffer << uint64(auramask);
@@ -1388,7 +1389,7 @@ void WorldSession::BuildPartyMemberStatsChangedPacket(Player* player, WorldPacke
     {
         if (pet)
         {
-            uint64 auramask = pet->GetAuraUpdateMaskForRaid();
+            uint64 auramask = full ? UI64LIT(0xFFFFFFFFFFFFFFFF) : pet->GetAuraUpdateMaskForRaid();
             
             dataBuffer << uint8(1);
             dataBuffer << uint64(auramask);
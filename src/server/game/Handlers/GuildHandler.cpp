@@ -443,15 +443,22 @@ void WorldSession::HandleGuildBankerActivate(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 7, 1, 4, 2, 0, 3, 6, 5 };
     recvData.ReadBytesSeq(GoGuid, bytesOrder);
 
+    // the banker is checked on the map thread, the guild is only reachable from the world thread
     if (GetPlayer()->GetGameObjectIfCanInteractWith(GoGuid, GAMEOBJECT_TYPE_GUILD_BANK))
     {
-        if (Guild* guild = _GetPlayerGuild(this))
-            guild->SendBankList(this, 0, true, true);
-        else
-            Guild::SendCommandResult(this, GUILD_BANK, ERR_GUILD_PLAYER_NOT_IN_GUILD);
+        WorldPacket message(CMSG_GUILD_BANKER_ACTIVATE, 0);
+        PostToWorld(GLOBAL_ACCESS_GUILD, &WorldSession::HandleGuildBankerActivateOnWorld, message);
     }
 }
 
+void WorldSession::HandleGuildBankerActivateOnWorld(WorldPacket& /*message*/)
+{
+    if (Guild* guild = _GetPlayerGuild(this))
+        guild->SendBankList(this, 0, true, true);
+    else
+        Guild::SendCommandResult(this, GUILD_BANK, ERR_GUILD_PLAYER_NOT_IN_GUILD);
+}
+
 // Called when opening guild bank tab only (first one)
 void WorldSession::HandleGuildBankQueryTab(WorldPacket& recvData)
 {
@@ -477,11 +484,23 @@ void WorldSession::HandleGuildBankQueryTab(WorldPacket& recvData)
     recvData.ReadBytesSeq(GoGuid, bytesOrder);
 
     if (GetPlayer()->GetGameObjectIfCanInteractWith(GoGuid, GAMEOBJECT_TYPE_GUILD_BANK))
-        if (Guild* guild = _GetPlayerGuild(this))
-        {
-            guild->SendBankList(this, tabId, true, true);
-            guild->SendMoneyInfo(this);
-        }
+    {
+        WorldPacket message(CMSG_GUILD_BANK_QUERY_TAB, 1);
+        message << uint8(tabId);
+        PostToWorld(GLOBAL_ACCESS_GUILD, &WorldSession::HandleGuildBankQueryTabOnWorld, message);
+    }
+}
+
+void WorldSession::HandleGuildBankQueryTabOnWorld(WorldPacket& message)
+{
+    uint8 tabId;
+    message >> tabId;
+
+    if (Guild* guild = _GetPlayerGuild(this))
+    {
+        guild->SendBankList(this, tabId, true, true);
+        guild->SendMoneyInfo(this);
+    }
 }
 
 void WorldSession::HandleGuildBankDepositMoney(WorldPacket& recvData)
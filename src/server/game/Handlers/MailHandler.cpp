@@ -645,6 +645,13 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     if (!GetPlayer()->GetGameObjectIfCanInteractWith(mailBoxGuid, GAMEOBJECT_TYPE_MAILBOX))
         return;
 
+    // other maps' threads deliver mail to online players too, read the mailbox on the world thread
+    WorldPacket message(CMSG_GET_MAIL_LIST, 0);
+    PostToWorld(GLOBAL_ACCESS_MAIL, &WorldSession::HandleGetMailListOnWorld, message);
+}
+
+void WorldSession::HandleGetMailListOnWorld(WorldPacket& /*message*/)
+{
     Player* player = _player;
 
     //load players mails, and mailed items
@@ -775,7 +782,7 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
         {
             ObjectGuid senderGuid = (*itr)->sender;
             uint8 bytesOrder[8] = { 7, 0, 6, 5, 4, 2, 3, 1 };
-            dataBuffer.WriteBytesSeq(senderGuid, bitsOrder);
+            dataBuffer.WriteBytesSeq(senderGuid, bytesOrder);
         }
 
         dataBuffer << uint8((*itr)->messageType);                   // Message Type
@@ -858,6 +858,8 @@ void WorldSession::HandleAddIgnoreOpcodeCallBack(PreparedQueryResult result)
                 // ignore list full
                 if (!GetPlayer()->GetSocial()->AddToSocialList(GUID_LOPART(IgnoreGuid), true))
                     ignoreResult = FRIEND_IGNORE_FULL;
+                else
+                    GetPlayer()->UpdateChannelIgnores();
             }
         }
     }
@@ -876,6 +878,7 @@ void WorldSession::HandleDelIgnoreOpcode(WorldPacket& recvData)
     recvData >> IgnoreGUID;
 
     _player->GetSocial()->RemoveFromSocialList(GUID_LOPART(IgnoreGUID), true);
+    _player->UpdateChannelIgnores();
 
     sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_IGNORE_REMOVED, GUID_LOPART(IgnoreGUID), false);
 
@@ -429,8 +429,8 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvPacket)
     WorldPacket data(SMSG_MOVE_UPDATE, recvPacket.size());
     //movementInfo.Alive32 = movementInfo.time; // hack, but it's work in 505 in this way ...
     mover->WriteMovementInfo(data);
-    mover->SendMessageToSet(&data, _player);
-    
+    mover->SendMovementMessageToSet(&data, _player, opcode != CMSG_MOVE_HEARTBEAT);
+
     if (plrMover)                                            // nothing is charmed, or player charmed
     {
         plrMover->UpdateFallInformationIfNeed(movementInfo, opcode);
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPrefetcher.h"
+#include "Map.h"
+#include "VMapFactory.h"
+#include "World.h"
+#include "Log.h"
+#include "Timer.h"
+
+#include <ace/Guard_T.h>
+#include <ace/Method_Request.h>
+
+class GridPrefetchRequest : public ACE_Method_Request
+{
+    public:
+        GridPrefetchRequest(GridPrefetcher& prefetcher, uint32 key) : m_prefetcher(prefetcher), m_key(key) { }
+
+        virtual int call()
+        {
+            m_prefetcher.Prefetch(m_key);
+            return 0;
+        }
+
+    private:
+        GridPrefetcher& m_prefetcher;
+        uint32 m_key;
+};
+
+GridPrefetcher::~GridPrefetcher()
+{
+    Unload();
+}
+
+void GridPrefetcher::Initialize()
+{
+    if (!sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD))
+        return;
+
+    // file reads only, one thread keeps ahead of any player
+    if (m_executor.activate(1) == -1)
+        sLog->outError(LOG_FILTER_MAPS, "GridPrefetcher: could not start the prefetch thread, grids are loaded on demand only.");
+}
+
+void GridPrefetcher::Unload()
+{
+    // grids still waiting to be read are deleted unread, the entries they were queued for are dropped below
+    if (m_executor.activated())
+        m_executor.deactivate();
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+        DropData(itr->second.Terrain, itr->second.Models);
+    m_entries.clear();
+}
+
+void GridPrefetcher::Update(uint32 diff)
+{
+    m_expireTimer += diff;
+    if (m_expireTimer < GRID_PREFETCH_EXPIRE_TIME / 4)
+        return;
+
+    m_expireTimer = 0;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    uint32 now = getMSTime();
+    for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end();)
+    {
+        if (itr->second.Ready && getMSTimeDiff(itr->second.ReadyTime, now) >= GRID_PREFETCH_EXPIRE_TIME)
+        {
+            DropData(itr->second.Terrain, itr->second.Models);
+            m_entries.erase(itr++);
+            ++m_stats.Expired;
+        }
+        else
+            ++itr;
+    }
+}
+
+void GridPrefetcher::Request(uint32 mapId, int gx, int gy)
+{
+    if (!m_executor.activated())
+        return;
+
+    uint32 key = MakeKey(mapId, gx, gy);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    if (m_entries.size() >= GRID_PREFETCH_MAX_ENTRIES || m_entries.find(key) != m_entries.end())
+        return;
+
+    m_entries[key] = Entry();
+    if (m_executor.execute(new GridPrefetchRequest(*this, key)) == -1)
+    {
+        m_entries.erase(key);
+        return;
+    }
+
+    ++m_stats.Requests;
+    sLog->outDebug(LOG_FILTER_MAPS, "GridPrefetcher: queued grid [%d, %d] of map %u", gx, gy, mapId);
+}
+
+GridMap* GridPrefetcher::TakeTerrain(uint32 mapId, int gx, int gy)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    EntryMap::iterator itr = m_entries.find(MakeKey(mapId, gx, gy));
+    // still being read, the map thread loads it itself and the prefetched copy is dropped
+    if (itr == m_entries.end() || !itr->second.Ready)
+        return NULL;
+
+    GridMap* terrain = itr->second.Terrain;
+    itr->second.Terrain = NULL;
+    return terrain;
+}
+
+void GridPrefetcher::ReleaseModels(uint32 mapId, int gx, int gy)
+{
+    std::vector<std::string> models;
+    GridMap* terrain = NULL;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        EntryMap::iterator itr = m_entries.find(MakeKey(mapId, gx, gy));
+        if (itr == m_entries.end())
+            return;
+
+        models.swap(itr->second.Models);
+        terrain = itr->second.Terrain;
+        m_entries.erase(itr);
+    }
+
+    DropData(terrain, models);
+}
+
+void GridPrefetcher::Prefetch(uint32 key)
+{
+    uint32 mapId = key >> 16;
+    int gx = (key >> 8) & 0xFF;
+    int gy = key & 0xFF;
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        if (m_entries.find(key) == m_entries.end())
+            return;
+    }
+
+    uint32 oldMSTime = getMSTime();
+
+    GridMap* terrain = Map::LoadGridMap(mapId, gx, gy);
+    std::vector<std::string> models;
+    VMAP::VMapFactory::createOrGetVMapManager()->prefetchMapTile((sWorld->GetDataPath() + "vmaps").c_str(), mapId, gx, gy, models);
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        EntryMap::iterator itr = m_entries.find(key);
+        if (itr != m_entries.end())
+        {
+            itr->second.Terrain = terrain;
+            itr->second.Models.swap(models);
+            itr->second.Ready = true;
+            itr->second.ReadyTime = getMSTime();
+            terrain = NULL;
+        }
+    }
+
+    // the grid got loaded while this one was being read
+    DropData(terrain, models);
+
+    sLog->outDebug(LOG_FILTER_MAPS, "GridPrefetcher: read grid [%d, %d] of map %u in %u ms", gx, gy, mapId, GetMSTimeDiffToNow(oldMSTime));
+}
+
+void GridPrefetcher::DropData(GridMap* terrain, std::vector<std::string> const& models)
+{
+    delete terrain;
+    if (!models.empty())
+        VMAP::VMapFactory::createOrGetVMapManager()->releasePrefetchedModels(models);
+}
+
+void GridPrefetcher::RecordTerrainLoad(uint32 time, bool prefetched)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    ++m_stats.TerrainLoads;
+    if (prefetched)
+        ++m_stats.TerrainPrefetched;
+    m_stats.TerrainTime += time;
+    m_stats.TerrainMaxTime = std::max(m_stats.TerrainMaxTime, time);
+}
+
+void GridPrefetcher::RecordObjectLoad(uint32 time)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    ++m_stats.ObjectLoads;
+    m_stats.ObjectTime += time;
+    m_stats.ObjectMaxTime = std::max(m_stats.ObjectMaxTime, time);
+}
+
+GridLoadStats GridPrefetcher::GetStats() const
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    return m_stats;
+}
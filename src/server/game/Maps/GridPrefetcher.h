@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_GRIDPREFETCHER_H
+#define TRINITY_GRIDPREFETCHER_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+#include "DelayExecutor.h"
+
+#include <ace/Singleton.h>
+#include <ace/Thread_Mutex.h>
+
+#include <string>
+#include <vector>
+
+class GridMap;
+
+// prefetched grids not picked up within this time are dropped
+#define GRID_PREFETCH_EXPIRE_TIME   (60 * IN_MILLISECONDS)
+// upper bound of grids waiting to be loaded or picked up
+#define GRID_PREFETCH_MAX_ENTRIES   128
+
+struct GridLoadStats
+{
+    GridLoadStats() : TerrainLoads(0), TerrainPrefetched(0), TerrainTime(0), TerrainMaxTime(0),
+        ObjectLoads(0), ObjectTime(0), ObjectMaxTime(0), Requests(0), Expired(0) { }
+
+    uint32 TerrainLoads;                                    // grid map and vmap tile loads done by map threads
+    uint32 TerrainPrefetched;                               // of those, the ones the prefetcher had read already
+    uint32 TerrainTime;                                     // ms spent by map threads
+    uint32 TerrainMaxTime;
+    uint32 ObjectLoads;                                     // grids whose spawns were loaded
+    uint32 ObjectTime;
+    uint32 ObjectMaxTime;
+    uint32 Requests;                                        // grids queued for prefetching
+    uint32 Expired;                                         // prefetched grids nobody came to
+};
+
+/**
+ * Reads terrain files (.map) and the vmap model files of continent grids on a
+ * background thread before a player gets close enough to need them.
+ *
+ * Map::PlayerRelocation() asks for the grids around the point a player is
+ * heading to. When the grid is created, the map thread takes the ready GridMap
+ * and links the vmap tile with its models already in memory. Everything that
+ * touches the map itself (creating the NGrid, spawning creatures and
+ * gameobjects) stays on the map thread.
+ */
+class GridPrefetcher
+{
+    friend class ACE_Singleton<GridPrefetcher, ACE_Null_Mutex>;
+
+    public:
+        void Initialize();
+        void Unload();
+        void Update(uint32 diff);
+
+        // map thread side
+        void Request(uint32 mapId, int gx, int gy);
+        GridMap* TakeTerrain(uint32 mapId, int gx, int gy);
+        void ReleaseModels(uint32 mapId, int gx, int gy);
+
+        void RecordTerrainLoad(uint32 time, bool prefetched);
+        void RecordObjectLoad(uint32 time);
+        GridLoadStats GetStats() const;
+
+        // worker thread side
+        void Prefetch(uint32 key);
+
+    private:
+        GridPrefetcher() : m_expireTimer(0) { }
+        ~GridPrefetcher();
+
+        struct Entry
+        {
+            Entry() : Ready(false), Terrain(NULL), ReadyTime(0) { }
+
+            bool Ready;
+            GridMap* Terrain;
+            std::vector<std::string> Models;                // referenced in the vmap manager until released
+            uint32 ReadyTime;
+        };
+
+        typedef UNORDERED_MAP<uint32, Entry> EntryMap;
+
+        static uint32 MakeKey(uint32 mapId, int gx, int gy) { return (mapId << 16) | (uint32(gx) << 8) | uint32(gy); }
+        static void DropData(GridMap* terrain, std::vector<std::string> const& models);
+
+        DelayExecutor m_executor;
+        EntryMap m_entries;
+        GridLoadStats m_stats;
+        uint32 m_expireTimer;
+        mutable ACE_Thread_Mutex m_lock;
+};
+
+#define sGridPrefetcher ACE_Singleton<GridPrefetcher, ACE_Null_Mutex>::instance()
+
+#endif
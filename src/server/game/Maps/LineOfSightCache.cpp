@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include "World.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <ace/Guard_T.h>
+
+bool LineOfSightCache::Key::operator==(Key const& right) const
+{
+    for (uint8 i = 0; i < 6; ++i)
+        if (Coords[i] != right.Coords[i])
+            return false;
+
+    return PhaseMask == right.PhaseMask;
+}
+
+LineOfSightCache::Key LineOfSightCache::MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask)
+{
+    Key key;
+    key.Coords[0] = int32(floor(x1 / LOS_CACHE_PRECISION));
+    key.Coords[1] = int32(floor(y1 / LOS_CACHE_PRECISION));
+    key.Coords[2] = int32(floor(z1 / LOS_CACHE_PRECISION));
+    key.Coords[3] = int32(floor(x2 / LOS_CACHE_PRECISION));
+    key.Coords[4] = int32(floor(y2 / LOS_CACHE_PRECISION));
+    key.Coords[5] = int32(floor(z2 / LOS_CACHE_PRECISION));
+    key.PhaseMask = phasemask;
+
+    // both directions of a line share one entry, keep the lower end first
+    if (std::lexicographical_compare(key.Coords + 3, key.Coords + 6, key.Coords, key.Coords + 3))
+        std::swap_ranges(key.Coords, key.Coords + 3, key.Coords + 3);
+
+    return key;
+}
+
+uint64 LineOfSightCache::HashKey(Key const& key)
+{
+    // FNV-1a over the quantized coordinates and the phase
+    uint64 hash = UI64LIT(14695981039346656037);
+    for (uint8 i = 0; i < 6; ++i)
+    {
+        hash ^= uint32(key.Coords[i]);
+        hash *= UI64LIT(1099511628211);
+    }
+
+    hash ^= key.PhaseMask;
+    hash *= UI64LIT(1099511628211);
+    return hash;
+}
+
+bool LineOfSightCache::IsEnabled()
+{
+    return sWorld->getIntConfig(CONFIG_VMAP_LOS_CACHE_DURATION) != 0;
+}
+
+bool LineOfSightCache::Find(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, bool& result) const
+{
+    if (!IsEnabled())
+        return false;
+
+    Key key = MakeKey(x1, y1, z1, x2, y2, z2, phasemask);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    EntryMap::const_iterator itr = m_entries.find(HashKey(key));
+    // another line with the same hash, treat it as a miss
+    if (itr == m_entries.end() || !(itr->second.Query == key))
+        return false;
+
+    result = itr->second.Result;
+    return true;
+}
+
+void LineOfSightCache::Store(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, bool result)
+{
+    if (!IsEnabled())
+        return;
+
+    Entry entry;
+    entry.Query = MakeKey(x1, y1, z1, x2, y2, z2, phasemask);
+    entry.Result = result;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    if (m_entries.size() >= LOS_CACHE_MAX_ENTRIES)
+        m_entries.clear();
+
+    m_entries[HashKey(entry.Query)] = entry;
+}
+
+void LineOfSightCache::Update(uint32 diff)
+{
+    m_timer += diff;
+    if (m_timer < sWorld->getIntConfig(CONFIG_VMAP_LOS_CACHE_DURATION))
+        return;
+
+    m_timer = 0;
+    Clear();
+}
+
+void LineOfSightCache::Clear()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    m_entries.clear();
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_LINEOFSIGHTCACHE_H
+#define TRINITY_LINEOFSIGHTCACHE_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+#include <ace/Thread_Mutex.h>
+
+// positions are rounded to this many yards before they are compared
+#define LOS_CACHE_PRECISION     0.25f
+// the cache is dropped early if a burst of queries fills it up
+#define LOS_CACHE_MAX_ENTRIES   32768
+
+/**
+ * Short lived record of line of sight results of one map.
+ *
+ * Spell targeting asks the same questions many times within a few updates (every
+ * effect of an AoE checks every target again), the answers are kept here for
+ * vmap.LOSCacheDuration milliseconds. Collision triangles are two sided, so the
+ * line from A to B and from B to A share an entry. Results depend on the phase
+ * because of phased gameobjects, the phasemask of the query is part of the key.
+ */
+class LineOfSightCache
+{
+    public:
+        LineOfSightCache() : m_timer(0) { }
+
+        bool Find(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, bool& result) const;
+        void Store(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, bool result);
+
+        void Update(uint32 diff);
+        void Clear();
+
+        static bool IsEnabled();
+
+    private:
+        struct Key
+        {
+            int32 Coords[6];
+            uint32 PhaseMask;
+
+            bool operator==(Key const& right) const;
+        };
+
+        struct Entry
+        {
+            Key Query;
+            bool Result;
+        };
+
+        typedef UNORDERED_MAP<uint64, Entry> EntryMap;
+
+        static Key MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask);
+        static uint64 HashKey(Key const& key);
+
+        EntryMap m_entries;
+        uint32 m_timer;
+        mutable ACE_Thread_Mutex m_lock;
+};
+
+#endif
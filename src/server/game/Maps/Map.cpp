@@ -33,6 +33,8 @@
 #include "LFGMgr.h"
 #include "DynamicTree.h"
 #include "Vehicle.h"
+#include "Battleground.h"
+#include "GridPrefetcher.h"
 
 union u_map_magic
 {
@@ -49,6 +51,8 @@ u_map_magic MapLiquidMagic  = { {'M','L','I','Q'} };
 #define DEFAULT_GRID_EXPIRY     300
 #define MAX_GRID_LOAD_TIME      50
 #define MAX_CREATURE_ATTACK_RADIUS  (45.0f * sWorld->getRate(RATE_CREATURE_AGGRO))
+#define MAP_LOS_BATCH_SIZE      64
+#define GRID_PREFETCH_TAXI_SPEED    32.0f                   // base taxi speed, see FlightPathMovementGenerator
 
 GridState* si_GridStates[MAX_GRID_STATE];
 
@@ -163,26 +167,53 @@ void Map::LoadMap(int gx, int gy, bool reload)
         GridMaps[gx][gy]=NULL;
     }
 
+    GridMaps[gx][gy] = LoadGridMap(GetId(), gx, gy);
+}
+
+// Reads a terrain file, also used by the grid prefetcher thread so it must not touch any map
+GridMap* Map::LoadGridMap(uint32 mapId, int gx, int gy)
+{
     // map file name
     char *tmp=NULL;
     int len = sWorld->GetDataPath().length()+strlen("maps/%03u%02u%02u.map")+1;
     tmp = new char[len];
-    snprintf(tmp, len, (char *)(sWorld->GetDataPath()+"maps/%03u%02u%02u.map").c_str(), GetId(), gx, gy);
+    snprintf(tmp, len, (char *)(sWorld->GetDataPath()+"maps/%03u%02u%02u.map").c_str(), mapId, gx, gy);
     sLog->outInfo(LOG_FILTER_MAPS, "Loading map %s", tmp);
     // loading data
-    GridMaps[gx][gy] = new GridMap();
-    if (!GridMaps[gx][gy]->loadData(tmp))
+    GridMap* gridMap = new GridMap();
+    if (!gridMap->loadData(tmp))
     {
         sLog->outError(LOG_FILTER_MAPS, "Error loading map file: \n %s\n", tmp);
     }
     delete [] tmp;
+    return gridMap;
 }
 
 void Map::LoadMapAndVMap(int gx, int gy)
 {
-    LoadMap(gx, gy);
-    if (i_InstanceId == 0)
-        LoadVMap(gx, gy);                                   // Only load the data for the base map
+    // instances share the grid maps of their parent, which does the loading
+    if (i_InstanceId != 0)
+    {
+        LoadMap(gx, gy);
+        return;
+    }
+
+    uint32 oldMSTime = getMSTime();
+
+    GridMap* prefetched = GridMaps[gx][gy] ? NULL : sGridPrefetcher->TakeTerrain(GetId(), gx, gy);
+    if (prefetched)
+        GridMaps[gx][gy] = prefetched;
+    else
+        LoadMap(gx, gy);
+
+    LoadVMap(gx, gy);                                       // Only load the data for the base map
+    // the tile holds its own references to the prefetched models now
+    sGridPrefetcher->ReleaseModels(GetId(), gx, gy);
+
+    uint32 loadTime = GetMSTimeDiffToNow(oldMSTime);
+    sGridPrefetcher->RecordTerrainLoad(loadTime, prefetched != NULL);
+    if (loadTime > MAX_GRID_LOAD_TIME)
+        sLog->outInfo(LOG_FILTER_MAPS, "Terrain of grid [%d, %d] on map %u took %u ms to load%s", gx, gy, GetId(), loadTime, prefetched ? " (prefetched)" : "");
 }
 
 void Map::InitStateMachine()
@@ -206,7 +237,7 @@ _creatureToMoveLock(false), i_mapEntry (sMapStore.LookupEntry(id)), i_spawnMode(
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), i_gridExpiry(expiry),
-i_scriptLock(false)
+i_scriptLock(false), _transportsUpdateIter(_transports.end())
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -362,12 +393,19 @@ bool Map::EnsureGridLoaded(const Cell &cell)
 
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
+        uint32 oldMSTime = getMSTime();
+
         ObjectGridLoader loader(*grid, this, cell);
         loader.LoadN();
 
         // Add resurrectable corpses to world object list in grid
         sObjectAccessor->AddCorpsesToGrid(GridCoord(cell.GridX(), cell.GridY()), grid->GetGridType(cell.CellX(), cell.CellY()), this);
         Balance();
+
+        uint32 loadTime = GetMSTimeDiffToNow(oldMSTime);
+        sGridPrefetcher->RecordObjectLoad(loadTime);
+        if (loadTime > MAX_GRID_LOAD_TIME)
+            sLog->outInfo(LOG_FILTER_MAPS, "Objects of grid [%u, %u] on map %u instance %u took %u ms to load", cell.GridX(), cell.GridY(), GetId(), i_InstanceId, loadTime);
         return true;
     }
 
@@ -500,6 +538,7 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<WoWSource::O
 void Map::Update(const uint32 t_diff)
 {
     _dynamicTree.update(t_diff);
+    _lineOfSightCache.Update(t_diff);
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -548,6 +587,8 @@ void Map::Update(const uint32 t_diff)
         VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
     }
 
+    UpdateTransports(t_diff);
+
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
     {
@@ -561,6 +602,29 @@ void Map::Update(const uint32 t_diff)
     sScriptMgr->OnMapUpdate(this, t_diff);
 }
 
+void Map::UpdateTransports(uint32 diff)
+{
+    // a transport may be unloaded by a script during its own update, RemoveTransport moves the iterator past it
+    for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
+    {
+        Transport* transport = *_transportsUpdateIter;
+        ++_transportsUpdateIter;
+
+        transport->Update(diff);
+    }
+}
+
+void Map::RemoveTransport(Transport* transport)
+{
+    TransportsContainer::iterator itr = _transports.find(transport);
+    if (itr == _transports.end())
+        return;
+
+    if (itr == _transportsUpdateIter)
+        ++_transportsUpdateIter;
+    _transports.erase(itr);
+}
+
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
     player->RemoveFromWorld();
@@ -627,11 +691,56 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
             EnsureGridLoadedForActiveObject(new_cell, player);
 
         AddToGrid(player, new_cell);
+        PrefetchGridsAhead(player);
     }
 
     player->OnRelocated();
 }
 
+// Queues the grid files a player will need soon if it keeps going the same way
+void Map::PrefetchGridsAhead(Player const* player)
+{
+    uint32 lookahead = sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD);
+    if (!lookahead || Instanceable())
+        return;
+
+    float speed;
+    if (player->isInFlight())
+        speed = GRID_PREFETCH_TAXI_SPEED;
+    else if (player->isMoving())
+        speed = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN);
+    else
+        return;
+
+    float distance = speed * lookahead;
+    float range = GetVisibilityRange();
+    float angle = player->GetOrientation();
+
+    // walk the expected path in half grid steps, every grid within visibility range of it will be needed
+    for (float travelled = SIZE_OF_GRIDS / 2; ; travelled += SIZE_OF_GRIDS / 2)
+    {
+        float step = std::min(travelled, distance);
+        float x = player->GetPositionX() + step * std::cos(angle);
+        float y = player->GetPositionY() + step * std::sin(angle);
+
+        // visibility range is smaller than a grid, the corners of the visible square cover every grid in it
+        for (uint8 i = 0; i < 4; ++i)
+        {
+            GridCoord p = WoWSource::ComputeGridCoord(x + (i & 1 ? range : -range), y + (i & 2 ? range : -range));
+            if (!p.IsCoordValid() || getNGrid(p.x_coord, p.y_coord))
+                continue;
+
+            int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+            int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+            if (!GridMaps[gx][gy])
+                sGridPrefetcher->Request(GetId(), gx, gy);
+        }
+
+        if (step >= distance)
+            break;
+    }
+}
+
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
 {
     ASSERT(CheckGridIntegrity(creature, false));
@@ -1824,8 +1933,50 @@ void Map::GetZoneAndAreaIdByAreaFlag(uint32& zoneid, uint32& areaid, uint16 area
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
+    bool result;
+    if (_lineOfSightCache.Find(x1, y1, z1, x2, y2, z2, phasemask, result))
+        return result;
+
+    result = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
         && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+    _lineOfSightCache.Store(x1, y1, z1, x2, y2, z2, phasemask, result);
+    return result;
+}
+
+void Map::isInLineOfSight(float x, float y, float z, std::vector<LineOfSightQuery>& queries, uint32* nodeVisits) const
+{
+    G3D::Vector3 targets[MAP_LOS_BATCH_SIZE];
+    bool results[MAP_LOS_BATCH_SIZE];
+    uint32 index[MAP_LOS_BATCH_SIZE];
+    VMAP::IVMapManager* vMapManager = VMAP::VMapFactory::createOrGetVMapManager();
+
+    for (uint32 first = 0; first < queries.size(); first += MAP_LOS_BATCH_SIZE)
+    {
+        uint32 last = std::min<uint32>(first + MAP_LOS_BATCH_SIZE, queries.size());
+        uint32 count = 0;
+        for (uint32 i = first; i < last; ++i)
+        {
+            LineOfSightQuery& query = queries[i];
+            if (_lineOfSightCache.Find(x, y, z, query.x, query.y, query.z, query.phasemask, query.inLineOfSight))
+                continue;
+
+            targets[count] = G3D::Vector3(query.x, query.y, query.z);
+            index[count] = i;
+            ++count;
+        }
+
+        if (!count)
+            continue;
+
+        vMapManager->isInLineOfSight(GetId(), x, y, z, targets, results, count, nodeVisits);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            LineOfSightQuery& query = queries[index[i]];
+            query.inLineOfSight = results[i] && _dynamicTree.isInLineOfSight(x, y, z, query.x, query.y, query.z, query.phasemask);
+            _lineOfSightCache.Store(x, y, z, query.x, query.y, query.z, query.phasemask, query.inLineOfSight);
+        }
+    }
 }
 
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
@@ -2673,6 +2824,16 @@ BattlegroundMap::~BattlegroundMap()
     }
 }
 
+void BattlegroundMap::Update(const uint32 t_diff)
+{
+    Map::Update(t_diff);
+
+    // the battleground logic runs on the thread updating its map, what it does outside
+    // of it is queued for BattlegroundMgr, which also deletes the battlegrounds flagged here
+    if (m_bg && !m_bg->ToBeDeleted())
+        m_bg->Update(t_diff);
+}
+
 void BattlegroundMap::InitVisibilityDistance()
 {
     //init visibility distance for BG/Arenas
@@ -32,6 +32,7 @@
 #include "MapRefManager.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "LineOfSightCache.h"
 
 #include <bitset>
 #include <list>
@@ -44,6 +45,7 @@ class InstanceSave;
 class Object;
 class WorldObject;
 class TempSummon;
+class Transport;
 class Player;
 class CreatureGroup;
 struct ScriptInfo;
@@ -54,6 +56,14 @@ class MapInstanced;
 class InstanceMap;
 namespace WoWSource { struct ObjectUpdater; }
 
+// One target of a line of sight query from a shared origin
+struct LineOfSightQuery
+{
+    float x, y, z;
+    uint32 phasemask;                                       // phase of the asking object, for phased gameobjects
+    bool inLineOfSight;                                     // result
+};
+
 struct ScriptAction
 {
     uint64 sourceGUID;
@@ -301,6 +311,7 @@ class Map : public GridRefManager<NGridType>
 
         static bool ExistMap(uint32 mapid, int gx, int gy);
         static bool ExistVMap(uint32 mapid, int gx, int gy);
+        static GridMap* LoadGridMap(uint32 mapId, int gx, int gy);
 
         static void InitStateMachine();
         static void DeleteStateMachine();
@@ -399,6 +410,12 @@ class Map : public GridRefManager<NGridType>
         void AddWorldObject(WorldObject* obj) { i_worldObjects.insert(obj); }
         void RemoveWorldObject(WorldObject* obj) { i_worldObjects.erase(obj); }
 
+        // transports are moved along their path by the map they are currently on
+        typedef std::set<Transport*> TransportsContainer;
+        void AddTransport(Transport* transport) { _transports.insert(transport); }
+        void RemoveTransport(Transport* transport);
+        TransportsContainer const& GetTransports() const { return _transports; }
+
         void SendToPlayers(WorldPacket const* data) const;
 
         typedef MapRefManager PlayerList;
@@ -443,6 +460,9 @@ class Map : public GridRefManager<NGridType>
         float GetWaterOrGroundLevel(float x, float y, float z, float* ground = NULL, bool swim = false) const;
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
+        // answers every query at once, the uncached ones are traced together through the vmap tree
+        void isInLineOfSight(float x, float y, float z, std::vector<LineOfSightQuery>& queries, uint32* nodeVisits = NULL) const;
+        void ClearLineOfSightCache() { _lineOfSightCache.Clear(); }
         void Balance() { _dynamicTree.balance(); }
         void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
         void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
@@ -485,6 +505,7 @@ class Map : public GridRefManager<NGridType>
         void LoadMapAndVMap(int gx, int gy);
         void LoadVMap(int gx, int gy);
         void LoadMap(int gx, int gy, bool reload = false);
+        void PrefetchGridsAhead(Player const* player);
         GridMap* GetGrid(float x, float y);
 
         void SetTimer(uint32 t) { i_gridExpiry = t < MIN_GRID_DELAY ? MIN_GRID_DELAY : t; }
@@ -543,6 +564,7 @@ class Map : public GridRefManager<NGridType>
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
+        mutable LineOfSightCache _lineOfSightCache;
 
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
@@ -578,6 +600,11 @@ class Map : public GridRefManager<NGridType>
         std::map<WorldObject*, bool> i_objectsToSwitch;
         std::set<WorldObject*> i_worldObjects;
 
+        void UpdateTransports(uint32 diff);
+
+        TransportsContainer _transports;
+        TransportsContainer::iterator _transportsUpdateIter;
+
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
 
@@ -660,6 +687,7 @@ class BattlegroundMap : public Map
         BattlegroundMap(uint32 id, time_t, uint32 InstanceId, Map* _parent, uint8 spawnMode);
         ~BattlegroundMap();
 
+        void Update(const uint32);
         bool AddPlayerToMap(Player*);
         void RemovePlayerFromMap(Player*, bool);
         bool CanEnter(Player* player);
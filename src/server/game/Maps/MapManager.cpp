@@ -33,6 +33,7 @@
 #include "Language.h"
 #include "WorldPacket.h"
 #include "Group.h"
+#include "GridPrefetcher.h"
 
 extern GridState* si_GridStates[];                          // debugging code, should be deleted some day
 
@@ -61,6 +62,8 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0 && m_updater.activate(num_threads) == -1)
         abort();
+
+    sGridPrefetcher->Initialize();
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -297,13 +300,39 @@ void MapManager::Update(uint32 diff)
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
+    ProcessTransportTeleports();
+
     sObjectAccessor->Update(uint32(i_timer.GetCurrent()));
-    for (TransportSet::iterator itr = m_Transports.begin(); itr != m_Transports.end(); ++itr)
-        (*itr)->Update(uint32(i_timer.GetCurrent()));
+    sGridPrefetcher->Update(uint32(i_timer.GetCurrent()));
 
     i_timer.SetCurrent(0);
 }
 
+void MapManager::ScheduleTransportTeleport(Transport* transport)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_transportTeleportsLock);
+    m_transportTeleports.push_back(transport);
+}
+
+void MapManager::UnscheduleTransportTeleport(Transport* transport)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_transportTeleportsLock);
+    m_transportTeleports.erase(std::remove(m_transportTeleports.begin(), m_transportTeleports.end(), transport), m_transportTeleports.end());
+}
+
+// no map is being updated here, the transport and its passengers can be moved between maps
+void MapManager::ProcessTransportTeleports()
+{
+    std::vector<Transport*> teleports;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_transportTeleportsLock);
+        teleports.swap(m_transportTeleports);
+    }
+
+    for (std::vector<Transport*>::const_iterator itr = teleports.begin(); itr != teleports.end(); ++itr)
+        (*itr)->FinishTeleport();
+}
+
 void MapManager::DoDelayedMovesAndRemoves()
 {
 }
@@ -349,6 +378,8 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    sGridPrefetcher->Unload();
+
     Map::DeleteStateMachine();
 }
 
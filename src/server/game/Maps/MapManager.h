@@ -130,6 +130,10 @@ class MapManager
         void LoadTransportForPlayers(Player* player);
         void UnLoadTransportForPlayers(Player* player);
 
+        // called by map threads for transports whose next node is on another map
+        void ScheduleTransportTeleport(Transport* transport);
+        void UnscheduleTransportTeleport(Transport* transport);
+
         typedef std::set<Transport*> TransportSet;
         TransportSet m_Transports;
 
@@ -176,6 +180,8 @@ class MapManager
         MapManager(const MapManager &);
         MapManager& operator=(const MapManager &);
 
+        void ProcessTransportTeleports();
+
         ACE_Thread_Mutex Lock;
         uint32 i_gridCleanUpDelay;
         MapMapType i_maps;
@@ -184,6 +190,9 @@ class MapManager
         InstanceIds _instanceIds;
         uint32 _nextInstanceId;
         MapUpdater m_updater;
+
+        ACE_Thread_Mutex m_transportTeleportsLock;
+        std::vector<Transport*> m_transportTeleports;
 };
 #define sMapMgr ACE_Singleton<MapManager, ACE_Thread_Mutex>::instance()
 #endif
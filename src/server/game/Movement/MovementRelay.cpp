@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementRelay.h"
+#include "Player.h"
+#include "World.h"
+#include "Timer.h"
+
+uint32 MovementRelayState::GetDeliveryInterval(float dist, float range)
+{
+    uint32 maxInterval = sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_MAX_INTERVAL);
+    float nearDist = sWorld->getFloatConfig(CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE);
+
+    if (!maxInterval || dist <= nearDist || range <= nearDist)
+        return 0;
+
+    if (dist >= range)
+        return maxInterval;
+
+    return uint32(maxInterval * (dist - nearDist) / (range - nearDist));
+}
+
+bool MovementRelayState::ShouldDeliver(uint64 observer, float dist, float range, bool stateChange, uint32 now)
+{
+    uint32 interval = GetDeliveryInterval(dist, range);
+    if (!interval)
+        return true;
+
+    if (getMSTimeDiff(m_lastPrune, now) >= MOVEMENT_RELAY_PRUNE_INTERVAL)
+        Prune(now);
+
+    DeliveryTimeMap::iterator itr = m_lastDelivery.find(observer);
+    if (itr == m_lastDelivery.end())
+    {
+        m_lastDelivery[observer] = now;
+        return true;
+    }
+
+    if (!stateChange && getMSTimeDiff(itr->second, now) < interval)
+        return false;
+
+    itr->second = now;
+    return true;
+}
+
+void MovementRelayState::Prune(uint32 now)
+{
+    m_lastPrune = now;
+
+    // an observer past the longest interval gets the next update anyway, same as an unknown one
+    uint32 maxInterval = sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_MAX_INTERVAL);
+    for (DeliveryTimeMap::iterator itr = m_lastDelivery.begin(); itr != m_lastDelivery.end();)
+    {
+        if (getMSTimeDiff(itr->second, now) >= maxInterval)
+            m_lastDelivery.erase(itr++);
+        else
+            ++itr;
+    }
+}
+
+bool MovementRelay::ShouldDeliver(Player const* observer, WorldObject const* mover)
+{
+    // observers sharing vision see the mover from their seer's position
+    WorldObject const* seer = observer->m_seer ? observer->m_seer : observer;
+    return m_state.ShouldDeliver(observer->GetGUID(), seer->GetExactDist2d(mover), m_range, m_stateChange, m_now);
+}
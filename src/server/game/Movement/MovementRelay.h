@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MOVEMENTRELAY_H
+#define TRINITY_MOVEMENTRELAY_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+
+class Player;
+class WorldObject;
+
+// how often stale observers are dropped from a mover's delivery record
+#define MOVEMENT_RELAY_PRUNE_INTERVAL (30 * IN_MILLISECONDS)
+
+/**
+ * Per mover record of when each distant observer last received one of its
+ * movement updates.
+ *
+ * Observers within Visibility.MovementRelay.NearDistance get every update. Past
+ * that distance a heartbeat is only delivered once the observer has gone without
+ * an update for an interval that grows linearly up to
+ * Visibility.MovementRelay.MaxInterval at the edge of visibility. Every update
+ * carries the full movement state, so a skipped heartbeat is coalesced into the
+ * next one that is delivered. State changes (start, stop, jump, facing...) are
+ * never thinned.
+ */
+class MovementRelayState
+{
+    public:
+        MovementRelayState() : m_lastPrune(0) { }
+
+        bool ShouldDeliver(uint64 observer, float dist, float range, bool stateChange, uint32 now);
+        void Clear() { m_lastDelivery.clear(); }
+
+        static uint32 GetDeliveryInterval(float dist, float range);
+
+    private:
+        typedef UNORDERED_MAP<uint64, uint32> DeliveryTimeMap;
+
+        void Prune(uint32 now);
+
+        DeliveryTimeMap m_lastDelivery;
+        uint32 m_lastPrune;
+};
+
+// A single movement update passing through MessageDistDeliverer
+class MovementRelay
+{
+    public:
+        MovementRelay(MovementRelayState& state, bool stateChange, float range, uint32 now)
+            : m_state(state), m_stateChange(stateChange), m_range(range), m_now(now) { }
+
+        bool ShouldDeliver(Player const* observer, WorldObject const* mover);
+
+    private:
+        MovementRelayState& m_state;
+        bool m_stateChange;
+        float m_range;
+        uint32 m_now;
+};
+
+#endif
@@ -1,5301 +1,5693 @@
 #include "MovementStructures.h"
 #include "Player.h"
 
-MovementStatusElements const PlayerMove[] =
+/*
+ * Every sequence below is declared once as an element list and expanded twice:
+ * into the MovementStatusElements array read by the reference interpreter and into
+ * a reader/writer pair that calls Read/WriteMovementStatusElement<element> for each
+ * element in order. The switch in those templates is on a template argument, so
+ * every call collapses to the code of its single element and each codec ends up
+ * as straight-line code for its packet layout.
+ */
+
+namespace
 {
-    MSEHasMovementFlags,       // 24
-    MSEMovementFlags,          // 24
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte6,           // 22
-    MSEOneBit,                 // 168
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte1,           // 17
-    MSEZeroBit,                // 149
-    MSEZeroBit,                // 172
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasOrientation,         // 48
-    MSEHasMovementFlags2,      // 28
-    MSEHasPitch,               // 112
-    MSEMovementFlags2,         // 28
-    MSEHasGuidByte7,           // 23
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte2,           // 18
-    MSEHasFallData,            // 140
-    MSEHasTransportData,       // 104
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasFallDirection,       // 136
-    MSEZeroBit,                // 148
-    MSEHasGuidByte3,           // 19
-    MSEHasTimestamp,           // 32
-    MSETransportTime2,         // 88
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte6,     // 62
-    MSETransportOrientation,   // 76
-    MSETransportPositionZ,     // 72
-    MSETransportTime3,         // 96
-    MSETransportGuidByte0,     // 56
-    MSETransportTime,          // 84
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte2,     // 58
-    MSETransportSeat,          // 80
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte4,     // 60
-    MSEGuidByte3,              // 19
-    MSEPitch,                  // 112
-    MSEGuidByte6,              // 22
-    MSEPositionX,              // 36
-    MSEGuidByte4,              // 20
-    MSEUnkUIntLoop,            // 152
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSEPositionY,              // 40
-    MSESplineElevation,        // 144
-    MSETimestamp,              // 32
-    MSEGuidByte1,              // 17
-    MSEGuidByte2,              // 18
-    MSEGuidByte5,              // 21
-    MSEGuidByte0,              // 16
-    MSEPositionZ,              // 44
-    MSEGuidByte7,              // 23
-    MSEOrientation,            // 48
-    MSEEnd
-
-};
-
-MovementStatusElements const SetCanFly[] =
-{
-    MSEPositionY,
-    MSEPositionX,
-    MSEPositionZ,
-    MSEHasGuidByte7,
-    MSEZeroBit,
-    MSEOneBit,
-    MSEHasGuidByte5,
-    MSEZeroBit,
-    MSEHasMovementFlags,
-    MSEUnkUIntCount,
-    MSEHasGuidByte2,
-    MSEHasTransportData,
-    MSEHasTimestamp,
-    MSEHasGuidByte6,
-    MSEHasFallData,
-    MSEHasPitch,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasSplineElevation,
-    MSEHasGuidByte0,
-    MSEHasOrientation,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSEHasMovementFlags2,
-    MSEMovementFlags,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte1,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEUnkUIntLoop,
-    MSEGuidByte7,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEGuidByte2,
-    MSEPitch,
-    
-    MSETransportGuidByte3,
-    MSETransportTime2,
-    MSETransportPositionY,
-    MSETransportGuidByte7,
-    MSETransportGuidByte2,
-    MSETransportPositionX,
-    MSETransportSeat,
-    MSETransportTime3,
-    MSETransportGuidByte6,
-    MSETransportPositionZ,
-    MSETransportTime,
-    MSETransportGuidByte5,
-    MSETransportGuidByte4,
-    MSETransportGuidByte0,
-    MSETransportGuidByte1,
-    MSETransportOrientation,
-    MSEFallVerticalSpeed,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSESplineElevation,
-    MSETimestamp,
-    MSEOrientation,
-    MSEEnd
-
-};
-
-MovementStatusElements const MovementFallLand[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte6,           // 22
-    MSEHasFallData,            // 140
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasUnkTime,             // 168
-    MSEHasMovementFlags,       // 24
-    MSEZeroBit,                // 149
-    MSEHasPitch,               // 112
-    MSEZeroBit,                // 172
-    MSEZeroBit,                // 148
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte3,           // 19
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte7,           // 23
-    MSEHasOrientation,         // 48
-    MSEUnkUIntCount,           // 152
-    MSEMovementFlags,          // 24
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime3,      // 100
-    MSEMovementFlags2,         // 28
-    MSEHasFallDirection,       // 136
-    MSEGuidByte4,              // 20
-    MSEGuidByte0,              // 16
-    MSEGuidByte7,              // 23
-    MSEGuidByte6,              // 22
-    MSEGuidByte2,              // 18
-    MSEGuidByte5,              // 21
-    MSEGuidByte1,              // 17
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte3,              // 19
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSETransportTime2,         // 88
-    MSETransportGuidByte5,     // 61
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte7,     // 63
-    MSETransportTime,          // 84
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte1,     // 57
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte6,     // 62
-    MSETransportPositionY,     // 68
-    MSETransportSeat,          // 80
-    MSETransportGuidByte0,     // 56
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionZ,     // 72
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementHeartBeat[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte7,           // 23
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte1,           // 17
-    MSEHasFallData,            // 140
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte3,           // 19
-    MSEZeroBit,                // 172
-    MSEHasMovementFlags,       // 24
-    MSEZeroBit,                // 148
-    MSEZeroBit,                // 149
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte6,           // 22
-    MSEHasTimestamp,           // 32
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte2,           // 18
-    MSEUnkUIntCount,           // 152
-    MSEHasPitch,               // 112
-    MSEHasSplineElevation,     // 144
-    MSEHasOrientation,         // 48
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEHasFallDirection,       // 136
-    MSEGuidByte1,              // 17
-    MSEGuidByte3,              // 19
-    MSEGuidByte7,              // 23
-    MSEGuidByte4,              // 20
-    MSEGuidByte5,              // 21
-    MSEGuidByte0,              // 16
-    MSEGuidByte6,              // 22
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte2,              // 18
-    MSEUnkTime,                // 168
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSETransportTime,          // 84
-    MSETransportGuidByte1,     // 57
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte2,     // 58
-    MSETransportTime2,         // 88
-    MSETransportOrientation,   // 76
-    MSETransportPositionY,     // 68
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte4,     // 60
-    MSETransportSeat,          // 80
-    MSETransportGuidByte5,     // 61
-    MSEPitch,                  // 112
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementJump[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEHasPitch,               // 112
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte7,           // 23
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 172
-    MSEHasMovementFlags2,      // 28
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasTransportData,       // 104
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 149
-    MSEHasTimestamp,           // 32
-    MSEZeroBit,                // 148
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte6,           // 22
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte3,           // 19
-    MSEHasFallData,            // 140
-    MSEMovementFlags2,         // 28
-    MSEHasFallDirection,       // 136
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte1,  // 57
-    MSEMovementFlags,          // 24
-    MSEGuidByte2,              // 18
-    MSEGuidByte3,              // 19
-    MSEGuidByte5,              // 21
-    MSEGuidByte6,              // 22
-    MSEGuidByte0,              // 16
-    MSEGuidByte4,              // 20
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEUnkUIntLoop,            // 156
-    MSETransportTime3,         // 96
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportTime2,         // 88
-    MSETransportPositionX,     // 64
-    MSETransportSeat,          // 80
-    MSETransportOrientation,   // 76
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte6,     // 62
-    MSETransportTime,          // 84
-    MSESplineElevation,        // 144
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSETimestamp,              // 32
-    MSEOrientation,            // 48
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementSetFacing[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEHasGuidByte4,           // 20
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 149
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte6,           // 22
-    MSEHasTimestamp,           // 32
-    MSEHasFallData,            // 140
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte0,           // 16
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte1,           // 17
-    MSEZeroBit,                // 172
-    MSEHasPitch,               // 112
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 148
-    MSEHasGuidByte3,           // 19
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte5,           // 21
-    MSEHasUnkTime,             // 168
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte2,              // 18
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte1,              // 17
-    MSEGuidByte6,              // 22
-    MSEGuidByte7,              // 23
-    MSEGuidByte0,              // 16
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEGuidByte4,              // 20
-    MSETransportGuidByte4,     // 60
-    MSETransportSeat,          // 80
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte2,     // 58
-    MSETransportTime2,         // 88
-    MSETransportOrientation,   // 76
-    MSETransportPositionZ,     // 72
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSETransportTime,          // 84
-    MSETransportPositionX,     // 64
-    MSETransportPositionY,     // 68
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSESplineElevation,        // 144
-    MSEPitch,                  // 112
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEOrientation,            // 48
-    MSEEnd
-};
-
-MovementStatusElements const MovementSetPitch[] = // 5.4.7 18019
-{
-    /* Find MSEUnkUIntLoop */
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEHasTimestamp,           // 32
-    MSEHasMovementFlags2,      // 28
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte4,           // 20
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte7,           // 23
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte3,           // 19
-    MSEHasFallData,            // 140
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte2,           // 18
-    MSEHasUnkTime,             // 168
-    MSEZeroBit,                // 149
-    MSEHasGuidByte6,           // 22
-    MSEHasPitch,               // 112
-    MSEZeroBit,                // 172
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 148
-    MSEMovementFlags2,         // 28
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime2,      // 92
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEGuidByte5,              // 21
-    MSEGuidByte2,              // 18
-    MSEGuidByte0,              // 16
-    MSEGuidByte1,              // 17
-    MSEGuidByte6,              // 22
-    MSEGuidByte7,              // 23
-    MSEGuidByte4,              // 20
-    MSEGuidByte3,              // 19
-    MSETransportGuidByte2,     // 58
-    MSETransportTime2,         // 88
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte6,     // 62
-    MSETransportTime,          // 84
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionZ,     // 72
-    MSETransportPositionY,     // 68
-    MSETransportPositionX,     // 64
-    MSETransportSeat,          // 80
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportGuidByte4,     // 60
-    MSETransportOrientation,   // 76
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSEUnkTime,                // 168
-    MSETimestamp,              // 32
-    MSESplineElevation,        // 144
-    MSEPitch,                  // 112
-    MSEOrientation,            // 48
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartBackward[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEUnkUIntCount,           // 152
-    MSEHasMovementFlags2,      // 28
-    MSEHasPitch,               // 112
-    MSEHasGuidByte1,           // 17
-    MSEZeroBit,                // 149
-    MSEHasGuidByte3,           // 19
-    MSEHasOrientation,         // 48
-    MSEHasFallData,            // 140
-    MSEHasGuidByte7,           // 23
-    MSEZeroBit,                // 172
-    MSEHasGuidByte2,           // 18
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte4,           // 20
-    MSEHasUnkTime,             // 168
-    MSEZeroBit,                // 148
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte0,           // 16
-    MSEHasTimestamp,           // 32
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte6,           // 22
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte7,              // 23
-    MSEGuidByte5,              // 21
-    MSEGuidByte6,              // 22
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte3,              // 19
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte1,              // 17
-    MSEGuidByte4,              // 20
-    MSETransportGuidByte7,     // 63
-    MSETransportTime2,         // 88
-    MSETransportGuidByte3,     // 59
-    MSETransportSeat,          // 80
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte1,     // 57
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte0,     // 56
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte6,     // 62
-    MSETransportPositionX,     // 64
-    MSETransportTime,          // 84
-    MSETransportTime3,         // 96
-    MSEPitch,                  // 112
-    MSEFallTime,               // 116
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallVerticalSpeed,      // 120
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartForward[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEHasOrientation,         // 48
-    MSEZeroBit,                // 148
-    MSEHasGuidByte4,           // 20
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte3,           // 19
-    MSEHasPitch,               // 112
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte7,           // 23
-    MSEHasSplineElevation,     // 144
-    MSEHasFallData,            // 140
-    MSEHasGuidByte2,           // 18
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 149
-    MSEZeroBit,                // 172
-    MSEHasGuidByte0,           // 16
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte5,           // 21
-    MSEHasTimestamp,           // 32
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEGuidByte4,              // 20
-    MSEGuidByte3,              // 19
-    MSEGuidByte5,              // 21
-    MSEGuidByte7,              // 23
-    MSEGuidByte1,              // 17
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte6,              // 22
-    MSEUnkUIntLoop,            // 156
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionZ,     // 72
-    MSETransportTime3,         // 96
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte4,     // 60
-    MSETransportTime2,         // 88
-    MSETransportTime,          // 84
-    MSETransportGuidByte0,     // 56
-    MSETransportOrientation,   // 76
-    MSETransportSeat,          // 80
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte1,     // 57
-    MSESplineElevation,        // 144
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartStrafeLeft[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEHasUnkTime,             // 168
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte2,           // 18
-    MSEHasTimestamp,           // 32
-    MSEZeroBit,                // 172
-    MSEHasFallData,            // 140
-    MSEHasGuidByte0,           // 16
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte6,           // 22
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte5,           // 21
-    MSEZeroBit,                // 148
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte4,           // 20
-    MSEHasMovementFlags2,      // 28
-    MSEZeroBit,                // 149
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte7,           // 23
-    MSEHasPitch,               // 112
-    MSEHasGuidByte3,           // 19
-    MSEMovementFlags,          // 24
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEGuidByte6,              // 22
-    MSEGuidByte4,              // 20
-    MSEGuidByte7,              // 23
-    MSEGuidByte2,              // 18
-    MSEGuidByte1,              // 17
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte0,              // 16
-    MSETimestamp,              // 32
-    MSETransportGuidByte7,     // 63
-    MSETransportTime2,         // 88
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte3,     // 59
-    MSETransportTime,          // 84
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionZ,     // 72
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte0,     // 56
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte2,     // 58
-    MSETransportTime3,         // 96
-    MSETransportSeat,          // 80
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSEUnkTime,                // 168
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartStrafeRight[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte0,           // 16
-    MSEHasSplineElevation,     // 144
-    MSEHasPitch,               // 112
-    MSEUnkUIntCount,           // 152
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte3,           // 19
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 172
-    MSEZeroBit,                // 148
-    MSEHasMovementFlags2,      // 28
-    MSEHasOrientation,         // 48
-    MSEZeroBit,                // 149
-    MSEHasGuidByte7,           // 23
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte2,           // 18
-    MSEHasMovementFlags,       // 24
-    MSEHasFallData,            // 140
-    MSEHasGuidByte1,           // 17
-    MSEMovementFlags2,         // 28
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime2,      // 92
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte4,              // 20
-    MSEGuidByte0,              // 16
-    MSEGuidByte6,              // 22
-    MSEGuidByte2,              // 18
-    MSEGuidByte7,              // 23
-    MSEGuidByte1,              // 17
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionZ,     // 72
-    MSETransportTime2,         // 88
-    MSETransportGuidByte6,     // 62
-    MSETransportTime,          // 84
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte3,     // 59
-    MSETransportPositionX,     // 64
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte5,     // 61
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSEOrientation,            // 48
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSETimestamp,              // 32
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartTurnLeft[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEHasGuidByte6,           // 22
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 149
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte3,           // 19
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte1,           // 17
-    MSEHasSplineElevation,     // 144
-    MSEHasMovementFlags,       // 24
-    MSEHasMovementFlags2,      // 28
-    MSEHasFallData,            // 140
-    MSEHasTransportData,       // 104
-    MSEHasPitch,               // 112
-    MSEHasGuidByte5,           // 21
-    MSEZeroBit,                // 172
-    MSEHasTimestamp,           // 32
-    MSEZeroBit,                // 148
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte2,           // 18
-    MSEHasFallDirection,       // 136
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte1,  // 57
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte6,              // 22
-    MSEGuidByte3,              // 19
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEGuidByte0,              // 16
-    MSEGuidByte4,              // 20
-    MSEGuidByte5,              // 21
-    MSEGuidByte2,              // 18
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte0,     // 56
-    MSETransportPositionY,     // 68
-    MSETransportTime2,         // 88
-    MSETransportGuidByte7,     // 63
-    MSETransportTime3,         // 96
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte3,     // 59
-    MSETransportPositionZ,     // 72
-    MSETransportOrientation,   // 76
-    MSETransportSeat,          // 80
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte2,     // 58
-    MSETransportTime,          // 84
-    MSEPitch,                  // 112
-    MSEUnkTime,                // 168
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartTurnRight[] = // 5.4.7  18019
-{
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEHasUnkTime,             // 168
-    MSEHasFallData,            // 140
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte3,           // 19
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 172
-    MSEHasGuidByte5,           // 21
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte0,           // 16
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 148
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte6,           // 22
-    MSEHasGuidByte7,           // 23
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 149
-    MSEHasPitch,               // 112
-    MSEHasGuidByte4,           // 20
-    MSEHasSplineElevation,     // 144
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEGuidByte2,              // 18
-    MSEGuidByte5,              // 21
-    MSEGuidByte4,              // 20
-    MSEGuidByte6,              // 22
-    MSEGuidByte1,              // 17
-    MSEGuidByte3,              // 19
-    MSEGuidByte7,              // 23
-    MSEGuidByte0,              // 16
-    MSEUnkUIntLoop,            // 156
-    MSETimestamp,              // 32
-    MSEOrientation,            // 48
-    MSETransportTime3,         // 96
-    MSETransportGuidByte6,     // 62
-    MSETransportPositionY,     // 68
-    MSETransportSeat,          // 80
-    MSETransportGuidByte4,     // 60
-    MSETransportTime,          // 84
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte3,     // 59
-    MSETransportOrientation,   // 76
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte0,     // 56
-    MSETransportTime2,         // 88
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte5,     // 61
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementStop[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEHasGuidByte1,           // 17
-    MSEHasFallData,            // 140
-    MSEHasMovementFlags2,      // 28
-    MSEZeroBit,                // 172
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 149
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte6,           // 22
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte3,           // 19
-    MSEZeroBit,                // 148
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte2,           // 18
-    MSEHasUnkTime,             // 168
-    MSEHasTransportData,       // 104
-    MSEHasPitch,               // 112
-    MSEHasGuidByte5,           // 21
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte7,           // 23
-    MSEMovementFlags,          // 24
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte0,  // 56
-    MSEMovementFlags2,         // 28
-    MSEHasFallDirection,       // 136
-    MSEGuidByte1,              // 17
-    MSEGuidByte6,              // 22
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte7,              // 23
-    MSEGuidByte2,              // 18
-    MSEGuidByte4,              // 20
-    MSEGuidByte0,              // 16
-    MSETransportGuidByte2,     // 58
-    MSETransportTime,          // 84
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte6,     // 62
-    MSETransportTime2,         // 88
-    MSETransportGuidByte3,     // 59
-    MSETransportOrientation,   // 76
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionZ,     // 72
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSETimestamp,              // 32
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementStopStrafe[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte0,           // 16
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte7,           // 23
-    MSEHasFallData,            // 140
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 172
-    MSEHasMovementFlags2,      // 28
-    MSEZeroBit,                // 149
-    MSEHasUnkTime,             // 168
-    MSEZeroBit,                // 148
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportData,       // 104
-    MSEHasPitch,               // 112
-    MSEHasOrientation,         // 48
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte3,           // 19
-    MSEHasSplineElevation,     // 144
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte1,  // 57
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEHasFallDirection,       // 136
-    MSEGuidByte6,              // 22
-    MSEGuidByte7,              // 23
-    MSEGuidByte4,              // 20
-    MSEGuidByte1,              // 17
-    MSEGuidByte5,              // 21
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte3,              // 19
-    MSEUnkUIntLoop,            // 156
-    MSETransportTime,          // 84
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionX,     // 64
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte7,     // 63
-    MSETransportSeat,          // 80
-    MSETransportGuidByte6,     // 62
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte1,     // 57
-    MSETransportTime2,         // 88
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte0,     // 56
-    MSEPitch,                  // 112
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSETimestamp,              // 32
-    MSEOrientation,            // 48
-    MSESplineElevation,        // 144
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementStopTurn[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEHasGuidByte3,           // 19
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte6,           // 22
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasUnkTime,             // 168
-    MSEHasTimestamp,           // 32
-    MSEZeroBit,                // 149
-    MSEUnkUIntCount,           // 152
-    MSEHasMovementFlags,       // 24
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 148
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 172
-    MSEHasPitch,               // 112
-    MSEHasFallData,            // 140
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportTime2,      // 92
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEGuidByte1,              // 17
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte5,              // 21
-    MSEGuidByte4,              // 20
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte7,              // 23
-    MSEGuidByte6,              // 22
-    MSEGuidByte3,              // 19
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportPositionZ,     // 72
-    MSETransportPositionY,     // 68
-    MSETransportSeat,          // 80
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte2,     // 58
-    MSETransportTime2,         // 88
-    MSETransportTime,          // 84
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte0,     // 56
-    MSEUnkTime,                // 168
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSETimestamp,              // 32
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartAscend[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEHasGuidByte7,           // 23
-    MSEHasMovementFlags,       // 24
-    MSEZeroBit,                // 148
-    MSEHasGuidByte2,           // 18
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte3,           // 19
-    MSEZeroBit,                // 149
-    MSEHasGuidByte4,           // 20
-    MSEHasOrientation,         // 48
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte0,           // 16
-    MSEHasSplineElevation,     // 144
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportData,       // 104
-    MSEHasFallData,            // 140
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 172
-    MSEHasUnkTime,             // 168
-    MSEHasPitch,               // 112
-    MSEMovementFlags2,         // 28
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte1,  // 57
-    MSEMovementFlags,          // 24
-    MSEHasFallDirection,       // 136
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte4,              // 20
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte3,              // 19
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEGuidByte5,              // 21
-    MSEGuidByte6,              // 22
-    MSEFallTime,               // 116
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSETransportPositionZ,     // 72
-    MSETransportSeat,          // 80
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionX,     // 64
-    MSETransportTime2,         // 88
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte3,     // 59
-    MSETransportTime3,         // 96
-    MSETransportOrientation,   // 76
-    MSETransportPositionY,     // 68
-    MSETransportTime,          // 84
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte2,     // 58
-    MSESplineElevation,        // 144
-    MSEUnkTime,                // 168
-    MSETimestamp,              // 32
-    MSEPitch,                  // 112
-    MSEOrientation,            // 48
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartDescend[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEZeroBit,                // 149
-    MSEHasGuidByte1,           // 17
-    MSEHasPitch,               // 112
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 148
-    MSEHasMovementFlags,       // 24
-    MSEHasUnkTime,             // 168
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte7,           // 23
-    MSEZeroBit,                // 172
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte3,           // 19
-    MSEHasTimestamp,           // 32
-    MSEHasOrientation,         // 48
-    MSEHasTransportData,       // 104
-    MSEHasSplineElevation,     // 144
-    MSEHasFallData,            // 140
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime3,      // 100
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte3,              // 19
-    MSEGuidByte5,              // 21
-    MSEGuidByte6,              // 22
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEGuidByte0,              // 16
-    MSEGuidByte4,              // 20
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte2,              // 18
-    MSETransportTime,          // 84
-    MSETransportPositionX,     // 64
-    MSETransportPositionY,     // 68
-    MSETransportOrientation,   // 76
-    MSETransportTime2,         // 88
-    MSETransportPositionZ,     // 72
-    MSETransportSeat,          // 80
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte4,     // 60
-    MSETransportTime3,         // 96
-    MSETransportGuidByte5,     // 61
-    MSEUnkTime,                // 168
-    MSESplineElevation,        // 144
-    MSEFallVerticalSpeed,      // 120
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallTime,               // 116
-    MSEPitch,                  // 112
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartSwim[] = // 5.4.7 18019
-{
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEHasGuidByte3,           // 19
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte4,           // 20
-    MSEZeroBit,                // 149
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte0,           // 16
-    MSEHasMovementFlags,       // 24
-    MSEHasSplineElevation,     // 144
-    MSEHasPitch,               // 112
-    MSEHasFallData,            // 140
-    MSEHasMovementFlags2,      // 28
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte6,           // 22
-    MSEHasUnkTime,             // 168
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 148
-    MSEHasOrientation,         // 48
-    MSEZeroBit,                // 172
-    MSEHasGuidByte1,           // 17
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte1,  // 57
-    MSEMovementFlags,          // 24
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte5,              // 21
-    MSEGuidByte2,              // 18
-    MSEGuidByte7,              // 23
-    MSEGuidByte0,              // 16
-    MSEGuidByte4,              // 20
-    MSEGuidByte1,              // 17
-    MSEGuidByte6,              // 22
-    MSEGuidByte3,              // 19
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionZ,     // 72
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionX,     // 64
-    MSETransportTime2,         // 88
-    MSETransportTime,          // 84
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSETransportSeat,          // 80
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte6,     // 62
-    MSEOrientation,            // 48
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSESplineElevation,        // 144
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementStopSwim[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEZeroBit,                // 148
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte3,           // 19
-    MSEHasFallData,            // 140
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte7,           // 23
-    MSEZeroBit,                // 172
-    MSEHasGuidByte6,           // 22
-    MSEHasGuidByte1,           // 17
-    MSEZeroBit,                // 149
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte5,           // 21
-    MSEHasPitch,               // 112
-    MSEUnkUIntCount,           // 152
-    MSEHasMovementFlags2,      // 28
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte2,           // 18
-    MSEHasTimestamp,           // 32
-    MSEMovementFlags,          // 24
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportTime3,      // 100
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte4,              // 20
-    MSEGuidByte1,              // 17
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEGuidByte2,              // 18
-    MSEGuidByte0,              // 16
-    MSEGuidByte6,              // 22
-    MSEGuidByte7,              // 23
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionX,     // 64
-    MSETransportTime,          // 84
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionZ,     // 72
-    MSETransportSeat,          // 80
-    MSETransportGuidByte3,     // 59
-    MSETransportOrientation,   // 76
-    MSETransportTime2,         // 88
-    MSEUnkTime,                // 168
-    MSETimestamp,              // 32
-    MSESplineElevation,        // 144
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementStopAscend[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEHasPitch,               // 112
-    MSEHasGuidByte7,           // 23
-    MSEHasMovementFlags2,      // 28
-    MSEHasTimestamp,           // 32
-    MSEHasFallData,            // 140
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte0,           // 16
-    MSEZeroBit,                // 148
-    MSEHasGuidByte2,           // 18
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 172
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte4,           // 20
-    MSEZeroBit,                // 149
-    MSEHasGuidByte1,           // 17
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte6,           // 22
-    MSEUnkUIntCount,           // 152
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte3,           // 19
-    MSEHasOrientation,         // 48
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte2,              // 18
-    MSEGuidByte0,              // 16
-    MSEGuidByte3,              // 19
-    MSEGuidByte7,              // 23
-    MSEGuidByte1,              // 17
-    MSEGuidByte6,              // 22
-    MSEGuidByte4,              // 20
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte5,              // 21
-    MSESplineElevation,        // 144
-    MSETransportOrientation,   // 76
-    MSETransportPositionZ,     // 72
-    MSETransportTime2,         // 88
-    MSETransportSeat,          // 80
-    MSETransportTime,          // 84
-    MSETransportGuidByte6,     // 62
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte7,     // 63
-    MSETransportTime3,         // 96
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte1,     // 57
-    MSEOrientation,            // 48
-    MSEPitch,                  // 112
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementStopPitch[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEHasFallData,            // 140
-    MSEHasGuidByte6,           // 22
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte5,           // 21
-    MSEZeroBit,                // 172
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte3,           // 19
-    MSEHasMovementFlags2,      // 28
-    MSEHasPitch,               // 112
-    MSEZeroBit,                // 149
-    MSEHasOrientation,         // 48
-    MSEZeroBit,                // 148
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte2,           // 18
-    MSEHasMovementFlags,       // 24
-    MSEHasUnkTime,             // 168
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte1,           // 17
-    MSEHasSplineElevation,     // 144
-    MSEHasTimestamp,           // 32
-    MSEMovementFlags,          // 24
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime3,      // 100
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEGuidByte3,              // 19
-    MSEGuidByte4,              // 20
-    MSEGuidByte5,              // 21
-    MSEGuidByte0,              // 16
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte2,              // 18
-    MSEGuidByte6,              // 22
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte3,     // 59
-    MSETransportSeat,          // 80
-    MSETransportGuidByte5,     // 61
-    MSETransportTime,          // 84
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionZ,     // 72
-    MSETransportTime3,         // 96
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte1,     // 57
-    MSETransportOrientation,   // 76
-    MSETransportTime2,         // 88
-    MSETransportGuidByte0,     // 56
-    MSEUnkTime,                // 168
-    MSEFallTime,               // 116
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallVerticalSpeed,      // 120
-    MSESplineElevation,        // 144
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartPitchDown[] = // 5.4.7 18019
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEZeroBit,                // 172
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 148
-    MSEHasPitch,               // 112
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte3,           // 19
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte4,           // 20
-    MSEHasTimestamp,           // 32
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte7,           // 23
-    MSEHasOrientation,         // 48
-    MSEZeroBit,                // 149
-    MSEHasFallData,            // 140
-    MSEHasMovementFlags2,      // 28
-    MSEHasUnkTime,             // 168
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte0,           // 16
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte6,           // 22
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEGuidByte4,              // 20
-    MSEGuidByte1,              // 17
-    MSEGuidByte7,              // 23
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte6,              // 22
-    MSEGuidByte3,              // 19
-    MSEGuidByte5,              // 21
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSETransportGuidByte4,     // 60
-    MSETransportSeat,          // 80
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte1,     // 57
-    MSETransportPositionX,     // 64
-    MSETransportTime2,         // 88
-    MSETransportGuidByte0,     // 56
-    MSETransportOrientation,   // 76
-    MSETransportTime,          // 84
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte2,     // 58
-    MSETransportTime3,         // 96
-    MSETransportGuidByte3,     // 59
-    MSEUnkTime,                // 168
-    MSESplineElevation,        // 144
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementStartPitchUp[] = // 5.4.7 18019
-{
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEZeroBit,                // 172
-    MSEHasGuidByte5,           // 21
-    MSEHasPitch,               // 112
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 148
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte1,           // 17
-    MSEHasSplineElevation,     // 144
-    MSEHasTimestamp,           // 32
-    MSEHasMovementFlags,       // 24
-    MSEHasMovementFlags2,      // 28
-    MSEHasUnkTime,             // 168
-    MSEHasFallData,            // 140
-    MSEZeroBit,                // 149
-    MSEHasGuidByte6,           // 22
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte3,           // 19
-    MSEHasOrientation,         // 48
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte0,           // 16
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte5,  // 61
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEHasFallDirection,       // 136
-    MSEGuidByte4,              // 20
-    MSEGuidByte7,              // 23
-    MSEGuidByte3,              // 19
-    MSEGuidByte2,              // 18
-    MSEGuidByte5,              // 21
-    MSEGuidByte1,              // 17
-    MSEGuidByte0,              // 16
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte6,              // 22
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte7,     // 63
-    MSETransportTime2,         // 88
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte2,     // 58
-    MSETransportTime3,         // 96
-    MSETransportPositionY,     // 68
-    MSETransportOrientation,   // 76
-    MSETransportTime,          // 84
-    MSETransportSeat,          // 80
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSESplineElevation,        // 144
-    MSEPitch,                  // 112
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MoveChngTransport[]=
-{
-    MSEPositionY,
-    MSEPositionZ,
-    MSEPositionX,
-    MSEHasSpline,
-    MSEHasUnkTime,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasPitch,
-    MSEHasTimestamp,
-    MSEHasTransportData,
-    MSEHasGuidByte4,
-    MSEHasFallData,
-    MSEHasGuidByte1,
-    MSEHasOrientation,
-    MSEHasGuidByte0,
-    MSEHasGuidByte2,
-    MSEZeroBit,
-    MSEHasGuidByte5,
-    MSEHasMovementFlags,
-    MSEHasGuidByte3,
-    MSEHasSplineElevation,
-    MSEZeroBit,
-    MSEHasMovementFlags2,
-    MSEUnkUIntCount,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportTime2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte0,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEGuidByte5,
-    MSEUnkUIntLoop,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSETransportOrientation,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportPositionZ,
-    MSETransportGuidByte1,
-    MSETransportGuidByte7,
-    MSETransportTime2,
-    MSETransportGuidByte2,
-    MSETransportSeat,
-    MSETransportGuidByte0,
-    MSETransportGuidByte5,
-    MSETransportTime3,
-    MSETransportPositionY,
-    MSETransportPositionX,
-    MSETransportTime,
-    MSETransportGuidByte6,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEPitch,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEUnkTime,
-    MSETimestamp,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSplineDone[] =
-{
-    MSEPositionY,
-    MSEPositionX,
-    MSEPositionZ,
-    MSEHasGuidByte6,
-    MSEHasOrientation,
-    MSEHasFallData,
-    MSEHasTimestamp,
-    MSEHasGuidByte2,
-    MSEHasSplineElevation,
-    MSEHasGuidByte4,
-    MSEHasTransportData,
-    MSEHasGuidByte3,
-    MSEHasMovementFlags,
-    MSEHasGuidByte0,
-    MSEZeroBit,
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasPitch,
-    MSEHasSpline,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte7,
-
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte0,
-
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte2,
-    MSEGuidByte3,
-
-    MSEFallVerticalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-
-    MSEPitch,
-    MSEOrientation,
-
-    MSETransportGuidByte1,
-    MSETransportTime3,
-    MSETransportGuidByte7,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSETransportPositionX,
-    MSETransportPositionZ,
-    MSETransportSeat,
-    MSETransportOrientation,
-    MSETransportGuidByte0,
-    MSETransportTime2,
-    MSETransportGuidByte2,
-    MSETransportGuidByte3,
-    MSETransportGuidByte5,
-    MSETransportGuidByte6,
-    MSETransportGuidByte4,
-
-    MSETimestamp,
-    MSESplineElevation,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveNotActiveMover[] =
-{
-    MSEPositionZ,
-    MSEPositionX,
-    MSEPositionY,
-    MSEHasMovementFlags2,
-    MSEHasTransportData,
-    MSEHasGuidByte6,
-    MSEHasSplineElevation,
-    MSEHasGuidByte3,
-    MSEZeroBit,
-    MSEHasTimestamp,
-    MSEHasGuidByte0,
-    MSEHasOrientation,
-    MSEHasGuidByte5,
-    MSEHasPitch,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasSpline,
-    MSEHasGuidByte2,
-    MSEHasFallData,
-    MSEHasMovementFlags,
-
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte3,
-
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte7,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte3,
-
-    MSEFallVerticalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-
-    MSETransportTime3,
-    MSETransportGuidByte1,
-    MSETransportTime2,
-    MSETransportOrientation,
-    MSETransportGuidByte0,
-    MSETransportSeat,
-    MSETransportGuidByte4,
-    MSETransportGuidByte6,
-    MSETransportGuidByte3,
-    MSETransportGuidByte5,
-    MSETransportPositionY,
-    MSETransportPositionX,
-    MSETransportGuidByte2,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportTime,
-
-    MSETimestamp,
-    MSESplineElevation,
-    MSEPitch,
-    MSEOrientation,
-
-    MSEEnd,
-};
-
-MovementStatusElements const DismissControlledVehicle[] =
-{
-    MSEPositionY,
-    MSEPositionZ,
-    MSEPositionX,
-    MSEZeroBit,
-    MSEHasUnkTime,
-    MSEHasMovementFlags,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasTimestamp,
-    MSEUnkUIntCount,
-    MSEHasPitch,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSEHasGuidByte0,
-    MSEHasSplineElevation,
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte6,
-    MSEHasSpline,
-    MSEHasTransportData,
-    MSEHasGuidByte1,
-    MSEHasFallData,
-    MSEHasOrientation,
-    MSEHasMovementFlags2,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte1,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEGuidByte5,
-    MSEUnkUIntLoop,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSETransportGuidByte1,
-    MSETransportGuidByte5,
-    MSETransportTime3,
-    MSETransportGuidByte0,
-    MSETransportPositionX,
-    MSETransportOrientation,
-    MSETransportGuidByte3,
-    MSETransportGuidByte2,
-    MSETransportTime2,
-    MSETransportTime,
-    MSETransportGuidByte4,
-    MSETransportPositionY,
-    MSETransportPositionZ,
-    MSETransportGuidByte6,
-    MSETransportSeat,
-    MSETransportGuidByte7,
-    MSETimestamp,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEPitch,
-    MSEUnkTime,
-    MSEOrientation,
-    MSESplineElevation,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveUpdateTeleport[] =
-{
-    MSEPositionZ,
-    MSEPositionY,
-    MSEPositionX,
-    MSEHasOrientation,
-
-    MSEHasSpline,
-    MSEHasMovementFlags,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte6,
-    MSEHasFallData,
-    MSEHasGuidByte0,
-    MSEHasTransportData,
-    MSEHasGuidByte5,
-
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte2,
-
-    MSEZeroBit,
-
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasPitch,
-    MSEHasMovementFlags2,
-    MSEHasTimestamp,
-
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEHasSplineElevation,
-    MSEMovementFlags,
-    MSEHasGuidByte1,
-
-    MSEGuidByte7,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportOrientation,
-    MSETransportTime3,
-    MSETransportGuidByte1,
-    MSETransportTime2,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportGuidByte0,
-    MSETransportGuidByte6,
-    MSETransportGuidByte5,
-    MSETransportGuidByte2,
-    MSETransportSeat,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSETransportPositionX,
-
-    MSEGuidByte6,
-    MSEPitch,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte1,
-
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSETimestamp,
-    MSEGuidByte0,
-
-    MSEEnd,
-};
-
-MovementStatusElements const MovementSetRunMode[] =
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEHasGuidByte1,           // 17
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 149
-    MSEHasTransportData,       // 104
-    MSEZeroBit,                // 148
-    MSEHasGuidByte5,           // 21
-    MSEHasGuidByte6,           // 22
-    MSEHasMovementFlags,       // 24
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte0,           // 16
-    MSEHasTimestamp,           // 32
-    MSEUnkUIntCount,           // 152
-    MSEHasPitch,               // 112
-    MSEHasUnkTime,             // 168
-    MSEZeroBit,                // 172
-    MSEHasOrientation,         // 48
-    MSEHasFallData,            // 140
-    MSEHasGuidByte3,           // 19
-    MSEHasSplineElevation,     // 144
-    MSEHasGuidByte4,           // 20
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime2,      // 92
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEHasFallDirection,       // 136
-    MSEGuidByte1,              // 17
-    MSEGuidByte2,              // 18
-    MSEGuidByte3,              // 19
-    MSEGuidByte5,              // 21
-    MSEGuidByte7,              // 23
-    MSEGuidByte6,              // 22
-    MSECounter,                // 156
-    MSEGuidByte4,              // 20
-    MSEGuidByte0,              // 16
-    MSEPitch,                  // 112
-    MSETimestamp,              // 32
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte5,     // 61
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionY,     // 68
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte1,     // 57
-    MSETransportTime,          // 84
-    MSETransportTime3,         // 96
-    MSETransportPositionZ,     // 72
-    MSETransportTime2,         // 88
-    MSETransportSeat,          // 80
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte4,     // 60
-    MSETransportGuidByte6,     // 62
-    MSEFallSinAngle,           // 128
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallVerticalSpeed,      // 120
-    MSEFallTime,               // 116
-    MSEUnkTime,                // 168
-    MSEOrientation,            // 48
-    MSESplineElevation,        // 144
-    MSEEnd
-};
-
-MovementStatusElements const MovementSetWalkMode[] =
-{
-    MSEPositionZ,              // 44
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEHasTimestamp,           // 32
-    MSEHasGuidByte5,           // 21
-    MSEHasMovementFlags,       // 24
-    MSEZeroBit,                // 148
-    MSEHasGuidByte0,           // 16
-    MSEZeroBit,                // 172
-    MSEHasPitch,               // 112
-    MSEHasTransportData,       // 104
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte4,           // 20
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte3,           // 19
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte1,           // 17
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte6,           // 22
-    MSEHasSplineElevation,     // 144
-    MSEZeroBit,                // 149
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte2,           // 18
-    MSEHasFallData,            // 140
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportTime3,      // 100
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSEGuidByte0,              // 16
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEGuidByte2,              // 18
-    MSEGuidByte1,              // 17
-    MSEGuidByte4,              // 20
-    MSECounter,                // 156
-    MSEGuidByte6,              // 22
-    MSEGuidByte7,              // 23
-    MSEFallVerticalSpeed,      // 120
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallTime,               // 116
-    MSEPitch,                  // 112
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte7,     // 63
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte2,     // 58
-    MSETransportGuidByte4,     // 60
-    MSETransportPositionX,     // 64
-    MSETransportGuidByte1,     // 57
-    MSETransportTime3,         // 96
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte6,     // 62
-    MSETransportTime,          // 84
-    MSETransportGuidByte3,     // 59
-    MSETransportTime2,         // 88
-    MSETransportOrientation,   // 76
-    MSESplineElevation,        // 144
-    MSETimestamp,              // 32
-    MSEOrientation,            // 48
-    MSEUnkTime,                // 168
-    MSEEnd
-};
-
-MovementStatusElements const MovementSetCanFly[] =
-{
-    MSEPositionY,              // 40
-    MSEPositionX,              // 36
-    MSEPositionZ,              // 44
-    MSEHasFallData,            // 140
-    MSEHasGuidByte0,           // 16
-    MSEHasMovementFlags2,      // 28
-    MSEHasGuidByte6,           // 22
-    MSEHasMovementFlags,       // 24
-    MSEZeroBit,                // 172
-    MSEHasGuidByte2,           // 18
-    MSEHasOrientation,         // 48
-    MSEHasUnkTime,             // 168
-    MSEHasSplineElevation,     // 144
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte5,           // 21
-    MSEHasPitch,               // 112
-    MSEZeroBit,                // 148
-    MSEHasGuidByte4,           // 20
-    MSEHasTimestamp,           // 32
-    MSEUnkUIntCount,           // 152
-    MSEZeroBit,                // 149
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte3,           // 19
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportTime2,      // 92
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags,          // 24
-    MSEMovementFlags2,         // 28
-    MSECounter,                // 156
-    MSEGuidByte4,              // 20
-    MSEGuidByte2,              // 18
-    MSEGuidByte6,              // 22
-    MSEGuidByte3,              // 19
-    MSEGuidByte0,              // 16
-    MSEGuidByte7,              // 23
-    MSEGuidByte1,              // 17
-    MSEGuidByte5,              // 21
-    MSEUnkTime,                // 168
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte4,     // 60
-    MSETransportTime,          // 84
-    MSETransportGuidByte3,     // 59
-    MSETransportGuidByte6,     // 62
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte0,     // 56
-    MSETransportPositionZ,     // 72
-    MSETransportPositionX,     // 64
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportTime2,         // 88
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte2,     // 58
-    MSETransportTime3,         // 96
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallSinAngle,           // 128
-    MSEFallTime,               // 116
-    MSEFallVerticalSpeed,      // 120
-    MSESplineElevation,        // 144
-    MSEOrientation,            // 48
-    MSETimestamp,              // 32
-    MSEPitch,                  // 112
-    MSEEnd
-};
-
-MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
-{
-    MSEPositionZ,
-    MSEPositionY,
-    MSECounter,
-    MSEPositionX,
-    MSEHasGuidByte3,
-    MSEHasOrientation,
-    MSEHasTransportData,
-    MSEHasMovementFlags,
-    MSEHasMovementFlags2,
-    MSEHasSplineElevation,
-    MSEHasTimestamp,
-    MSEHasSpline,
-    MSEZeroBit,
-    MSEHasFallData,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasPitch,
-    MSEHasGuidByte7,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte1,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte6,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-    MSETransportPositionY,
-    MSETransportPositionZ,
-    MSETransportGuidByte5,
-    MSETransportGuidByte1,
-    MSETransportGuidByte4,
-    MSETransportTime,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETransportGuidByte0,
-    MSETransportGuidByte2,
-    MSETransportGuidByte7,
-    MSETransportPositionX,
-    MSETransportTime2,
-    MSETransportGuidByte6,
-    MSETransportOrientation,
-    MSETransportTime3,
-    MSEPitch,
-    MSEOrientation,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateSwimSpeed[] =
-{
-    MSEHasMovementFlags,
-    MSEHasGuidByte2,
-    MSEMovementFlags,
-    MSEHasGuidByte3,
-    MSEZeroBit,
-    MSEHasGuidByte7,
-    MSEHasFallDirection,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasOrientation,
-    MSEHasGuidByte1,
-    MSETransportGuidByte2,
-    MSETransportPositionX,
-    MSETransportGuidByte6,
-    MSETransportOrientation,
-    MSETransportGuidByte0,
-    MSETransportGuidByte4,
-    MSETransportPositionY,
-    MSETransportTime,
-    MSETransportGuidByte1,
-    MSETransportGuidByte7,
-    MSETransportPositionZ,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETransportGuidByte5,
-    MSEPositionX,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEGuidByte7,
-    MSETimestamp,
-    MSEPositionY,
-    MSEPositionZ,
-    MSEExtraElement,
-    MSEGuidByte4,
-    MSEOrientation,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateRunSpeed[] =
-{
-    MSEPositionZ,
-    MSEPositionX,
-    MSEPositionY,
-    MSEExtraElement,
-    MSEHasGuidByte6,
-    MSEHasMovementFlags2,
-    MSEHasPitch,
-    MSEHasGuidByte2,
-    MSEHasGuidByte5,
-    MSEHasSplineElevation,
-    MSEHasSpline,
-    MSEHasMovementFlags,
-    MSEHasTimestamp,
-    MSEHasGuidByte1,
-    MSEMovementFlags2,
-    MSEHasGuidByte3,
-    MSEMovementFlags,
-    MSEHasGuidByte7,
-    MSEHasGuidByte0,
-    MSEHasOrientation,
-    MSEHasTransportData,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte0,
-    MSEHasFallData,
-    MSEHasFallDirection,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSETransportGuidByte4,
-    MSETransportGuidByte5,
-    MSETransportPositionX,
-    MSETransportOrientation,
-    MSETransportGuidByte1,
-    MSETransportGuidByte0,
-    MSETransportGuidByte6,
-    MSETransportTime,
-    MSETransportGuidByte7,
-    MSETransportSeat,
-    MSETransportTime2,
-    MSETransportPositionY,
-    MSETransportGuidByte3,
-    MSETransportGuidByte2,
-    MSETransportTime3,
-    MSETransportPositionZ,
-    MSETimestamp,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEPitch,
-    MSEGuidByte6,
-    MSESplineElevation,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEOrientation,
-    MSEGuidByte0,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateFlightSpeed[] =
-{
-    MSEPositionY,
-    MSEExtraElement,
-    MSEPositionX,
-    MSEPositionZ,
-    MSEHasMovementFlags,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEMovementFlags,
-    MSEHasGuidByte2,
-    MSEHasOrientation,
-    MSEHasGuidByte7,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasFallDirection,
-    MSEHasGuidByte0,
-    MSEPitch,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportGuidByte5,
-    MSETransportGuidByte4,
-    MSETransportGuidByte6,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportGuidByte0,
-    MSETransportGuidByte2,
-    MSETransportGuidByte3,
-    MSETransportPositionY,
-    MSETransportGuidByte1,
-    MSETransportSeat,
-    MSETransportPositionX,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSETimestamp,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSEOrientation,
-    MSEGuidByte3,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateCollisionHeight[] =
-{
-    MSEPositionZ,
-    MSEExtraElement,
-    MSEPositionX,
-    MSEPositionY,
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasOrientation,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEZeroBit,
-    MSEHasGuidByte2,
-    MSEHasMovementFlags,
-    MSEHasFallDirection,
-    MSEHasGuidByte1,
-    MSEMovementFlags,
-    MSEGuidByte3,
-    MSETransportGuidByte7,
-    MSETransportTime,
-    MSETransportGuidByte4,
-    MSETransportGuidByte5,
-    MSETransportOrientation,
-    MSETransportPositionX,
-    MSETransportGuidByte6,
-    MSETransportGuidByte0,
-    MSETransportPositionY,
-    MSETransportGuidByte2,
-    MSETransportPositionZ,
-    MSETransportGuidByte3,
-    MSETransportGuidByte1,
-    MSETransportSeat,
-    MSEPitch,
-    MSEGuidByte6,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEGuidByte7,
-    MSEOrientation,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSETimestamp,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementForceRunSpeedChangeAck[] =
-{
-    MSECounter,
-    MSEPositionX,
-    MSEExtraElement,
-    MSEPositionZ,
-    MSEPositionY,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasOrientation,
-    MSEHasFallData,
-    MSEHasGuidByte0,
-    MSEHasSpline,
-    MSEHasTransportData,
-    MSEHasTimestamp,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte6,
-    MSEZeroBit,
-    MSEHasSplineElevation,
-    MSEHasPitch,
-    MSEHasGuidByte5,
-    MSEHasMovementFlags,
-    MSEHasGuidByte3,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte4,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEGuidByte2,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSETransportPositionZ,
-    MSETransportGuidByte6,
-    MSETransportGuidByte1,
-    MSETransportPositionY,
-    MSETransportGuidByte0,
-    MSETransportGuidByte5,
-    MSETransportTime2,
-    MSETransportPositionX,
-    MSETransportTime,
-    MSETransportGuidByte7,
-    MSETransportOrientation,
-    MSETransportGuidByte3,
-    MSETransportTime3,
-    MSETransportGuidByte2,
-    MSETransportSeat,
-    MSETransportGuidByte4,
-    MSEFallVerticalSpeed,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSESplineElevation,
-    MSEPitch,
-    MSETimestamp,
-    MSEOrientation,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementSetCollisionHeightAck[] =
-{
-    MSEPositionX,
-    MSEGenericDword0,
-    MSEGenericDword1,
-    MSECounter,
-    MSEPositionZ,
-    MSEPositionY,
-    MSEHasUnkTime,
-    MSEZeroBit,
-    MSEHasMovementFlags,
-    MSEZeroBit,
-    MSEHasFallData,
-    MSEHasTimestamp,
-    MSEHasGuidByte4,
-    MSEHasPitch,
-    MSEHasSpline,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasSplineElevation,
-    MSEHasGuidByte3,
-    MSEHasOrientation,
-    MSEHasGuidByte2,
-    MSEUnkUIntCount,
-    MSEGeneric2bits0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasMovementFlags2,
-    MSEHasTransportData,
-    MSEHasGuidByte7,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEUnkUIntLoop,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSETransportGuidByte1,
-    MSETransportTime3,
-    MSETransportPositionZ,
-    MSETransportPositionY,
-    MSETransportSeat,
-    MSETransportGuidByte7,
-    MSETransportGuidByte6,
-    MSETransportGuidByte3,
-    MSETransportOrientation,
-    MSETransportPositionX,
-    MSETransportGuidByte5,
-    MSETransportTime2,
-    MSETransportGuidByte0,
-    MSETransportGuidByte4,
-    MSETransportTime,
-    MSETransportGuidByte2,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEUnkTime,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementForceFlightSpeedChangeAck[] =
-{
-    MSECounter,
-    MSEPositionZ,
-    MSEPositionX,
-    MSEPositionY,
-    MSEExtraElement,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEZeroBit,
-    MSEHasMovementFlags,
-    MSEHasSplineElevation,
-    MSEHasGuidByte3,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte7,
-    MSEHasTransportData,
-    MSEHasGuidByte0,
-    MSEHasFallData,
-    MSEHasTimestamp,
-    MSEHasPitch,
-    MSEHasSpline,
-    MSEHasOrientation,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte4,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSETransportGuidByte6,
-    MSETransportGuidByte0,
-    MSETransportSeat,
-    MSETransportTime2,
-    MSETransportOrientation,
-    MSETransportGuidByte1,
-    MSETransportGuidByte5,
-    MSETransportTime3,
-    MSETransportGuidByte2,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportPositionX,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEPitch,
-    MSEOrientation,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementSetCanFlyAck[] =
-{
-    MSEPositionY,
-    MSEPositionX,
-    MSEPositionZ,
-    MSECounter,
-    MSEHasPitch,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEHasUnkTime,
-    MSEHasOrientation,
-    MSEHasGuidByte6,
-    MSEHasMovementFlags,
-    MSEHasTimestamp,
-    MSEHasGuidByte0,
-    MSEHasMovementFlags2,
-    MSEUnkUIntCount,
-    MSEZeroBit,
-    MSEHasGuidByte4,
-    MSEHasTransportData,
-    MSEHasSpline,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasSplineElevation,
-    MSEHasGuidByte7,
-    MSEHasFallData,
-    MSEZeroBit,
-    MSEMovementFlags2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte5,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEUnkUIntLoop,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSETransportGuidByte6,
-    MSETransportTime3,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETransportGuidByte1,
-    MSETransportGuidByte0,
-    MSETransportGuidByte2,
-    MSETransportTime2,
-    MSETransportGuidByte5,
-    MSETransportPositionX,
-    MSETransportGuidByte4,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-    MSETimestamp,
-    MSEOrientation,
-    MSESplineElevation,
-    MSEPitch,
-    MSEUnkTime,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementForceSwimSpeedChangeAck[] =
-{
-    MSEPositionX,
-    MSECounter,
-    MSEExtraElement,
-    MSEPositionY,
-    MSEPositionZ,
-    MSEHasGuidByte4,
-    MSEHasOrientation,
-    MSEHasPitch,
-    MSEHasTransportData,
-    MSEHasMovementFlags,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasFallData,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasTimestamp,
-    MSEZeroBit,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasSplineElevation,
-    MSEHasSpline,
-    MSEHasGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportTime2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte2,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSETransportGuidByte0,
-    MSETransportTime3,
-    MSETransportTime2,
-    MSETransportPositionX,
-    MSETransportGuidByte7,
-    MSETransportSeat,
-    MSETransportPositionY,
-    MSETransportGuidByte5,
-    MSETransportPositionZ,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportGuidByte2,
-    MSETransportGuidByte6,
-    MSETransportGuidByte3,
-    MSETransportGuidByte1,
-    MSETransportGuidByte4,
-    MSEFallTime,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallVerticalSpeed,
-    MSEOrientation,
-    MSEPitch,
-    MSESplineElevation,
-    MSETimestamp,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementForceWalkSpeedChangeAck[] =
-{
-    MSEPositionZ,
-    MSEPositionY,
-    MSEExtraElement,
-    MSEPositionX,
-    MSECounter,
-    MSEHasGuidByte0,
-    MSEHasMovementFlags2,
-    MSEHasTimestamp,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasMovementFlags,
-    MSEHasFallData,
-    MSEHasOrientation,
-    MSEHasSpline,
-    MSEZeroBit,
-    MSEHasGuidByte3,
-    MSEHasGuidByte1,
-    MSEHasSplineElevation,
-    MSEHasTransportData,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasPitch,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte3,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEFallVerticalSpeed,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallTime,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportGuidByte5,
-    MSETransportPositionX,
-    MSETransportGuidByte0,
-    MSETransportTime,
-    MSETransportTime3,
-    MSETransportPositionY,
-    MSETransportGuidByte2,
-    MSETransportGuidByte4,
-    MSETransportGuidByte1,
-    MSETransportGuidByte3,
-    MSETransportOrientation,
-    MSETransportSeat,
-    MSETransportGuidByte6,
-    MSETransportTime2,
-    MSESplineElevation,
-    MSETimestamp,
-    MSEOrientation,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementForceRunBackSpeedChangeAck[] =
-{
-    MSEExtraElement,
-    MSECounter,
-    MSEPositionX,
-    MSEPositionZ,
-    MSEPositionY,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasTimestamp,
-    MSEHasTransportData,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasOrientation,
-    MSEHasFallData,
-    MSEHasMovementFlags2,
-    MSEHasMovementFlags,
-    MSEHasGuidByte7,
-    MSEHasSpline,
-    MSEHasPitch,
-    MSEHasGuidByte6,
-    MSEHasSplineElevation,
-    MSEZeroBit,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte5,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEGuidByte0,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte1,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSETransportGuidByte5,
-    MSETransportSeat,
-    MSETransportGuidByte6,
-    MSETransportGuidByte1,
-    MSETransportGuidByte0,
-    MSETransportGuidByte2,
-    MSETransportPositionY,
-    MSETransportTime3,
-    MSETransportPositionX,
-    MSETransportOrientation,
-    MSETransportGuidByte3,
-    MSETransportTime,
-    MSETransportTime2,
-    MSETransportGuidByte4,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateRunBackSpeed[] =
-{
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEZeroBit,
-    MSEHasMovementFlags,
-    MSEHasGuidByte5,
-    MSEHasOrientation,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte0,
-    MSEHasGuidByte7,
-    MSETransportPositionX,
-    MSETransportGuidByte2,
-    MSETransportGuidByte5,
-    MSETransportGuidByte4,
-    MSETransportGuidByte6,
-    MSETransportGuidByte0,
-    MSETransportGuidByte3,
-    MSETransportPositionY,
-    MSETransportGuidByte7,
-    MSETransportPositionZ,
-    MSETransportTime,
-    MSETransportSeat,
-    MSETransportGuidByte1,
-    MSETransportOrientation,
-    MSEGuidByte4,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSETimestamp,
-    MSEGuidByte1,
-    MSEOrientation,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEPositionX,
-    MSEPositionY,
-    MSEPitch,
-    MSEGuidByte7,
-    MSEExtraElement,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEPositionZ,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateWalkSpeed[] =
-{
-    MSEHasOrientation,
-    MSEZeroBit,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte5,
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasMovementFlags,
-    MSEHasGuidByte6,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEHasGuidByte4,
-    MSEPitch,
-    MSETransportGuidByte6,
-    MSETransportGuidByte0,
-    MSETransportGuidByte4,
-    MSETransportGuidByte2,
-    MSETransportPositionX,
-    MSETransportGuidByte7,
-    MSETransportTime,
-    MSETransportPositionZ,
-    MSETransportSeat,
-    MSETransportGuidByte5,
-    MSETransportOrientation,
-    MSETransportGuidByte1,
-    MSETransportPositionY,
-    MSETransportGuidByte3,
-    MSEFallVerticalSpeed,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSETimestamp,
-    MSEOrientation,
-    MSEPositionY,
-    MSEGuidByte0,
-    MSEPositionZ,
-    MSEPositionX,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEExtraElement,
-    MSEEnd,
-};
-
-MovementStatusElements const ForceMoveRootAck[] =
-{
-    MSEPositionY,
-    MSEPositionZ,
-    MSECounter,
-    MSEPositionX,
-    MSEHasGuidByte3,
-    MSEHasTimestamp,
-    MSEHasTransportData,
-    MSEHasPitch,
-    MSEHasGuidByte2,
-    MSEHasOrientation,
-    MSEHasSplineElevation,
-    MSEHasFallData,
-    MSEHasSpline,
-    MSEHasGuidByte4,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasMovementFlags2,
-    MSEHasMovementFlags,
-    MSEZeroBit,
-    MSEHasGuidByte5,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte5,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSETransportGuidByte5,
-    MSETransportGuidByte4,
-    MSETransportOrientation,
-    MSETransportPositionZ,
-    MSETransportTime3,
-    MSETransportTime2,
-    MSETransportGuidByte7,
-    MSETransportGuidByte2,
-    MSETransportGuidByte0,
-    MSETransportTime,
-    MSETransportGuidByte6,
-    MSETransportGuidByte3,
-    MSETransportPositionX,
-    MSETransportGuidByte1,
-    MSETransportPositionY,
-    MSETransportSeat,
-    MSETimestamp,
-    MSEFallVerticalSpeed,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallTime,
-    MSEOrientation,
-    MSESplineElevation,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const ForceMoveUnrootAck[] =
-{
-    MSECounter,
-    MSEPositionZ,
-    MSEPositionY,
-    MSEPositionX,
-    MSEHasGuidByte7,
-    MSEHasSplineElevation,
-    MSEHasSpline,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSEHasTimestamp,
-    MSEHasMovementFlags,
-    MSEHasOrientation,
-    MSEHasPitch,
-    MSEHasGuidByte3,
-    MSEHasGuidByte1,
-    MSEHasTransportData,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasFallData,
-    MSEHasGuidByte6,
-    MSEHasFallDirection,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte1,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSETransportGuidByte6,
-    MSETransportPositionZ,
-    MSETransportGuidByte2,
-    MSETransportGuidByte3,
-    MSETransportPositionY,
-    MSETransportTime3,
-    MSETransportGuidByte5,
-    MSETransportSeat,
-    MSETransportGuidByte0,
-    MSETransportTime,
-    MSETransportTime2,
-    MSETransportGuidByte4,
-    MSETransportOrientation,
-    MSETransportPositionX,
-    MSETransportGuidByte1,
-    MSETransportGuidByte7,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementFallReset[] =
-{
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEPositionX,              // 36
-    MSEHasGuidByte1,           // 17
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 149
-    MSEHasOrientation,         // 48
-    MSEHasMovementFlags,       // 24
-    MSEHasPitch,               // 112
-    MSEHasMovementFlags2,      // 28
-    MSEUnkUIntCount,           // 152
-    MSEHasTimestamp,           // 32
-    MSEZeroBit,                // 148
-    MSEZeroBit,                // 172
-    MSEHasUnkTime,             // 168
-    MSEHasGuidByte0,           // 16
-    MSEHasGuidByte7,           // 23
-    MSEHasGuidByte2,           // 18
-    MSEHasGuidByte4,           // 20
-    MSEHasSplineElevation,     // 144
-    MSEHasFallData,            // 140
-    MSEHasGuidByte5,           // 21
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte3,           // 19
-    MSEHasTransportTime3,      // 100
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasFallDirection,       // 136
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte4,              // 20
-    MSEGuidByte6,              // 22
-    MSEGuidByte1,              // 17
-    MSECounter,                // 156
-    MSEGuidByte7,              // 23
-    MSEGuidByte5,              // 21
-    MSEGuidByte3,              // 19
-    MSEGuidByte0,              // 16
-    MSEGuidByte2,              // 18
-    MSEFallTime,               // 116
-    MSEFallSinAngle,           // 128
-    MSEFallCosAngle,           // 124
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallVerticalSpeed,      // 120
-    MSETransportTime3,         // 96
-    MSETransportGuidByte0,     // 56
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte7,     // 63
-    MSETransportGuidByte3,     // 59
-    MSETransportPositionX,     // 64
-    MSETransportTime2,         // 88
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte6,     // 62
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportGuidByte5,     // 61
-    MSETransportGuidByte4,     // 60
-    MSETransportTime,          // 84
-    MSETransportGuidByte1,     // 57
-    MSETimestamp,              // 32
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSEOrientation,            // 48
-    MSEEnd
-};
-
-MovementStatusElements const MovementFeatherFallAck[] =
-{
-    MSEPositionZ,
-    MSECounter,
-    MSEPositionY,
-    MSEPositionX,
-    MSEZeroBit,
-    MSEHasGuidByte3,
-    MSEHasSplineElevation,
-    MSEHasGuidByte1,
-    MSEHasPitch,
-    MSEHasGuidByte2,
-    MSEHasSpline,
-    MSEHasTimestamp,
-    MSEHasGuidByte5,
-    MSEHasFallData,
-    MSEHasOrientation,
-    MSEHasTransportData,
-    MSEHasGuidByte7,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte6,
-    MSEHasMovementFlags,
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte0,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSETransportTime3,
-    MSETransportOrientation,
-    MSETransportPositionZ,
-    MSETransportGuidByte7,
-    MSETransportGuidByte5,
-    MSETransportGuidByte2,
-    MSETransportPositionX,
-    MSETransportGuidByte1,
-    MSETransportGuidByte6,
-    MSETransportTime2,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSETransportGuidByte4,
-    MSETransportGuidByte0,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETimestamp,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEFallVerticalSpeed,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementGravityDisableAck[] =
-{
-    MSEPositionZ,
-    MSEPositionY,
-    MSECounter,
-    MSEPositionX,
-    MSEHasGuidByte3,
-    MSEHasTransportData,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasMovementFlags,
-    MSEHasOrientation,
-    MSEHasSpline,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasSplineElevation,
-    MSEHasTimestamp,
-    MSEHasPitch,
-    MSEHasMovementFlags2,
-    MSEZeroBit,
-    MSEHasGuidByte2,
-    MSEHasFallData,
-    MSEHasGuidByte1,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportTime2,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSETransportPositionZ,
-    MSETransportGuidByte2,
-    MSETransportGuidByte5,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportPositionY,
-    MSETransportTime,
-    MSETransportSeat,
-    MSETransportGuidByte6,
-    MSETransportGuidByte1,
-    MSETransportGuidByte0,
-    MSETransportOrientation,
-    MSETransportTime2,
-    MSETransportPositionX,
-    MSETransportGuidByte7,
-    MSETransportTime3,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEOrientation,
-    MSESplineElevation,
-    MSETimestamp,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementGravityEnableAck[] =
-{
-    MSEPositionZ,
-    MSEPositionX,
-    MSECounter,
-    MSEPositionY,
-    MSEHasSplineElevation,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte6,
-    MSEHasOrientation,
-    MSEZeroBit,
-    MSEHasGuidByte5,
-    MSEHasSpline,
-    MSEHasGuidByte3,
-    MSEHasTransportData,
-    MSEHasPitch,
-    MSEHasGuidByte1,
-    MSEHasTimestamp,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasMovementFlags,
-    MSEHasFallData,
-    MSEHasGuidByte0,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEHasFallDirection,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte6,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallVerticalSpeed,
-    MSETransportGuidByte1,
-    MSETransportPositionX,
-    MSETransportTime3,
-    MSETransportOrientation,
-    MSETransportGuidByte2,
-    MSETransportGuidByte0,
-    MSETransportGuidByte7,
-    MSETransportGuidByte6,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportPositionZ,
-    MSETransportTime2,
-    MSETransportGuidByte5,
-    MSETransportTime,
-    MSETransportPositionY,
-    MSESplineElevation,
-    MSEOrientation,
-    MSEPitch,
-    MSETimestamp,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementHoverAck[] =
-{
-    MSECounter,
-    MSEPositionZ,
-    MSEPositionY,
-    MSEPositionX,
-    MSEHasGuidByte4,
-    MSEHasTransportData,
-    MSEHasGuidByte2,
-    MSEHasTimestamp,
-    MSEHasSpline,
-    MSEHasMovementFlags,
-    MSEHasGuidByte1,
-    MSEHasPitch,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEZeroBit,
-    MSEHasFallData,
-    MSEHasMovementFlags2,
-    MSEHasSplineElevation,
-    MSEHasOrientation,
-    MSEHasGuidByte3,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportTime2,
-    MSEMovementFlags,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSETimestamp,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEOrientation,
-    MSETransportGuidByte1,
-    MSETransportTime3,
-    MSETransportGuidByte2,
-    MSETransportGuidByte7,
-    MSETransportGuidByte3,
-    MSETransportGuidByte4,
-    MSETransportSeat,
-    MSETransportPositionX,
-    MSETransportPositionZ,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportGuidByte0,
-    MSETransportPositionY,
-    MSETransportGuidByte5,
-    MSETransportTime2,
-    MSETransportGuidByte6,
-    MSESplineElevation,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementKnockBackAck[] =
-{
-    MSEPositionX,              // 36
-    MSEPositionY,              // 40
-    MSEPositionZ,              // 44
-    MSEExtraElement,
-    MSEHasGuidByte2,           // 18
-    MSEZeroBit,                // 149
-    MSEHasGuidByte7,           // 23
-    MSEHasOrientation,         // 48
-    MSEHasGuidByte4,           // 20
-    MSEHasTimestamp,           // 32
-    MSEHasFallData,            // 140
-    MSEZeroBit,                // 148
-    MSEHasGuidByte0,           // 16
-    MSEHasTransportData,       // 104
-    MSEHasGuidByte5,           // 21
-    MSEUnkUIntCount,           // 152
-    MSEHasGuidByte3,           // 19
-    MSEHasMovementFlags,       // 24
-    MSEHasMovementFlags2,      // 28
-    MSEHasPitch,               // 112
-    MSEHasGuidByte6,           // 22
-    MSEZeroBit,                // 172
-    MSEHasGuidByte1,           // 17
-    MSEHasSplineElevation,     // 144
-    MSEHasUnkTime,             // 168
-    MSEHasFallDirection,       // 136
-    MSEHasTransportGuidByte7,  // 63
-    MSEHasTransportTime2,      // 92
-    MSEHasTransportGuidByte6,  // 62
-    MSEHasTransportGuidByte5,  // 61
-    MSEHasTransportGuidByte0,  // 56
-    MSEHasTransportGuidByte2,  // 58
-    MSEHasTransportGuidByte4,  // 60
-    MSEHasTransportGuidByte1,  // 57
-    MSEHasTransportGuidByte3,  // 59
-    MSEHasTransportTime3,      // 100
-    MSEMovementFlags2,         // 28
-    MSEMovementFlags,          // 24
-    MSEGuidByte0,              // 16
-    MSEGuidByte5,              // 21
-    MSEUnkUIntLoop,            // 156
-    MSEGuidByte6,              // 22
-    MSEGuidByte1,              // 17
-    MSEGuidByte4,              // 20
-    MSEGuidByte2,              // 18
-    MSEGuidByte3,              // 19
-    MSEGuidByte7,              // 23
-    MSEFallTime,               // 116
-    MSEFallHorizontalSpeed,    // 132
-    MSEFallCosAngle,           // 124
-    MSEFallSinAngle,           // 128
-    MSEFallVerticalSpeed,      // 120
-    MSETransportTime,          // 84
-    MSETransportOrientation,   // 76
-    MSETransportGuidByte3,     // 59
-    MSETransportPositionZ,     // 72
-    MSETransportGuidByte2,     // 58
-    MSETransportPositionX,     // 64
-    MSETransportSeat,          // 80
-    MSETransportPositionY,     // 68
-    MSETransportTime3,         // 96
-    MSETransportGuidByte1,     // 57
-    MSETransportGuidByte6,     // 62
-    MSETransportGuidByte7,     // 63
-    MSETransportTime2,         // 88
-    MSETransportGuidByte5,     // 61    
-    MSETransportGuidByte0,     // 56
-    MSETransportGuidByte4,     // 60
-    MSEOrientation,            // 48
-    MSEUnkTime,                // 168
-    MSEPitch,                  // 112
-    MSESplineElevation,        // 144
-    MSETimestamp,              // 32
-    MSEEnd
-};
-
-MovementStatusElements const MovementWaterWalkAck[] =
-{
-    MSEPositionY,
-    MSEPositionZ,
-    MSECounter,
-    MSEPositionX,
-    MSEHasTimestamp,
-    MSEHasPitch,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasOrientation,
-    MSEHasGuidByte1,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte2,
-    MSEHasMovementFlags,
-    MSEHasGuidByte3,
-    MSEHasTransportData,
-    MSEHasGuidByte6,
-    MSEHasFallData,
-    MSEHasGuidByte4,
-    MSEZeroBit,
-    MSEHasSplineElevation,
-    MSEHasSpline,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte4,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEMovementFlags2,
-    MSEGuidByte2,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSETransportPositionX,
-    MSETransportGuidByte1,
-    MSETransportTime3,
-    MSETransportGuidByte0,
-    MSETransportOrientation,
-    MSETransportGuidByte7,
-    MSETransportPositionY,
-    MSETransportTime2,
-    MSETransportTime,
-    MSETransportGuidByte5,
-    MSETransportSeat,
-    MSETransportPositionZ,
-    MSETransportGuidByte3,
-    MSETransportGuidByte2,
-    MSETransportGuidByte6,
-    MSETransportGuidByte4,
-    MSESplineElevation,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSEFallTime,
-    MSEOrientation,
-    MSETimestamp,
-    MSEPitch,
-    MSEEnd,
-};
-
-MovementStatusElements const MovementUpdateKnockBack[] =
-{
-    MSEZeroBit,
-    MSEHasGuidByte4,
-    MSEHasMovementFlags,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEHasOrientation,
-    MSEOrientation,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallCosAngle,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSEGuidByte3,
-    MSETransportGuidByte5,
-    MSETransportGuidByte7,
-    MSETransportSeat,
-    MSETransportGuidByte3,
-    MSETransportGuidByte6,
-    MSETransportPositionZ,
-    MSETransportGuidByte1,
-    MSETransportPositionY,
-    MSETransportPositionX,
-    MSETransportGuidByte2,
-    MSETransportGuidByte0,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportGuidByte4,
-    MSEPitch,
-    MSEPositionZ,
-    MSETimestamp,
-    MSEPositionX,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEPositionY,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetWalkSpeed[] =
-{
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEExtraElement,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetRunSpeed[] =
-{
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEExtraElement,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetRunBackSpeed[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEGuidByte6,
-    MSEExtraElement,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetSwimSpeed[] =
-{
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEExtraElement,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetSwimBackSpeed[] =
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEExtraElement,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetTurnRate[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEExtraElement,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetFlightSpeed[] =
-{
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEExtraElement,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetFlightBackSpeed[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEHasGuidByte5,
-    MSEExtraElement,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetPitchRate[] =
-{
-    MSEExtraElement,
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetWalkSpeed[] = // 5.4.7 18019
-{
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEExtraElement,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSECounter,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetRunSpeed[] = // 5.4.7 18019
-{
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSECounter,
-    MSEGuidByte5,
-    MSEExtraElement,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetRunBackSpeed[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEGuidByte3,
-    MSEExtraElement,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSECounter,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetSwimSpeed[] = // 5.4.7 18019
-{
-    MSEExtraElement,
-    MSECounter,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetSwimBackSpeed[] =
-{
-    MSECounter,
-    MSEExtraElement,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetTurnRate[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEGuidByte6,
-    MSEExtraElement,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSECounter,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetFlightSpeed[] = //5.4.7 18019
-{
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasGuidByte5,
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSECounter,
-    MSEGuidByte5,
-    MSEExtraElement,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetFlightBackSpeed[] =
-{
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEGuidByte4,
-    MSEExtraElement,
-    MSEGuidByte0,
-    MSECounter,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetPitchRate[] =
-{
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEExtraElement,
-    MSECounter,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetWalkMode[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetRunMode[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveGravityDisable[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveGravityEnable[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetHover[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveUnsetHover[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveStartSwim[] =
-{
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveStopSwim[] =
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetFlying[] =
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveUnsetFlying[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte0,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetWaterWalk[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte4,
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte6,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetLandWalk[] =
-{
-    MSEHasGuidByte6,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetFeatherFall[] =
-{
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEHasGuidByte0,
-    MSEHasGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveSetNormalFall[] =
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte7,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveRoot[] =
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte0,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSEEnd,
-};
-
-MovementStatusElements const SplineMoveUnroot[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte4,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetCanFly[] = // 5.4.7 18019
-{
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte5,
-    MSECounter,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveUnsetCanFly[] = // 5.4.7 18019
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasGuidByte4,
-    MSEHasGuidByte7,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte5,
-    MSECounter,
-    MSEGuidByte1,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveSetHover[] =
-{
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte7,
-    MSEHasGuidByte4,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSECounter,
-    MSEGuidByte5,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveUnsetHover[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEGuidByte2,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSECounter,
-    MSEGuidByte0,
-    MSEGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveWaterWalk[] =
-{
-    MSEHasGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte5,
-    MSEHasGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte0,
-    MSEGuidByte7,
-    MSEGuidByte5,
-    MSEGuidByte3,
-    MSEGuidByte4,
-    MSECounter,
-    MSEGuidByte1,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveLandWalk[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte3,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEGuidByte6,
-    MSEGuidByte5,
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte2,
-    MSEGuidByte4,
-    MSECounter,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveFeatherFall[] =
-{
-    MSECounter,
-    MSEHasGuidByte0,
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte7,
-    MSEHasGuidByte6,
-    MSEHasGuidByte2,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSEGuidByte1,
-    MSEGuidByte6,
-    MSEGuidByte3,
-    MSEGuidByte7,
-    MSEEnd,
-};
-
-MovementStatusElements const MoveNormalFall[] =
-{
-    MSEHasGuidByte7,
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte0,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasGuidByte1,
-    MSEHasGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte0,
-    MSECounter,
-    MSEGuidByte2,
-    MSEGuidByte1,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte6,
-    MSEEnd,
-};
+    struct MovementStatusReadState
+    {
+        MovementStatusReadState() : hasTransportData(false), bitcounterLoop(0) { }
 
-MovementStatusElements const MoveRoot[] =
-{
-    MSEHasGuidByte5,
-    MSEHasGuidByte3,
-    MSEHasGuidByte6,
-    MSEHasGuidByte0,
-    MSEHasGuidByte1,
-    MSEHasGuidByte4,
-    MSEHasGuidByte2,
-    MSEHasGuidByte7,
-    MSEGuidByte1,
-    MSEGuidByte2,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSEGuidByte3,
-    MSEGuidByte5,
-    MSECounter,
-    MSEGuidByte7,
-    MSEGuidByte0,
-    MSEEnd,
-};
+        ObjectGuid guid;
+        ObjectGuid tguid;
+        bool hasTransportData;
+        uint32 bitcounterLoop;
+    };
 
-MovementStatusElements const MoveUnroot[] =
-{
-    MSEHasGuidByte0,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEHasGuidByte1,
-    MSEHasGuidByte2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte7,
-    MSEHasGuidByte5,
-    MSEGuidByte1,
-    MSEGuidByte0,
-    MSEGuidByte3,
-    MSEGuidByte6,
-    MSEGuidByte4,
-    MSECounter,
-    MSEGuidByte5,
-    MSEGuidByte7,
-    MSEGuidByte2,
-    MSEEnd,
-};
+    struct MovementStatusWriteState
+    {
+        explicit MovementStatusWriteState(MovementInfo const* mi) : guid(mi->guid), tguid(mi->t_guid),
+            hasMovementFlags(mi->GetMovementFlags() != 0), hasMovementFlags2(mi->GetExtraMovementFlags() != 0),
+            hasTransportData(mi->t_guid != 0LL) { }
+
+        ObjectGuid guid;
+        ObjectGuid tguid;
+        bool hasMovementFlags;
+        bool hasMovementFlags2;
+        bool hasTransportData;
+    };
+
+    template<MovementStatusElements element>
+    inline void ReadMovementStatusElement(ByteBuffer& data, MovementInfo* mi, ExtraMovementStatusElement* extras, MovementStatusReadState& state)
+    {
+        switch (element)
+        {
+            case MSEHasGuidByte0:
+            case MSEHasGuidByte1:
+            case MSEHasGuidByte2:
+            case MSEHasGuidByte3:
+            case MSEHasGuidByte4:
+            case MSEHasGuidByte5:
+            case MSEHasGuidByte6:
+            case MSEHasGuidByte7:
+                state.guid[element - MSEHasGuidByte0] = data.ReadBit();
+                break;
+            case MSEHasTransportGuidByte0:
+            case MSEHasTransportGuidByte1:
+            case MSEHasTransportGuidByte2:
+            case MSEHasTransportGuidByte3:
+            case MSEHasTransportGuidByte4:
+            case MSEHasTransportGuidByte5:
+            case MSEHasTransportGuidByte6:
+            case MSEHasTransportGuidByte7:
+                if (state.hasTransportData)
+                    state.tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+                break;
+            case MSEGuidByte0:
+            case MSEGuidByte1:
+            case MSEGuidByte2:
+            case MSEGuidByte3:
+            case MSEGuidByte4:
+            case MSEGuidByte5:
+            case MSEGuidByte6:
+            case MSEGuidByte7:
+                data.ReadByteSeq(state.guid[element - MSEGuidByte0]);
+                break;
+            case MSETransportGuidByte0:
+            case MSETransportGuidByte1:
+            case MSETransportGuidByte2:
+            case MSETransportGuidByte3:
+            case MSETransportGuidByte4:
+            case MSETransportGuidByte5:
+            case MSETransportGuidByte6:
+            case MSETransportGuidByte7:
+                if (state.hasTransportData)
+                    data.ReadByteSeq(state.tguid[element - MSETransportGuidByte0]);
+                break;
+            case MSEGenericDword0:
+            case MSEGenericDword1:
+            case MSEGenericDword2:
+            case MSEGenericDword3:
+            case MSEGenericDword4:
+            case MSEGenericDword5:
+            case MSEGenericDword6:
+            case MSEGenericDword7:
+                data.read_skip<uint32>();
+                break;
+            case MSEExtraElement:
+                extras->ReadNextElement(data);
+                break;
+            case MSEGeneric2bits0:
+                data.ReadBits(2);
+                break;
+            case MSEUnkUIntCount:
+                state.bitcounterLoop = data.ReadBits(22);
+                break;
+            case MSEUnkUIntLoop:
+                data.read_skip(state.bitcounterLoop * sizeof(uint32));
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                mi->flags = !data.ReadBit();
+                break;
+            case MSEHasMovementFlags2:
+                mi->flags2 = !data.ReadBit();
+                break;
+            case MSEHasTimestamp:
+                mi->time = !data.ReadBit();
+                break;
+            case MSEHasOrientation:
+                mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
+                break;
+            case MSEHasTransportData:
+                state.hasTransportData = data.ReadBit();
+                break;
+            case MSEHasTransportTime2:
+                if (state.hasTransportData)
+                    mi->has_t_time2 = data.ReadBit();
+                break;
+            case MSEHasTransportTime3:
+                if (state.hasTransportData)
+                    mi->has_t_time3 = data.ReadBit();
+                break;
+            case MSEHasPitch:
+                mi->HavePitch = !data.ReadBit();
+                break;
+            case MSEHasFallData:
+                mi->hasFallData = data.ReadBit();
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    mi->hasFallDirection = data.ReadBit();
+                break;
+            case MSEHasSplineElevation:
+                mi->HaveSplineElevation = !data.ReadBit();
+                break;
+            case MSEHasSpline:
+                data.ReadBit();
+                break;
+            case MSEMovementFlags:
+                if (mi->flags)
+                    mi->flags = data.ReadBits(30);
+                break;
+            case MSEMovementFlags2:
+                if (mi->flags2)
+                    mi->flags2 = data.ReadBits(13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data >> mi->time;
+                break;
+            case MSEPositionX:
+                data >> mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data >> mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data >> mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.m_orientation != 0.0f)
+                    mi->pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportPositionX:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (state.hasTransportData)
+                    data >> mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (state.hasTransportData)
+                    mi->t_pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportSeat:
+                if (state.hasTransportData)
+                    data >> mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (state.hasTransportData)
+                    data >> mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (state.hasTransportData && mi->has_t_time2)
+                    data >> mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (state.hasTransportData && mi->has_t_time3)
+                    data >> mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data >> mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data >> mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data >> mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data >> mi->splineElevation;
+                break;
+            case MSEZeroBit:
+            case MSEOneBit:
+                data.ReadBit();
+                break;
+            case MSEHasUnkTime:
+                mi->Alive32 = !data.ReadBit();
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data >> mi->Alive32;
+                break;
+            case MSECounter:
+                data.read_skip<uint32>();
+                break;
+            case MSEEnd:
+                break;
+            default:
+                ASSERT(PrintInvalidSequenceElement(element, __FUNCTION__));
+                break;
+        }
+    }
 
-MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
-{
-    MSEPositionY,
-    MSEPositionX,
-    MSEPositionZ,
-    MSEExtraElement,
-    MSEHasMovementFlags,
-    MSEHasTransportData,
-    MSEHasGuidByte2,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEExtraElement,
-    MSEExtraElement,
-    MSEHasOrientation,
-    MSEZeroBit,
-    MSEExtraElement,
-    MSEHasGuidByte7,
-    MSEExtraElement,
-    MSEHasTimestamp,
-    MSEHasSplineElevation,
-    MSEHasGuidByte5,
-    MSEExtraElement,
-    MSEHasMovementFlags2,
-    MSEHasPitch,
-    MSEExtraElement,
-    MSEHasGuidByte0,
-    MSEExtraElement,
-    MSEHasFallData,
-    MSEHasGuidByte1,
-    MSEHasSpline,
-    MSEMovementFlags,
-    MSEExtraElement,
-    MSEHasGuidByte3,
-    MSEHasTransportGuidByte3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportGuidByte6,
-    MSEMovementFlags2,
-    MSEHasFallDirection,
-    MSEExtraElement,
-    MSEGuidByte7,
-    MSEGuidByte5,
-    MSEExtraElement,
-    MSEExtraElement,
-    MSEGuidByte6,
-    MSEExtraElement,
-    MSEExtraElement,
-    MSEGuidByte3,
-    MSEExtraElement,
-    MSEGuidByte0,
-    MSEExtraElement,
-    MSEGuidByte4,
-    MSEGuidByte1,
-    MSEExtraElement,
-    MSEGuidByte2,
-    MSEPitch,
-    MSEFallCosAngle,
-    MSEFallSinAngle,
-    MSEFallHorizontalSpeed,
-    MSEFallTime,
-    MSEFallVerticalSpeed,
-    MSETransportGuidByte2,
-    MSETransportTime2,
-    MSETransportTime3,
-    MSETransportGuidByte0,
-    MSETransportTime,
-    MSETransportSeat,
-    MSETransportPositionX,
-    MSETransportOrientation,
-    MSETransportGuidByte7,
-    MSETransportGuidByte4,
-    MSETransportGuidByte3,
-    MSETransportGuidByte5,
-    MSETransportPositionZ,
-    MSETransportGuidByte1,
-    MSETransportGuidByte6,
-    MSETransportPositionY,
-    MSESplineElevation,
-    MSEOrientation,
-    MSETimestamp,
-    MSEEnd,
-};
+    template<MovementStatusElements element>
+    inline void WriteMovementStatusElement(ByteBuffer& data, MovementInfo const* mi, ExtraMovementStatusElement* extras, MovementStatusWriteState const& state)
+    {
+        switch (element)
+        {
+            case MSEHasGuidByte0:
+            case MSEHasGuidByte1:
+            case MSEHasGuidByte2:
+            case MSEHasGuidByte3:
+            case MSEHasGuidByte4:
+            case MSEHasGuidByte5:
+            case MSEHasGuidByte6:
+            case MSEHasGuidByte7:
+                data.WriteBit(state.guid[element - MSEHasGuidByte0]);
+                break;
+            case MSEHasTransportGuidByte0:
+            case MSEHasTransportGuidByte1:
+            case MSEHasTransportGuidByte2:
+            case MSEHasTransportGuidByte3:
+            case MSEHasTransportGuidByte4:
+            case MSEHasTransportGuidByte5:
+            case MSEHasTransportGuidByte6:
+            case MSEHasTransportGuidByte7:
+                if (state.hasTransportData)
+                    data.WriteBit(state.tguid[element - MSEHasTransportGuidByte0]);
+                break;
+            case MSEGuidByte0:
+            case MSEGuidByte1:
+            case MSEGuidByte2:
+            case MSEGuidByte3:
+            case MSEGuidByte4:
+            case MSEGuidByte5:
+            case MSEGuidByte6:
+            case MSEGuidByte7:
+                data.WriteByteSeq(state.guid[element - MSEGuidByte0]);
+                break;
+            case MSETransportGuidByte0:
+            case MSETransportGuidByte1:
+            case MSETransportGuidByte2:
+            case MSETransportGuidByte3:
+            case MSETransportGuidByte4:
+            case MSETransportGuidByte5:
+            case MSETransportGuidByte6:
+            case MSETransportGuidByte7:
+                if (state.hasTransportData)
+                    data.WriteByteSeq(state.tguid[element - MSETransportGuidByte0]);
+                break;
+            case MSEGenericDword0:
+            case MSEGenericDword1:
+            case MSEGenericDword2:
+            case MSEGenericDword3:
+            case MSEGenericDword4:
+            case MSEGenericDword5:
+            case MSEGenericDword6:
+            case MSEGenericDword7:
+                data << uint32(0);
+                break;
+            case MSEExtraElement:
+                extras->WriteNextElement(data);
+                break;
+            case MSEGeneric2bits0:
+                data.WriteBits(0, 2);
+                break;
+            case MSEUnkUIntCount:
+                data.WriteBits(0, 22);
+                break;
+            case MSEUnkUIntLoop:
+                break;
+            case MSECounter:
+                data << uint32(0); // movement counter
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                data.WriteBit(!state.hasMovementFlags);
+                break;
+            case MSEHasMovementFlags2:
+                data.WriteBit(!state.hasMovementFlags2);
+                break;
+            case MSEHasTimestamp:
+                data.WriteBit(!mi->time);
+                break;
+            case MSEHasOrientation:
+                data.WriteBit(!mi->pos.HaveOrientation());
+                break;
+            case MSEHasTransportData:
+                data.WriteBit(state.hasTransportData);
+                break;
+            case MSEHasTransportTime2:
+                if (state.hasTransportData)
+                    data.WriteBit(mi->has_t_time2);
+                break;
+            case MSEHasTransportTime3:
+                if (state.hasTransportData)
+                    data.WriteBit(mi->has_t_time3);
+                break;
+            case MSEHasPitch:
+                data.WriteBit(!mi->HavePitch);
+                break;
+            case MSEHasFallData:
+                data.WriteBit(mi->hasFallData);
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    data.WriteBit(mi->hasFallDirection);
+                break;
+            case MSEHasSplineElevation:
+                data.WriteBit(!mi->HaveSplineElevation);
+                break;
+            case MSEHasSpline:
+                data.WriteBit(false);
+                break;
+            case MSEMovementFlags:
+                if (state.hasMovementFlags)
+                    data.WriteBits(mi->flags, 30);
+                break;
+            case MSEMovementFlags2:
+                if (state.hasMovementFlags2)
+                    data.WriteBits(mi->flags2, 13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data << mi->time;
+                break;
+            case MSEPositionX:
+                data << mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data << mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data << mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.HaveOrientation())
+                    data << mi->pos.GetOrientation();
+                break;
+            case MSETransportPositionX:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (state.hasTransportData)
+                    data << mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (state.hasTransportData)
+                    data << mi->t_pos.GetOrientation();
+                break;
+            case MSETransportSeat:
+                if (state.hasTransportData)
+                    data << mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (state.hasTransportData)
+                    data << mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (state.hasTransportData && mi->has_t_time2)
+                    data << mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (state.hasTransportData && mi->has_t_time3)
+                    data << mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data << mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data << mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data << mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data << mi->splineElevation;
+                break;
+            case MSEZeroBit:
+                data.WriteBit(0);
+                break;
+            case MSEOneBit:
+                data.WriteBit(1);
+                break;
+            case MSEHasUnkTime:
+                data.WriteBit(!mi->Alive32);
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data << mi->Alive32;
+                break;
+            case MSEEnd:
+                break;
+            default:
+                ASSERT(PrintInvalidSequenceElement(element, __FUNCTION__));
+                break;
+        }
+    }
+}
 
-MovementStatusElements const CastSpellEmbeddedMovement[] =
-{
-    MSEPositionZ,
-    MSEPositionY,
-    MSEPositionX,
-    MSEHasFallData,
-    MSEHasTimestamp,
-    MSEHasOrientation,
-    MSEZeroBit,
-    MSEHasSpline,
-    MSEHasGuidByte6,
-    MSEHasGuidByte4,
-    MSEHasMovementFlags2,
-    MSEHasGuidByte3,
-    MSEHasGuidByte5,
-    MSEHasSplineElevation,
-    MSEHasPitch,
-    MSEHasGuidByte7,
-    MSEHasTransportData,
-    MSEHasGuidByte2,
-    MSEHasMovementFlags,
-    MSEHasGuidByte1,
-    MSEHasGuidByte0,
-    MSEHasTransportGuidByte6,
-    MSEHasTransportGuidByte2,
-    MSEHasTransportGuidByte5,
-    MSEHasTransportTime2,
-    MSEHasTransportGuidByte7,
-    MSEHasTransportGuidByte4,
-    MSEHasTransportTime3,
-    MSEHasTransportGuidByte0,
-    MSEHasTransportGuidByte1,
-    MSEHasTransportGuidByte3,
-    MSEMovementFlags2,
-    MSEMovementFlags,
-    MSEHasFallDirection,
-    MSEGuidByte1,
-    MSEGuidByte4,
-    MSEGuidByte7,
-    MSEGuidByte3,
-    MSEGuidByte0,
-    MSEGuidByte2,
-    MSEGuidByte5,
-    MSEGuidByte6,
-    MSETransportSeat,
-    MSETransportOrientation,
-    MSETransportTime,
-    MSETransportGuidByte6,
-    MSETransportGuidByte5,
-    MSETransportTime3,
-    MSETransportPositionX,
-    MSETransportGuidByte4,
-    MSETransportPositionZ,
-    MSETransportGuidByte2,
-    MSETransportGuidByte0,
-    MSETransportTime2,
-    MSETransportGuidByte1,
-    MSETransportGuidByte3,
-    MSETransportPositionY,
-    MSETransportGuidByte7,
-    MSEOrientation,
-    MSESplineElevation,
-    MSEFallTime,
-    MSEFallHorizontalSpeed,
-    MSEFallSinAngle,
-    MSEFallCosAngle,
-    MSEFallVerticalSpeed,
-    MSETimestamp,
-    MSEPitch,
-    MSEEnd,
-};
+#define MOVEMENT_SEQUENCE_ARRAY_ELEMENT(element) element,
+#define MOVEMENT_SEQUENCE_READ_ELEMENT(element) ReadMovementStatusElement<element>(data, mi, extras, state);
+#define MOVEMENT_SEQUENCE_WRITE_ELEMENT(element) WriteMovementStatusElement<element>(data, mi, extras, state);
+
+#define MOVEMENT_STATUS_SEQUENCE(name) \
+    MovementStatusElements const name[] = { MOVEMENT_SEQUENCE_##name(MOVEMENT_SEQUENCE_ARRAY_ELEMENT) }; \
+    static bool name##Read(ByteBuffer& data, MovementInfo* mi, ExtraMovementStatusElement* extras) \
+    { \
+        MovementStatusReadState state; \
+        MOVEMENT_SEQUENCE_##name(MOVEMENT_SEQUENCE_READ_ELEMENT) \
+        mi->guid = state.guid; \
+        mi->t_guid = state.tguid; \
+        return state.hasTransportData; \
+    } \
+    static void name##Write(ByteBuffer& data, MovementInfo const* mi, ExtraMovementStatusElement* extras) \
+    { \
+        MovementStatusWriteState const state(mi); \
+        MOVEMENT_SEQUENCE_##name(MOVEMENT_SEQUENCE_WRITE_ELEMENT) \
+    } \
+    MovementStatusCodec const name##Codec = { name, &name##Read, &name##Write }
+
+#define MOVEMENT_SEQUENCE_PlayerMove(ELEMENT) \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEOneBit)                   /* 168 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 152 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(PlayerMove);
+
+#define MOVEMENT_SEQUENCE_SetCanFly(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEOneBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEUnkUIntCount) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEUnkUIntLoop) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SetCanFly);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementFallLand(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementFallLand);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementHeartBeat(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementHeartBeat);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementJump(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementJump);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementSetFacing(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetFacing);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementSetPitch(ELEMENT) \
+    /* Find MSEUnkUIntLoop */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetPitch);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartBackward(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartBackward);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartForward(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartForward);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartStrafeLeft(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartStrafeLeft);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartStrafeRight(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartStrafeRight);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartTurnLeft(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartTurnLeft);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartTurnRight(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartTurnRight);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStop(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStop);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStopStrafe(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStopStrafe);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStopTurn(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStopTurn);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartAscend(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartAscend);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartDescend(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartDescend);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartSwim(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartSwim);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStopSwim(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStopSwim);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStopAscend(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStopAscend);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStopPitch(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStopPitch);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartPitchDown(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartPitchDown);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MovementStartPitchUp(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementStartPitchUp);
+
+#define MOVEMENT_SEQUENCE_MoveChngTransport(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasUnkTime) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEUnkUIntCount) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEUnkUIntLoop) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEUnkTime) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveChngTransport);
+
+#define MOVEMENT_SEQUENCE_MoveSplineDone(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSplineDone);
+
+#define MOVEMENT_SEQUENCE_MoveNotActiveMover(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveNotActiveMover);
+
+#define MOVEMENT_SEQUENCE_DismissControlledVehicle(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasUnkTime) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEUnkUIntCount) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEUnkUIntLoop) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEUnkTime) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(DismissControlledVehicle);
+
+#define MOVEMENT_SEQUENCE_MoveUpdateTeleport(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveUpdateTeleport);
+
+#define MOVEMENT_SEQUENCE_MovementSetRunMode(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSECounter)                  /* 156 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetRunMode);
+
+#define MOVEMENT_SEQUENCE_MovementSetWalkMode(ELEMENT) \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSECounter)                  /* 156 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetWalkMode);
+
+#define MOVEMENT_SEQUENCE_MovementSetCanFly(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSECounter)                  /* 156 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetCanFly);
+
+#define MOVEMENT_SEQUENCE_MovementSetCanTransitionBetweenSwimAndFlyAck(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetCanTransitionBetweenSwimAndFlyAck);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateSwimSpeed(ELEMENT) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateSwimSpeed);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateRunSpeed(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateRunSpeed);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateFlightSpeed(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateFlightSpeed);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateCollisionHeight(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateCollisionHeight);
+
+#define MOVEMENT_SEQUENCE_MovementForceRunSpeedChangeAck(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementForceRunSpeedChangeAck);
+
+#define MOVEMENT_SEQUENCE_MovementSetCollisionHeightAck(ELEMENT) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEGenericDword0) \
+    ELEMENT(MSEGenericDword1) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasUnkTime) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEUnkUIntCount) \
+    ELEMENT(MSEGeneric2bits0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEUnkUIntLoop) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEUnkTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetCollisionHeightAck);
+
+#define MOVEMENT_SEQUENCE_MovementForceFlightSpeedChangeAck(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementForceFlightSpeedChangeAck);
+
+#define MOVEMENT_SEQUENCE_MovementSetCanFlyAck(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasUnkTime) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEUnkUIntCount) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEUnkUIntLoop) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEUnkTime) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementSetCanFlyAck);
+
+#define MOVEMENT_SEQUENCE_MovementForceSwimSpeedChangeAck(ELEMENT) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementForceSwimSpeedChangeAck);
+
+#define MOVEMENT_SEQUENCE_MovementForceWalkSpeedChangeAck(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementForceWalkSpeedChangeAck);
+
+#define MOVEMENT_SEQUENCE_MovementForceRunBackSpeedChangeAck(ELEMENT) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementForceRunBackSpeedChangeAck);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateRunBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateRunBackSpeed);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateWalkSpeed(ELEMENT) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateWalkSpeed);
+
+#define MOVEMENT_SEQUENCE_ForceMoveRootAck(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(ForceMoveRootAck);
+
+#define MOVEMENT_SEQUENCE_ForceMoveUnrootAck(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(ForceMoveUnrootAck);
+
+#define MOVEMENT_SEQUENCE_MovementFallReset(ELEMENT) \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSECounter)                  /* 156 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementFallReset);
+
+#define MOVEMENT_SEQUENCE_MovementFeatherFallAck(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementFeatherFallAck);
+
+#define MOVEMENT_SEQUENCE_MovementGravityDisableAck(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementGravityDisableAck);
+
+#define MOVEMENT_SEQUENCE_MovementGravityEnableAck(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementGravityEnableAck);
+
+#define MOVEMENT_SEQUENCE_MovementHoverAck(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementHoverAck);
+
+#define MOVEMENT_SEQUENCE_MovementKnockBackAck(ELEMENT) \
+    ELEMENT(MSEPositionX)                /* 36 */ \
+    ELEMENT(MSEPositionY)                /* 40 */ \
+    ELEMENT(MSEPositionZ)                /* 44 */ \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte2)             /* 18 */ \
+    ELEMENT(MSEZeroBit)                  /* 149 */ \
+    ELEMENT(MSEHasGuidByte7)             /* 23 */ \
+    ELEMENT(MSEHasOrientation)           /* 48 */ \
+    ELEMENT(MSEHasGuidByte4)             /* 20 */ \
+    ELEMENT(MSEHasTimestamp)             /* 32 */ \
+    ELEMENT(MSEHasFallData)              /* 140 */ \
+    ELEMENT(MSEZeroBit)                  /* 148 */ \
+    ELEMENT(MSEHasGuidByte0)             /* 16 */ \
+    ELEMENT(MSEHasTransportData)         /* 104 */ \
+    ELEMENT(MSEHasGuidByte5)             /* 21 */ \
+    ELEMENT(MSEUnkUIntCount)             /* 152 */ \
+    ELEMENT(MSEHasGuidByte3)             /* 19 */ \
+    ELEMENT(MSEHasMovementFlags)         /* 24 */ \
+    ELEMENT(MSEHasMovementFlags2)        /* 28 */ \
+    ELEMENT(MSEHasPitch)                 /* 112 */ \
+    ELEMENT(MSEHasGuidByte6)             /* 22 */ \
+    ELEMENT(MSEZeroBit)                  /* 172 */ \
+    ELEMENT(MSEHasGuidByte1)             /* 17 */ \
+    ELEMENT(MSEHasSplineElevation)       /* 144 */ \
+    ELEMENT(MSEHasUnkTime)               /* 168 */ \
+    ELEMENT(MSEHasFallDirection)         /* 136 */ \
+    ELEMENT(MSEHasTransportGuidByte7)    /* 63 */ \
+    ELEMENT(MSEHasTransportTime2)        /* 92 */ \
+    ELEMENT(MSEHasTransportGuidByte6)    /* 62 */ \
+    ELEMENT(MSEHasTransportGuidByte5)    /* 61 */ \
+    ELEMENT(MSEHasTransportGuidByte0)    /* 56 */ \
+    ELEMENT(MSEHasTransportGuidByte2)    /* 58 */ \
+    ELEMENT(MSEHasTransportGuidByte4)    /* 60 */ \
+    ELEMENT(MSEHasTransportGuidByte1)    /* 57 */ \
+    ELEMENT(MSEHasTransportGuidByte3)    /* 59 */ \
+    ELEMENT(MSEHasTransportTime3)        /* 100 */ \
+    ELEMENT(MSEMovementFlags2)           /* 28 */ \
+    ELEMENT(MSEMovementFlags)            /* 24 */ \
+    ELEMENT(MSEGuidByte0)                /* 16 */ \
+    ELEMENT(MSEGuidByte5)                /* 21 */ \
+    ELEMENT(MSEUnkUIntLoop)              /* 156 */ \
+    ELEMENT(MSEGuidByte6)                /* 22 */ \
+    ELEMENT(MSEGuidByte1)                /* 17 */ \
+    ELEMENT(MSEGuidByte4)                /* 20 */ \
+    ELEMENT(MSEGuidByte2)                /* 18 */ \
+    ELEMENT(MSEGuidByte3)                /* 19 */ \
+    ELEMENT(MSEGuidByte7)                /* 23 */ \
+    ELEMENT(MSEFallTime)                 /* 116 */ \
+    ELEMENT(MSEFallHorizontalSpeed)      /* 132 */ \
+    ELEMENT(MSEFallCosAngle)             /* 124 */ \
+    ELEMENT(MSEFallSinAngle)             /* 128 */ \
+    ELEMENT(MSEFallVerticalSpeed)        /* 120 */ \
+    ELEMENT(MSETransportTime)            /* 84 */ \
+    ELEMENT(MSETransportOrientation)     /* 76 */ \
+    ELEMENT(MSETransportGuidByte3)       /* 59 */ \
+    ELEMENT(MSETransportPositionZ)       /* 72 */ \
+    ELEMENT(MSETransportGuidByte2)       /* 58 */ \
+    ELEMENT(MSETransportPositionX)       /* 64 */ \
+    ELEMENT(MSETransportSeat)            /* 80 */ \
+    ELEMENT(MSETransportPositionY)       /* 68 */ \
+    ELEMENT(MSETransportTime3)           /* 96 */ \
+    ELEMENT(MSETransportGuidByte1)       /* 57 */ \
+    ELEMENT(MSETransportGuidByte6)       /* 62 */ \
+    ELEMENT(MSETransportGuidByte7)       /* 63 */ \
+    ELEMENT(MSETransportTime2)           /* 88 */ \
+    ELEMENT(MSETransportGuidByte5)       /* 61 */ \
+    ELEMENT(MSETransportGuidByte0)       /* 56 */ \
+    ELEMENT(MSETransportGuidByte4)       /* 60 */ \
+    ELEMENT(MSEOrientation)              /* 48 */ \
+    ELEMENT(MSEUnkTime)                  /* 168 */ \
+    ELEMENT(MSEPitch)                    /* 112 */ \
+    ELEMENT(MSESplineElevation)          /* 144 */ \
+    ELEMENT(MSETimestamp)                /* 32 */ \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementKnockBackAck);
+
+#define MOVEMENT_SEQUENCE_MovementWaterWalkAck(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementWaterWalkAck);
+
+#define MOVEMENT_SEQUENCE_MovementUpdateKnockBack(ELEMENT) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MovementUpdateKnockBack);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetWalkSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetWalkSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetRunSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetRunSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetRunBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetRunBackSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetSwimSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetSwimSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetSwimBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetSwimBackSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetTurnRate(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetTurnRate);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetFlightSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetFlightSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetFlightBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetFlightBackSpeed);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetPitchRate(ELEMENT) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetPitchRate);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveSetWalkSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetWalkSpeed);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveSetRunSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetRunSpeed);
+
+#define MOVEMENT_SEQUENCE_MoveSetRunBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetRunBackSpeed);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveSetSwimSpeed(ELEMENT) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetSwimSpeed);
+
+#define MOVEMENT_SEQUENCE_MoveSetSwimBackSpeed(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetSwimBackSpeed);
+
+#define MOVEMENT_SEQUENCE_MoveSetTurnRate(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetTurnRate);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveSetFlightSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetFlightSpeed);
+
+#define MOVEMENT_SEQUENCE_MoveSetFlightBackSpeed(ELEMENT) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetFlightBackSpeed);
+
+#define MOVEMENT_SEQUENCE_MoveSetPitchRate(ELEMENT) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetPitchRate);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetWalkMode(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetWalkMode);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetRunMode(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetRunMode);
+
+#define MOVEMENT_SEQUENCE_SplineMoveGravityDisable(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveGravityDisable);
+
+#define MOVEMENT_SEQUENCE_SplineMoveGravityEnable(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveGravityEnable);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetHover(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetHover);
+
+#define MOVEMENT_SEQUENCE_SplineMoveUnsetHover(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveUnsetHover);
+
+#define MOVEMENT_SEQUENCE_SplineMoveStartSwim(ELEMENT) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveStartSwim);
+
+#define MOVEMENT_SEQUENCE_SplineMoveStopSwim(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveStopSwim);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetFlying(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetFlying);
+
+#define MOVEMENT_SEQUENCE_SplineMoveUnsetFlying(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveUnsetFlying);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetWaterWalk(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetWaterWalk);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetLandWalk(ELEMENT) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetLandWalk);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetFeatherFall(ELEMENT) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetFeatherFall);
+
+#define MOVEMENT_SEQUENCE_SplineMoveSetNormalFall(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveSetNormalFall);
+
+#define MOVEMENT_SEQUENCE_SplineMoveRoot(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveRoot);
+
+#define MOVEMENT_SEQUENCE_SplineMoveUnroot(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(SplineMoveUnroot);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveSetCanFly(ELEMENT) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetCanFly);
+
+// 5.4.7 18019
+#define MOVEMENT_SEQUENCE_MoveUnsetCanFly(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveUnsetCanFly);
+
+#define MOVEMENT_SEQUENCE_MoveSetHover(ELEMENT) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveSetHover);
+
+#define MOVEMENT_SEQUENCE_MoveUnsetHover(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveUnsetHover);
+
+#define MOVEMENT_SEQUENCE_MoveWaterWalk(ELEMENT) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveWaterWalk);
+
+#define MOVEMENT_SEQUENCE_MoveLandWalk(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveLandWalk);
+
+#define MOVEMENT_SEQUENCE_MoveFeatherFall(ELEMENT) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveFeatherFall);
+
+#define MOVEMENT_SEQUENCE_MoveNormalFall(ELEMENT) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveNormalFall);
+
+#define MOVEMENT_SEQUENCE_MoveRoot(ELEMENT) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveRoot);
+
+#define MOVEMENT_SEQUENCE_MoveUnroot(ELEMENT) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSECounter) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(MoveUnroot);
+
+#define MOVEMENT_SEQUENCE_ChangeSeatsOnControlledVehicle(ELEMENT) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEExtraElement) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(ChangeSeatsOnControlledVehicle);
+
+#define MOVEMENT_SEQUENCE_CastSpellEmbeddedMovement(ELEMENT) \
+    ELEMENT(MSEPositionZ) \
+    ELEMENT(MSEPositionY) \
+    ELEMENT(MSEPositionX) \
+    ELEMENT(MSEHasFallData) \
+    ELEMENT(MSEHasTimestamp) \
+    ELEMENT(MSEHasOrientation) \
+    ELEMENT(MSEZeroBit) \
+    ELEMENT(MSEHasSpline) \
+    ELEMENT(MSEHasGuidByte6) \
+    ELEMENT(MSEHasGuidByte4) \
+    ELEMENT(MSEHasMovementFlags2) \
+    ELEMENT(MSEHasGuidByte3) \
+    ELEMENT(MSEHasGuidByte5) \
+    ELEMENT(MSEHasSplineElevation) \
+    ELEMENT(MSEHasPitch) \
+    ELEMENT(MSEHasGuidByte7) \
+    ELEMENT(MSEHasTransportData) \
+    ELEMENT(MSEHasGuidByte2) \
+    ELEMENT(MSEHasMovementFlags) \
+    ELEMENT(MSEHasGuidByte1) \
+    ELEMENT(MSEHasGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte6) \
+    ELEMENT(MSEHasTransportGuidByte2) \
+    ELEMENT(MSEHasTransportGuidByte5) \
+    ELEMENT(MSEHasTransportTime2) \
+    ELEMENT(MSEHasTransportGuidByte7) \
+    ELEMENT(MSEHasTransportGuidByte4) \
+    ELEMENT(MSEHasTransportTime3) \
+    ELEMENT(MSEHasTransportGuidByte0) \
+    ELEMENT(MSEHasTransportGuidByte1) \
+    ELEMENT(MSEHasTransportGuidByte3) \
+    ELEMENT(MSEMovementFlags2) \
+    ELEMENT(MSEMovementFlags) \
+    ELEMENT(MSEHasFallDirection) \
+    ELEMENT(MSEGuidByte1) \
+    ELEMENT(MSEGuidByte4) \
+    ELEMENT(MSEGuidByte7) \
+    ELEMENT(MSEGuidByte3) \
+    ELEMENT(MSEGuidByte0) \
+    ELEMENT(MSEGuidByte2) \
+    ELEMENT(MSEGuidByte5) \
+    ELEMENT(MSEGuidByte6) \
+    ELEMENT(MSETransportSeat) \
+    ELEMENT(MSETransportOrientation) \
+    ELEMENT(MSETransportTime) \
+    ELEMENT(MSETransportGuidByte6) \
+    ELEMENT(MSETransportGuidByte5) \
+    ELEMENT(MSETransportTime3) \
+    ELEMENT(MSETransportPositionX) \
+    ELEMENT(MSETransportGuidByte4) \
+    ELEMENT(MSETransportPositionZ) \
+    ELEMENT(MSETransportGuidByte2) \
+    ELEMENT(MSETransportGuidByte0) \
+    ELEMENT(MSETransportTime2) \
+    ELEMENT(MSETransportGuidByte1) \
+    ELEMENT(MSETransportGuidByte3) \
+    ELEMENT(MSETransportPositionY) \
+    ELEMENT(MSETransportGuidByte7) \
+    ELEMENT(MSEOrientation) \
+    ELEMENT(MSESplineElevation) \
+    ELEMENT(MSEFallTime) \
+    ELEMENT(MSEFallHorizontalSpeed) \
+    ELEMENT(MSEFallSinAngle) \
+    ELEMENT(MSEFallCosAngle) \
+    ELEMENT(MSEFallVerticalSpeed) \
+    ELEMENT(MSETimestamp) \
+    ELEMENT(MSEPitch) \
+    ELEMENT(MSEEnd)
+MOVEMENT_STATUS_SEQUENCE(CastSpellEmbeddedMovement);
 
 void ExtraMovementStatusElement::ReadNextElement(ByteBuffer& packet)
 {
@@ -5437,219 +5829,676 @@ void PacketSender::Send() const
     }*/
 }
 
-MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
+static MovementStatusCodec const* SelectMovementStatusCodec(Opcodes opcode)
 {
     switch (opcode)
     {
         case CMSG_MOVE_FALL_LAND:
-            return MovementFallLand;
+            return &MovementFallLandCodec;
         case CMSG_MOVE_HEARTBEAT:
-            return MovementHeartBeat;
+            return &MovementHeartBeatCodec;
         case CMSG_MOVE_JUMP:
-            return MovementJump;
+            return &MovementJumpCodec;
         case CMSG_MOVE_SET_FACING:
-            return MovementSetFacing;
+            return &MovementSetFacingCodec;
         case CMSG_MOVE_SET_PITCH:
-            return MovementSetPitch;
+            return &MovementSetPitchCodec;
         case CMSG_MOVE_START_ASCEND:
-           return MovementStartAscend;
+           return &MovementStartAscendCodec;
         case CMSG_MOVE_START_BACKWARD:
-           return MovementStartBackward;
+           return &MovementStartBackwardCodec;
         case CMSG_MOVE_START_DESCEND:
-            return MovementStartDescend;
+            return &MovementStartDescendCodec;
         case CMSG_MOVE_START_FORWARD:
-            return MovementStartForward;
+            return &MovementStartForwardCodec;
         case CMSG_MOVE_START_PITCH_DOWN:
-            return MovementStartPitchDown;
+            return &MovementStartPitchDownCodec;
         case CMSG_MOVE_START_PITCH_UP:
-            return MovementStartPitchUp;
+            return &MovementStartPitchUpCodec;
         case CMSG_MOVE_START_STRAFE_LEFT:
-            return MovementStartStrafeLeft;
+            return &MovementStartStrafeLeftCodec;
         case CMSG_MOVE_START_STRAFE_RIGHT:
-            return MovementStartStrafeRight;
+            return &MovementStartStrafeRightCodec;
         case CMSG_MOVE_START_SWIM:
-            return MovementStartSwim;
+            return &MovementStartSwimCodec;
         case CMSG_MOVE_START_TURN_LEFT:
-            return MovementStartTurnLeft;
+            return &MovementStartTurnLeftCodec;
         case CMSG_MOVE_START_TURN_RIGHT:
-            return MovementStartTurnRight;
+            return &MovementStartTurnRightCodec;
         case CMSG_MOVE_STOP:
-            return MovementStop;
+            return &MovementStopCodec;
         case CMSG_MOVE_STOP_ASCEND:
-            return MovementStopAscend;
+            return &MovementStopAscendCodec;
         case CMSG_MOVE_STOP_PITCH:
-            return MovementStopPitch;
+            return &MovementStopPitchCodec;
         case CMSG_MOVE_STOP_STRAFE:
-            return MovementStopStrafe;
+            return &MovementStopStrafeCodec;
         case CMSG_MOVE_STOP_SWIM:
-            return MovementStopSwim;
+            return &MovementStopSwimCodec;
         case CMSG_MOVE_STOP_TURN:
-            return MovementStopTurn;
+            return &MovementStopTurnCodec;
         case SMSG_MOVE_UPDATE:
-            return PlayerMove;
+            return &PlayerMoveCodec;
         case CMSG_MOVE_CHNG_TRANSPORT:
-            return MoveChngTransport;
+            return &MoveChngTransportCodec;
         //case CMSG_MOVE_SPLINE_DONE:
-        //    return MoveSplineDone;
+        //    return &MoveSplineDoneCodec;
         //case CMSG_MOVE_NOT_ACTIVE_MOVER:
-        //    return MoveNotActiveMover;
+        //    return &MoveNotActiveMoverCodec;
         case CMSG_DISMISS_CONTROLLED_VEHICLE:
-            return DismissControlledVehicle;
+            return &DismissControlledVehicleCodec;
         //case SMSG_MOVE_UPDATE_TELEPORT:
-        //    return MoveUpdateTeleport;
+        //    return &MoveUpdateTeleportCodec;
         //case CMSG_FORCE_MOVE_ROOT_ACK:
-        //    return ForceMoveRootAck;
+        //    return &ForceMoveRootAckCodec;
         //case CMSG_FORCE_MOVE_UNROOT_ACK:
-        //    return ForceMoveUnrootAck;
+        //    return &ForceMoveUnrootAckCodec;
         //case CMSG_MOVE_FALL_RESET:
-        //    return MovementFallReset;
+        //    return &MovementFallResetCodec;
         //case CMSG_MOVE_FEATHER_FALL_ACK:
-        //    return MovementFeatherFallAck;
+        //    return &MovementFeatherFallAckCodec;
         //case CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK:
-        //    return MovementForceFlightSpeedChangeAck;
+        //    return &MovementForceFlightSpeedChangeAckCodec;
         //case CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK:
-        //    return MovementForceRunBackSpeedChangeAck;
+        //    return &MovementForceRunBackSpeedChangeAckCodec;
         //case CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK:
-        //    return MovementForceRunSpeedChangeAck;
+        //    return &MovementForceRunSpeedChangeAckCodec;
         //case CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK:
-        //    return MovementForceSwimSpeedChangeAck;
+        //    return &MovementForceSwimSpeedChangeAckCodec;
         //case CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK:
-        //    return MovementForceWalkSpeedChangeAck;
+        //    return &MovementForceWalkSpeedChangeAckCodec;
         //case CMSG_MOVE_GRAVITY_DISABLE_ACK:
-        //    return MovementGravityDisableAck;
+        //    return &MovementGravityDisableAckCodec;
         //case CMSG_MOVE_GRAVITY_ENABLE_ACK:
-        //    return MovementGravityEnableAck;
+        //    return &MovementGravityEnableAckCodec;
         //case CMSG_MOVE_HOVER_ACK:
-        //    return MovementHoverAck;
+        //    return &MovementHoverAckCodec;
         case CMSG_MOVE_KNOCK_BACK_ACK:
-            return MovementKnockBackAck;
+            return &MovementKnockBackAckCodec;
         //case CMSG_MOVE_SET_CAN_FLY:
-        //    return MovementSetCanFly;
+        //    return &MovementSetCanFlyCodec;
         case CMSG_MOVE_SET_CAN_FLY_ACK:
-            return MovementSetCanFlyAck;
+            return &MovementSetCanFlyAckCodec;
         //case CMSG_MOVE_SET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY_ACK:
-        //    return MovementSetCanTransitionBetweenSwimAndFlyAck;
+        //    return &MovementSetCanTransitionBetweenSwimAndFlyAckCodec;
         case CMSG_MOVE_SET_COLLISION_HEIGHT_ACK:
-            return MovementSetCollisionHeightAck;
+            return &MovementSetCollisionHeightAckCodec;
         //case SMSG_MOVE_UPDATE_COLLISION_HEIGHT:
-        //    return MovementUpdateCollisionHeight;
+        //    return &MovementUpdateCollisionHeightCodec;
         //case CMSG_MOVE_WATER_WALK_ACK:
-        //    return MovementWaterWalkAck;
+        //    return &MovementWaterWalkAckCodec;
         //case MSG_MOVE_SET_RUN_MODE:
-        //    return MovementSetRunMode;
+        //    return &MovementSetRunModeCodec;
         //case MSG_MOVE_SET_WALK_MODE:
-        //    return MovementSetWalkMode;
+        //    return &MovementSetWalkModeCodec;
         //case SMSG_MOVE_UPDATE_FLIGHT_SPEED:
-        //    return MovementUpdateFlightSpeed;
+        //    return &MovementUpdateFlightSpeedCodec;
         //case SMSG_MOVE_UPDATE_RUN_SPEED:
-        //    return MovementUpdateRunSpeed;
+        //    return &MovementUpdateRunSpeedCodec;
         //case SMSG_MOVE_UPDATE_KNOCK_BACK:
-        //    return MovementUpdateKnockBack;
+        //    return &MovementUpdateKnockBackCodec;
         //case SMSG_MOVE_UPDATE_RUN_BACK_SPEED:
-        //    return MovementUpdateRunBackSpeed;
+        //    return &MovementUpdateRunBackSpeedCodec;
         //case SMSG_MOVE_UPDATE_SWIM_SPEED:
-        //    return MovementUpdateSwimSpeed;
+        //    return &MovementUpdateSwimSpeedCodec;
         //case SMSG_MOVE_UPDATE_WALK_SPEED:
-        //    return MovementUpdateWalkSpeed;
+        //    return &MovementUpdateWalkSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_WALK_SPEED:
-            return SplineMoveSetWalkSpeed;
+            return &SplineMoveSetWalkSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_RUN_SPEED:
-            return SplineMoveSetRunSpeed;
+            return &SplineMoveSetRunSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_RUN_BACK_SPEED:
-            return SplineMoveSetRunBackSpeed;
+            return &SplineMoveSetRunBackSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_SWIM_SPEED:
-            return SplineMoveSetSwimSpeed;
+            return &SplineMoveSetSwimSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_SWIM_BACK_SPEED:
-            return SplineMoveSetSwimBackSpeed;
+            return &SplineMoveSetSwimBackSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_TURN_RATE:
-            return SplineMoveSetTurnRate;
+            return &SplineMoveSetTurnRateCodec;
         case SMSG_SPLINE_MOVE_SET_FLIGHT_SPEED:
-            return SplineMoveSetFlightSpeed;
+            return &SplineMoveSetFlightSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_FLIGHT_BACK_SPEED:
-            return SplineMoveSetFlightBackSpeed;
+            return &SplineMoveSetFlightBackSpeedCodec;
         case SMSG_SPLINE_MOVE_SET_PITCH_RATE:
-            return SplineMoveSetPitchRate;
+            return &SplineMoveSetPitchRateCodec;
         case SMSG_MOVE_SET_WALK_SPEED:
-            return MoveSetWalkSpeed;
+            return &MoveSetWalkSpeedCodec;
         case SMSG_MOVE_SET_RUN_SPEED:
-            return MoveSetRunSpeed;
+            return &MoveSetRunSpeedCodec;
         case SMSG_MOVE_SET_RUN_BACK_SPEED:
-            return MoveSetRunBackSpeed;
+            return &MoveSetRunBackSpeedCodec;
         case SMSG_MOVE_SET_SWIM_SPEED:
-            return MoveSetSwimSpeed;
+            return &MoveSetSwimSpeedCodec;
         case SMSG_MOVE_SET_SWIM_BACK_SPEED:
-            return MoveSetSwimBackSpeed;
+            return &MoveSetSwimBackSpeedCodec;
         case SMSG_MOVE_SET_TURN_RATE:
-            return MoveSetTurnRate;
+            return &MoveSetTurnRateCodec;
         case SMSG_MOVE_SET_FLIGHT_SPEED:
-           return MoveSetFlightSpeed;
+           return &MoveSetFlightSpeedCodec;
         case SMSG_MOVE_SET_FLIGHT_BACK_SPEED:
-            return MoveSetFlightBackSpeed;
+            return &MoveSetFlightBackSpeedCodec;
         case SMSG_MOVE_SET_PITCH_RATE:
-            return MoveSetPitchRate;
+            return &MoveSetPitchRateCodec;
         case SMSG_SPLINE_MOVE_SET_WALK_MODE:
-            return SplineMoveSetWalkMode;
+            return &SplineMoveSetWalkModeCodec;
         case SMSG_SPLINE_MOVE_SET_RUN_MODE:
-            return SplineMoveSetRunMode;
+            return &SplineMoveSetRunModeCodec;
         //case SMSG_SPLINE_MOVE_GRAVITY_DISABLE:
-        //    return SplineMoveGravityDisable;
+        //    return &SplineMoveGravityDisableCodec;
         //case SMSG_SPLINE_MOVE_GRAVITY_ENABLE:
-        //    return SplineMoveGravityEnable;
+        //    return &SplineMoveGravityEnableCodec;
         case SMSG_SPLINE_MOVE_SET_HOVER:
-            return SplineMoveSetHover;
+            return &SplineMoveSetHoverCodec;
         case SMSG_SPLINE_MOVE_UNSET_HOVER:
-            return SplineMoveUnsetHover;
+            return &SplineMoveUnsetHoverCodec;
         case CMSG_MOVE_SET_FLY:
-            return SetCanFly;
+            return &SetCanFlyCodec;
         //case SMSG_SPLINE_MOVE_START_SWIM:
-        //    return SplineMoveStartSwim;
+        //    return &SplineMoveStartSwimCodec;
         //case SMSG_SPLINE_MOVE_STOP_SWIM:
-        //    return SplineMoveStopSwim;
+        //    return &SplineMoveStopSwimCodec;
         case SMSG_SPLINE_MOVE_SET_FLYING:
-            return SplineMoveSetFlying;
+            return &SplineMoveSetFlyingCodec;
         case SMSG_SPLINE_MOVE_UNSET_FLYING:
-            return SplineMoveUnsetFlying;
+            return &SplineMoveUnsetFlyingCodec;
         case SMSG_SPLINE_MOVE_SET_WATER_WALK:
-            return SplineMoveSetWaterWalk;
+            return &SplineMoveSetWaterWalkCodec;
         case SMSG_SPLINE_MOVE_SET_LAND_WALK:
-            return SplineMoveSetLandWalk;
+            return &SplineMoveSetLandWalkCodec;
         case SMSG_SPLINE_MOVE_SET_FEATHER_FALL:
-            return SplineMoveSetFeatherFall;
+            return &SplineMoveSetFeatherFallCodec;
         case SMSG_SPLINE_MOVE_SET_NORMAL_FALL:
-            return SplineMoveSetNormalFall;
+            return &SplineMoveSetNormalFallCodec;
         case SMSG_SPLINE_MOVE_ROOT:
-            return SplineMoveRoot;
+            return &SplineMoveRootCodec;
         case SMSG_SPLINE_MOVE_UNROOT:
-            return SplineMoveUnroot;
+            return &SplineMoveUnrootCodec;
         case SMSG_MOVE_SET_CAN_FLY:
-            return MoveSetCanFly;
+            return &MoveSetCanFlyCodec;
         case SMSG_MOVE_UNSET_CAN_FLY:
-            return MoveUnsetCanFly;
+            return &MoveUnsetCanFlyCodec;
         case SMSG_MOVE_SET_HOVER:
-            return MoveSetHover;
+            return &MoveSetHoverCodec;
         case SMSG_MOVE_UNSET_HOVER:
-            return MoveUnsetHover;
+            return &MoveUnsetHoverCodec;
         case SMSG_MOVE_WATER_WALK:
-            return MoveWaterWalk;
+            return &MoveWaterWalkCodec;
         case SMSG_MOVE_LAND_WALK:
-            return MoveLandWalk;
+            return &MoveLandWalkCodec;
         case SMSG_MOVE_FEATHER_FALL:
-            return MoveFeatherFall;
+            return &MoveFeatherFallCodec;
         case SMSG_MOVE_NORMAL_FALL:
-            return MoveNormalFall;
+            return &MoveNormalFallCodec;
         case SMSG_MOVE_ROOT:
-            return MoveRoot;
+            return &MoveRootCodec;
         case SMSG_MOVE_UNROOT:
-            return MoveUnroot;
+            return &MoveUnrootCodec;
         //case CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE:
-        //    return ChangeSeatsOnControlledVehicle;
+        //    return &ChangeSeatsOnControlledVehicleCodec;
         //case CMSG_CAST_SPELL:
         //case CMSG_PET_CAST_SPELL:
         //case CMSG_USE_ITEM:
-        //    return CastSpellEmbeddedMovement;*/
+        //    return &CastSpellEmbeddedMovementCodec;*/
         default:
             break;
     }
 
     return NULL;
 }
+
+// opcode indexed lookup, replaces the switch above on the packet path
+class MovementStatusCodecTable
+{
+    public:
+        MovementStatusCodecTable()
+        {
+            for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+                m_codecs[opcode] = SelectMovementStatusCodec(Opcodes(opcode));
+        }
+
+        MovementStatusCodec const* Get(Opcodes opcode) const
+        {
+            return uint32(opcode) < NUM_OPCODE_HANDLERS ? m_codecs[opcode] : NULL;
+        }
+
+    private:
+        MovementStatusCodec const* m_codecs[NUM_OPCODE_HANDLERS];
+};
+
+static MovementStatusCodecTable const MovementStatusCodecs;
+
+MovementStatusCodec const* GetMovementStatusCodec(Opcodes opcode)
+{
+    return MovementStatusCodecs.Get(opcode);
+}
+
+MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
+{
+    MovementStatusCodec const* codec = GetMovementStatusCodec(opcode);
+    return codec ? codec->Sequence : NULL;
+}
+
+bool ReadMovementStatusSequence(MovementStatusElements const* sequence, ByteBuffer& data, MovementInfo* mi, ExtraMovementStatusElement* extras)
+{
+    bool hasTransportData = false;
+    bool hasSpline = false;
+
+    uint32 bitcounterLoop = 0;
+
+    ObjectGuid guid;
+    ObjectGuid tguid;
+
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const& element = *sequence;
+        if (element == MSEEnd)
+            break;
+
+        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        {
+            guid[element - MSEHasGuidByte0] = data.ReadBit();
+            continue;
+        }
+
+        if (element >= MSEHasTransportGuidByte0 &&
+            element <= MSEHasTransportGuidByte7)
+        {
+            if (hasTransportData)
+                tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+            continue;
+        }
+
+        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        {
+            data.ReadByteSeq(guid[element - MSEGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSETransportGuidByte0 &&
+            element <= MSETransportGuidByte7)
+        {
+            if (hasTransportData)
+                data.ReadByteSeq(tguid[element - MSETransportGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEGenericDword0 &&
+            element <= MSEGenericDword7)
+        {
+            data.read_skip<uint32>();
+            continue;
+        }
+
+        switch (element)
+        {
+            case MSEExtraElement:
+                extras->ReadNextElement(data);
+                break;
+            case MSEGeneric2bits0:
+                data.ReadBits(2);
+                break;
+            case MSEUnkUIntCount:
+                bitcounterLoop = data.ReadBits(22);
+                break;
+            case MSEUnkUIntLoop:
+                data.read_skip(bitcounterLoop * sizeof(uint32));
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                mi->flags = !data.ReadBit();
+                break;
+            case MSEHasMovementFlags2:
+                mi->flags2 = !data.ReadBit();
+                break;
+            case MSEHasTimestamp:
+                mi->time = !data.ReadBit();
+                break;
+            case MSEHasOrientation:
+                mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
+                break;
+            case MSEHasTransportData:
+                hasTransportData = data.ReadBit();
+                break;
+            case MSEHasTransportTime2:
+                if (hasTransportData)
+                    mi->has_t_time2 = data.ReadBit();
+                break;
+            case MSEHasTransportTime3:
+                if (hasTransportData)
+                    mi->has_t_time3 = data.ReadBit();
+                break;
+            case MSEHasPitch:
+                mi->HavePitch = !data.ReadBit();
+                break;
+            case MSEHasFallData:
+                mi->hasFallData = data.ReadBit();
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    mi->hasFallDirection = data.ReadBit();
+                break;
+            case MSEHasSplineElevation:
+                mi->HaveSplineElevation = !data.ReadBit();
+                break;
+            case MSEHasSpline:
+                hasSpline = data.ReadBit();
+                break;
+            case MSEMovementFlags:
+                if (mi->flags)
+                    mi->flags = data.ReadBits(30);
+                break;
+            case MSEMovementFlags2:
+                if (mi->flags2)
+                    mi->flags2 = data.ReadBits(13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data >> mi->time;
+                break;
+            case MSEPositionX:
+                data >> mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data >> mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data >> mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.m_orientation != 0.0f)
+                    mi->pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportPositionX:
+                if (hasTransportData)
+                    data >> mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (hasTransportData)
+                    data >> mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (hasTransportData)
+                    data >> mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (hasTransportData)
+                    mi->t_pos.SetOrientation(data.read<float>());
+                break;
+            case MSETransportSeat:
+                if (hasTransportData)
+                    data >> mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (hasTransportData)
+                    data >> mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (hasTransportData && mi->has_t_time2)
+                    data >> mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (hasTransportData && mi->has_t_time3)
+                    data >> mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data >> mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data >> mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data >> mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data >> mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data >> mi->splineElevation;
+                break;
+            case MSEZeroBit:
+            case MSEOneBit:
+                data.ReadBit();
+                break;
+            case MSEHasUnkTime:
+                mi->Alive32 = !data.ReadBit();
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data >> mi->Alive32;
+                break;
+            case MSECounter:
+                data.read_skip<uint32>();
+                break;
+            default:
+                ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
+                break;
+        }
+    }
+
+    mi->guid = guid;
+    mi->t_guid = tguid;
+
+    return hasTransportData;
+}
+
+void WriteMovementStatusSequence(MovementStatusElements const* sequence, ByteBuffer& data, MovementInfo const* mi, ExtraMovementStatusElement* extras)
+{
+    bool hasMovementFlags = mi->GetMovementFlags() != 0;
+    bool hasMovementFlags2 = mi->GetExtraMovementFlags() != 0;
+    bool hasTransportData = mi->t_guid != 0LL;
+
+    ObjectGuid guid = mi->guid;
+    ObjectGuid tguid = mi->t_guid;
+
+    for (; *sequence != MSEEnd; ++sequence)
+    {
+        MovementStatusElements const& element = *sequence;
+        if (element == MSEEnd)
+            break;
+
+        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        {
+            data.WriteBit(guid[element - MSEHasGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEHasTransportGuidByte0 &&
+            element <= MSEHasTransportGuidByte7)
+        {
+            if (hasTransportData)
+                data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        {
+            data.WriteByteSeq(guid[element - MSEGuidByte0]);
+            continue;
+        }
+
+        if (element >= MSETransportGuidByte0 &&
+            element <= MSETransportGuidByte7)
+        {
+            if (hasTransportData)
+                data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
+            continue;
+        }
+
+        switch (element)
+        {
+            case MSEExtraElement:
+                extras->WriteNextElement(data);
+                break;
+            case MSEUnkUIntCount:
+                data.WriteBits(0, 22);
+                break;
+            case MSEUnkUIntLoop:
+                for (uint8 m = 0; m < 0; ++m)
+                {
+                    data << uint32(0);
+                }
+                break;
+            case MSECounter:
+                data << uint32(0); // movement counter
+                break;
+            case MSEFlushBits:
+                data.FlushBits();
+                break;
+            case MSEHasMovementFlags:
+                data.WriteBit(!hasMovementFlags);
+                break;
+            case MSEHasMovementFlags2:
+                data.WriteBit(!hasMovementFlags2);
+                break;
+            case MSEHasTimestamp:
+                data.WriteBit(!mi->time);
+                break;
+            case MSEHasOrientation:
+                data.WriteBit(!mi->pos.HaveOrientation());
+                break;
+            case MSEHasTransportData:
+                data.WriteBit(hasTransportData);
+                break;
+            case MSEHasTransportTime2:
+                if (hasTransportData)
+                    data.WriteBit(mi->has_t_time2);
+                break;
+            case MSEHasTransportTime3:
+                if (hasTransportData)
+                    data.WriteBit(mi->has_t_time3);
+                break;
+            case MSEHasPitch:
+                data.WriteBit(!mi->HavePitch);
+                break;
+            case MSEHasFallData:
+                data.WriteBit(mi->hasFallData);
+                break;
+            case MSEHasFallDirection:
+                if (mi->hasFallData)
+                    data.WriteBit(mi->hasFallDirection);
+                break;
+            case MSEHasSplineElevation:
+                data.WriteBit(!mi->HaveSplineElevation);
+                break;
+            case MSEHasSpline:
+                data.WriteBit(false);
+                break;
+            case MSEMovementFlags:
+                if (hasMovementFlags)
+                    data.WriteBits(mi->flags, 30);
+                break;
+            case MSEMovementFlags2:
+                if (hasMovementFlags2)
+                    data.WriteBits(mi->flags2, 13);
+                break;
+            case MSETimestamp:
+                if (mi->time)
+                    data << mi->time;
+                break;
+            case MSEPositionX:
+                data << mi->pos.m_positionX;
+                break;
+            case MSEPositionY:
+                data << mi->pos.m_positionY;
+                break;
+            case MSEPositionZ:
+                data << mi->pos.m_positionZ;
+                break;
+            case MSEOrientation:
+                if (mi->pos.HaveOrientation())
+                    data << mi->pos.GetOrientation();
+                break;
+            case MSETransportPositionX:
+                if (hasTransportData)
+                    data << mi->t_pos.m_positionX;
+                break;
+            case MSETransportPositionY:
+                if (hasTransportData)
+                    data << mi->t_pos.m_positionY;
+                break;
+            case MSETransportPositionZ:
+                if (hasTransportData)
+                    data << mi->t_pos.m_positionZ;
+                break;
+            case MSETransportOrientation:
+                if (hasTransportData)
+                    data << mi->t_pos.GetOrientation();
+                break;
+            case MSETransportSeat:
+                if (hasTransportData)
+                    data << mi->t_seat;
+                break;
+            case MSETransportTime:
+                if (hasTransportData)
+                    data << mi->t_time;
+                break;
+            case MSETransportTime2:
+                if (hasTransportData && mi->has_t_time2)
+                    data << mi->t_time2;
+                break;
+            case MSETransportTime3:
+                if (hasTransportData && mi->has_t_time3)
+                    data << mi->t_time3;
+                break;
+            case MSEPitch:
+                if (mi->HavePitch)
+                    data << mi->pitch;
+                break;
+            case MSEFallTime:
+                if (mi->hasFallData)
+                    data << mi->fallTime;
+                break;
+            case MSEFallVerticalSpeed:
+                if (mi->hasFallData)
+                    data << mi->j_zspeed;
+                break;
+            case MSEFallCosAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_cosAngle;
+                break;
+            case MSEFallSinAngle:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_sinAngle;
+                break;
+            case MSEFallHorizontalSpeed:
+                if (mi->hasFallData && mi->hasFallDirection)
+                    data << mi->j_xyspeed;
+                break;
+            case MSESplineElevation:
+                if (mi->HaveSplineElevation)
+                    data << mi->splineElevation;
+                break;
+            case MSEZeroBit:
+                data.WriteBit(0);
+                break;
+            case MSEOneBit:
+                data.WriteBit(1);
+                break;
+            case MSEHasUnkTime:
+                data.WriteBit(!mi->Alive32);
+                break;
+            case MSEUnkTime:
+                if (mi->Alive32)
+                    data << mi->Alive32;
+                break;
+            default:
+                ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
+                break;
+        }
+    }
+}
@@ -25,6 +25,7 @@
 
 class ByteBuffer;
 class Unit;
+struct MovementInfo;
 
 enum MovementStatusElements
 {
@@ -158,6 +159,22 @@ enum MovementStatusElements
 
     bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
 
+typedef bool (*MovementStatusReader)(ByteBuffer& data, MovementInfo* mi, ExtraMovementStatusElement* extras);
+typedef void (*MovementStatusWriter)(ByteBuffer& data, MovementInfo const* mi, ExtraMovementStatusElement* extras);
+
+// Reader and writer generated from one of the sequences in MovementStructures.cpp
+struct MovementStatusCodec
+{
+    MovementStatusElements const* Sequence;
+    MovementStatusReader Read;      // returns true when the packet contained transport data
+    MovementStatusWriter Write;
+};
+
+MovementStatusCodec const* GetMovementStatusCodec(Opcodes opcode);
 MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode);
 
+// Element by element interpreters of a sequence, reference implementation for the generated codecs
+bool ReadMovementStatusSequence(MovementStatusElements const* sequence, ByteBuffer& data, MovementInfo* mi, ExtraMovementStatusElement* extras);
+void WriteMovementStatusSequence(MovementStatusElements const* sequence, ByteBuffer& data, MovementInfo const* mi, ExtraMovementStatusElement* extras);
+
 #endif
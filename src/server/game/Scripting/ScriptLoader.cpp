@@ -82,6 +82,9 @@ void AddSC_tele_commandscript();
 void AddSC_ticket_commandscript();
 void AddSC_titles_commandscript();
 void AddSC_wp_commandscript();
+#ifdef TRINITY_BENCHMARKS
+void AddSC_bench_commandscript();
+#endif
 
 #ifdef SCRIPTS
 //world
@@ -876,6 +879,9 @@ void AddCommandScripts()
     AddSC_ticket_commandscript();
     AddSC_titles_commandscript();
     AddSC_wp_commandscript();
+#ifdef TRINITY_BENCHMARKS
+    AddSC_bench_commandscript();
+#endif
 }
 
 void AddWorldScripts()
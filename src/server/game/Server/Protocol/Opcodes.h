@@ -1609,6 +1609,17 @@ enum PacketProcessing
     PROCESS_THREADSAFE                                          // packet is thread-safe - process it in Map::Update()
 };
 
+// Global managers an opcode handler reaches. A PROCESS_THREADSAFE handler runs on its player's map thread
+// and may only touch the managers it declares, through work posted with WorldSession::PostToWorld.
+enum OpcodeGlobalAccess
+{
+    GLOBAL_ACCESS_NONE          = 0x00,
+    GLOBAL_ACCESS_GUILD         = 0x01,                         // sGuildMgr and the Guild objects
+    GLOBAL_ACCESS_GROUP         = 0x02,                         // sGroupMgr and the Group objects
+    GLOBAL_ACCESS_MAIL          = 0x04,                         // the player's mailbox, also filled by other players' handlers
+    GLOBAL_ACCESS_LFG           = 0x08                          // sLFGMgr
+};
+
 class WorldPacket;
 class WorldSession;
 
@@ -1617,13 +1628,14 @@ typedef void(WorldSession::*pOpcodeHandler)(WorldPacket& recvPacket);
 struct OpcodeHandler
 {
     OpcodeHandler() {}
-    OpcodeHandler(char const* _name, SessionStatus _status, PacketProcessing _processing, pOpcodeHandler _handler)
-        : name(_name), status(_status), packetProcessing(_processing), handler(_handler) {}
+    OpcodeHandler(char const* _name, SessionStatus _status, PacketProcessing _processing, pOpcodeHandler _handler, uint32 _globalAccess = GLOBAL_ACCESS_NONE)
+        : name(_name), status(_status), packetProcessing(_processing), handler(_handler), globalAccess(_globalAccess) {}
 
     char const* name;
     SessionStatus status;
     PacketProcessing packetProcessing;
     pOpcodeHandler handler;
+    uint32 globalAccess;                                        // OpcodeGlobalAccess mask
 };
 
 extern OpcodeHandler* opcodeTable[TRANSFER_DIRECTION_MAX][NUM_OPCODE_HANDLERS];
@@ -46,6 +46,9 @@
 #include "WardenWin.h"
 #include "WardenMac.h"
 
+#include <ace/Guard_T.h>
+#include <ace/OS_NS_sys_time.h>
+
 bool MapSessionFilter::Process(WorldPacket* packet)
 {
     Opcodes opcode = DropHighBytes(packet->GetOpcode());
@@ -90,6 +93,62 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return (player->IsInWorld() == false);
 }
 
+namespace
+{
+    ACE_Thread_Mutex s_loginLatencyLock;
+    LoginLatencyStats s_loginLatency;
+}
+
+void WorldSession::RecordLoginLatency(uint32 const* stageTimes)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, s_loginLatencyLock);
+
+    ++s_loginLatency.Logins;
+    for (uint8 i = 0; i < MAX_LOGIN_STAGES; ++i)
+    {
+        s_loginLatency.TotalTime[i] += stageTimes[i];
+        if (stageTimes[i] > s_loginLatency.MaxTime[i])
+            s_loginLatency.MaxTime[i] = stageTimes[i];
+    }
+}
+
+LoginLatencyStats WorldSession::GetLoginLatencyStats()
+{
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, s_loginLatencyLock, LoginLatencyStats());
+    return s_loginLatency;
+}
+
+namespace
+{
+    // written and read by the world thread only: World::UpdateSessions, chat and console commands
+    WorldSession::OpcodeTimeStatsMap s_worldThreadOpcodes;
+
+    uint32 GetMicroTimeDiff(ACE_Time_Value const& start)
+    {
+        ACE_Time_Value diff = ACE_OS::gettimeofday() - start;
+        return uint32(diff.sec() * 1000000 + diff.usec());
+    }
+}
+
+void WorldSession::RecordWorldThreadOpcode(uint16 opcode, uint32 time)
+{
+    OpcodeTimeStats& stats = s_worldThreadOpcodes[opcode];
+    ++stats.Count;
+    stats.TotalTime += time;
+    if (time > stats.MaxTime)
+        stats.MaxTime = time;
+}
+
+WorldSession::OpcodeTimeStatsMap const& WorldSession::GetWorldThreadOpcodeStats()
+{
+    return s_worldThreadOpcodes;
+}
+
+void WorldSession::ResetWorldThreadOpcodeStats()
+{
+    s_worldThreadOpcodes.clear();
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, bool ispremium, uint8 expansion, time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter):
 m_muteTime(mute_time), m_timeOutTime(0), _player(NULL), m_Socket(sock),
@@ -99,7 +158,7 @@ m_playerRecentlyLogout(false), m_playerSave(false),
 m_sessionDbcLocale(sWorld->GetAvailableDbcLocale(locale)),
 m_sessionDbLocaleIndex(locale),
 m_latency(0), m_clientTimeDelay(0), m_TutorialsChanged(false), recruiterId(recruiter),
-isRecruiter(isARecruiter), timeLastWhoCommand(0),
+isRecruiter(isARecruiter), _mapThreadHandler(NULL), timeLastWhoCommand(0),
 timeLastChannelInviteCommand(0), timeLastGroupInviteCommand(0), timeLastGuildInviteCommand(0), timeLastChannelPassCommand(0),
 timeLastChannelMuteCommand(0), timeLastChannelBanCommand(0), timeLastChannelUnbanCommand(0), timeLastChannelAnnounceCommand(0),
 timeLastChannelModerCommand(0), timeLastChannelOwnerCommand(0),
@@ -162,6 +221,10 @@ WorldSession::~WorldSession()
     while (_recvQueue.next(packet))
         delete packet;
 
+    WorldSessionMessage* message = NULL;
+    while (_worldMessages.next(message))
+        delete message;
+
     LoginDatabase.PExecute("UPDATE account SET online = 0 WHERE id = %u;", GetAccountId());     // One-time query
 
     int32 z_res = deflateEnd(_compressionStream);
@@ -330,6 +393,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     //! loop caused by re-enqueueing the same packets over and over again, we stop updating this session
     //! and continue updating others. The re-enqueued packets will be handled in the next Update call for this session.
     uint32 processedPackets = 0;
+
+    // work handed over by this session's handlers during the last map update
+    if (updater.ProcessLogout())
+        ProcessWorldMessages();
+
     while (m_Socket && !m_Socket->IsClosed() &&
             !_recvQueue.empty() && _recvQueue.peek(true) != firstDelayedPacket &&
             _recvQueue.next(packet, updater))
@@ -337,6 +405,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         const OpcodeHandler* opHandle = opcodeTable[WOW_CLIENT][packet->GetOpcode()];
         uint32 pktTime = getMSTime();
 
+        // thread-unsafe handlers are what keeps packets on the world thread, see .debug opcodestats
+        bool timeOnWorld = updater.ProcessLogout() && opHandle->packetProcessing == PROCESS_THREADUNSAFE;
+        ACE_Time_Value handlerStart = timeOnWorld ? ACE_OS::gettimeofday() : ACE_Time_Value::zero;
+        _mapThreadHandler = updater.ProcessLogout() ? NULL : opHandle;
+
         try
         {
             switch (opHandle->status)
@@ -430,6 +503,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             packet->hexlike();
         }
 
+        _mapThreadHandler = NULL;
+        if (timeOnWorld)
+            RecordWorldThreadOpcode(packet->GetOpcode(), GetMicroTimeDiff(handlerStart));
+
         nbPacket++;
 
         std::map<uint32, OpcodeInfo>::iterator itr = pktHandle.find(packet->GetOpcode());
@@ -505,6 +582,39 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     return true;
 }
 
+void WorldSession::PostToWorld(OpcodeGlobalAccess access, pOpcodeHandler handler, WorldPacket const& message)
+{
+    if (!_mapThreadHandler)
+    {
+        WorldPacket packet(message);
+        (this->*handler)(packet);
+        return;
+    }
+
+    if (!(_mapThreadHandler->globalAccess & access))
+        sLog->outError(LOG_FILTER_NETWORKIO, "%s posted work for global access 0x%X to the world thread without declaring it in its opcode table entry.",
+            _mapThreadHandler->name, uint32(access));
+
+    _worldMessages.add(new WorldSessionMessage(handler, message));
+}
+
+void WorldSession::ProcessWorldMessages()
+{
+    WorldSessionMessage* message = NULL;
+    while (_worldMessages.next(message))
+    {
+        // the player may have logged out since the message was posted
+        if (_player)
+        {
+            ACE_Time_Value start = ACE_OS::gettimeofday();
+            (this->*message->Handler)(message->Packet);
+            RecordWorldThreadOpcode(message->Packet.GetOpcode(), GetMicroTimeDiff(start));
+        }
+
+        delete message;
+    }
+}
+
 /// %Log the player out
 void WorldSession::LogoutPlayer(bool Save)
 {
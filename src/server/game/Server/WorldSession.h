@@ -203,6 +203,49 @@ public:
     virtual bool Process(WorldPacket* packet);
 };
 
+// Where the time between CMSG_PLAYER_LOGIN and the player entering the world goes
+enum LoginLatencyStage
+{
+    LOGIN_STAGE_QUEUE       = 0,                            // login queries waiting for a free async connection
+    LOGIN_STAGE_DATABASE    = 1,                            // first login query started until the last one finished
+    LOGIN_STAGE_DISPATCH    = 2,                            // results ready until the session picked them up
+    LOGIN_STAGE_WORLD       = 3,                            // HandlePlayerLogin
+    LOGIN_STAGE_TOTAL       = 4,
+    MAX_LOGIN_STAGES
+};
+
+struct LoginLatencyStats
+{
+    LoginLatencyStats() : Logins(0)
+    {
+        memset(TotalTime, 0, sizeof(TotalTime));
+        memset(MaxTime, 0, sizeof(MaxTime));
+    }
+
+    uint32 Logins;
+    uint64 TotalTime[MAX_LOGIN_STAGES];
+    uint32 MaxTime[MAX_LOGIN_STAGES];
+};
+
+// Time the world thread spent on one opcode, in microseconds
+struct OpcodeTimeStats
+{
+    OpcodeTimeStats() : Count(0), TotalTime(0), MaxTime(0) { }
+
+    uint32 Count;
+    uint64 TotalTime;
+    uint32 MaxTime;
+};
+
+// Remainder of a map thread handler posted to the world thread with WorldSession::PostToWorld
+struct WorldSessionMessage
+{
+    WorldSessionMessage(pOpcodeHandler handler, WorldPacket const& packet) : Handler(handler), Packet(packet) { }
+
+    pOpcodeHandler Handler;
+    WorldPacket Packet;                                     // keeps the opcode of the packet that posted it
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -248,6 +291,18 @@ class WorldSession
         bool PlayerLogoutWithSave() const { return m_playerLogout && m_playerSave; }
         bool PlayerRecentlyLoggedOut() const { return m_playerRecentlyLogout; }
 
+        static void RecordLoginLatency(uint32 const* stageTimes);
+        static LoginLatencyStats GetLoginLatencyStats();
+
+        typedef UNORDERED_MAP<uint16, OpcodeTimeStats> OpcodeTimeStatsMap;
+        static void RecordWorldThreadOpcode(uint16 opcode, uint32 time);
+        static OpcodeTimeStatsMap const& GetWorldThreadOpcodeStats();
+        static void ResetWorldThreadOpcodeStats();
+
+        // Runs handler on the world thread with a copy of message, inline when already there. The packet
+        // being handled on a map thread must declare access in its DEFINE_OPCODE_HANDLER_GLOBAL entry.
+        void PostToWorld(OpcodeGlobalAccess access, pOpcodeHandler handler, WorldPacket const& message);
+
         void ReadAddonsInfo(WorldPacket& data);
         void SendAddonsInfo();
         bool IsAddonRegistered(const std::string& prefix) const;
@@ -270,6 +325,7 @@ class WorldSession
         bool IsPremium() const { return _ispremium; }
         uint32 GetAccountId() const { return _accountId; }
         Player* GetPlayer() const { return _player; }
+        WorldSocket* GetSocket() const { return m_Socket; }
         std::string GetPlayerName(bool simple = true) const;
         uint32 GetGuidLow() const;
         void SetSecurity(AccountTypes security) { _security = security; }
@@ -705,6 +761,7 @@ class WorldSession
         void HandleAuctionListPendingSales(WorldPacket& recvData);
 
         void HandleGetMailList(WorldPacket& recvData);
+        void HandleGetMailListOnWorld(WorldPacket& message);
         void HandleSendMail(WorldPacket& recvData);
         void HandleMailTakeMoney(WorldPacket& recvData);
         void HandleMailTakeItem(WorldPacket& recvData);
@@ -959,7 +1016,9 @@ class WorldSession
         void HandleGuildPermissions(WorldPacket& recvData);
         void HandleGuildBankMoneyWithdrawn(WorldPacket& recvData);
         void HandleGuildBankerActivate(WorldPacket& recvData);
+        void HandleGuildBankerActivateOnWorld(WorldPacket& message);
         void HandleGuildBankQueryTab(WorldPacket& recvData);
+        void HandleGuildBankQueryTabOnWorld(WorldPacket& message);
         void HandleGuildBankLogQuery(WorldPacket& recvData);
         void HandleGuildBankDepositMoney(WorldPacket& recvData);
         void HandleGuildBankWithdrawMoney(WorldPacket& recvData);
@@ -1068,6 +1127,7 @@ class WorldSession
     private:
         void InitializeQueryCallbackParameters();
         void ProcessQueryCallbacks();
+        void ProcessWorldMessages();
 
         PreparedQueryResultFuture _charEnumCallback;
         PreparedQueryResultFuture _addIgnoreCallback;
@@ -1132,6 +1192,8 @@ class WorldSession
         uint32 recruiterId;
         bool isRecruiter;
         ACE_Based::LockedQueue<WorldPacket*, ACE_Thread_Mutex> _recvQueue;
+        ACE_Based::LockedQueue<WorldSessionMessage*, ACE_Thread_Mutex> _worldMessages;
+        OpcodeHandler const* _mapThreadHandler;             // handler running on a map thread, NULL on the world thread
         time_t timeLastWhoCommand;
         time_t timeCharEnumOpcode;
         time_t timeLastChannelInviteCommand;
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "AuraUpdateQueue.h"
+#include "SpellAuras.h"
+#include "Unit.h"
+
+namespace
+{
+    // owner time wraps around, only the distance between two points is meaningful
+    inline bool IsEarlier(uint32 time, uint32 other)
+    {
+        return int32(time - other) < 0;
+    }
+}
+
+void AuraUpdateQueue::Add(Aura* aura)
+{
+    ASSERT(aura->m_updateQueueState == AURA_UPDATE_QUEUE_NONE);
+
+    aura->m_lastUpdateTime = m_time;
+    AddTicking(aura);
+}
+
+void AuraUpdateQueue::Remove(Aura* aura)
+{
+    switch (aura->m_updateQueueState)
+    {
+        case AURA_UPDATE_QUEUE_TICKING:
+            m_ticking[aura->m_updateQueueIndex] = NULL;
+            break;
+        case AURA_UPDATE_QUEUE_SLEEPING:
+            RemoveSleeping(aura->m_updateQueueIndex);
+            break;
+        default:
+            return;
+    }
+
+    aura->m_updateQueueState = AURA_UPDATE_QUEUE_NONE;
+}
+
+void AuraUpdateQueue::Wake(Aura* aura)
+{
+    if (aura->m_updateQueueState != AURA_UPDATE_QUEUE_SLEEPING)
+        return;
+
+    // nothing fell due while it slept, so catching up only moves its counters
+    aura->_SkipUpdateTime(m_time - aura->m_lastUpdateTime);
+    aura->m_lastUpdateTime = m_time;
+
+    RemoveSleeping(aura->m_updateQueueIndex);
+    AddTicking(aura);
+}
+
+void AuraUpdateQueue::Update(Unit* owner, uint32 diff)
+{
+    m_time += diff;
+
+    while (!m_sleeping.empty() && !IsEarlier(m_time, m_sleeping.front()->m_nextUpdateTime))
+    {
+        Aura* aura = m_sleeping.front();
+        RemoveSleeping(0);
+        AddTicking(aura);
+    }
+
+    // auras added or woken by these updates are appended and get their first update next time
+    for (uint32 i = 0; i < m_ticking.size(); ++i)
+    {
+        Aura* aura = m_ticking[i];
+        if (!aura || aura->m_lastUpdateTime == m_time)
+            continue;
+
+        uint32 elapsed = m_time - aura->m_lastUpdateTime;
+        aura->m_lastUpdateTime = m_time;
+        aura->UpdateOwner(elapsed, owner);
+    }
+
+    // remove expired auras - do that after updates(used in scripts?)
+    // a sleeping aura is permanent and can not expire
+    for (uint32 i = 0; i < m_ticking.size(); ++i)
+        if (Aura* aura = m_ticking[i])
+            if (aura->IsExpired())
+                owner->RemoveOwnedAura(aura->shared_from_this(), AURA_REMOVE_BY_EXPIRE);
+
+    // put the auras with nothing to do for a while to sleep and close the holes
+    uint32 count = 0;
+    for (uint32 i = 0; i < m_ticking.size(); ++i)
+    {
+        Aura* aura = m_ticking[i];
+        if (!aura)
+            continue;
+
+        if (int32 sleepTime = aura->GetUpdateSleepTime())
+            AddSleeping(aura, m_time + sleepTime);
+        else
+        {
+            aura->m_updateQueueIndex = count;
+            m_ticking[count++] = aura;
+        }
+    }
+    m_ticking.resize(count);
+}
+
+uint32 AuraUpdateQueue::GetTickingCount() const
+{
+    uint32 count = 0;
+    for (std::vector<Aura*>::const_iterator itr = m_ticking.begin(); itr != m_ticking.end(); ++itr)
+        if (*itr)
+            ++count;
+    return count;
+}
+
+uint32 AuraUpdateQueue::GetTimeToNextWake() const
+{
+    if (m_sleeping.empty())
+        return 0;
+
+    int32 delay = int32(m_sleeping.front()->m_nextUpdateTime - m_time);
+    return delay > 0 ? uint32(delay) : 0;
+}
+
+void AuraUpdateQueue::AddTicking(Aura* aura)
+{
+    aura->m_updateQueueState = AURA_UPDATE_QUEUE_TICKING;
+    aura->m_updateQueueIndex = uint32(m_ticking.size());
+    m_ticking.push_back(aura);
+}
+
+void AuraUpdateQueue::AddSleeping(Aura* aura, uint32 wakeTime)
+{
+    aura->m_updateQueueState = AURA_UPDATE_QUEUE_SLEEPING;
+    aura->m_nextUpdateTime = wakeTime;
+    m_sleeping.push_back(aura);
+    SiftUp(uint32(m_sleeping.size() - 1));
+}
+
+void AuraUpdateQueue::RemoveSleeping(uint32 index)
+{
+    ASSERT(index < m_sleeping.size());
+
+    Aura* last = m_sleeping.back();
+    m_sleeping.pop_back();
+    if (index == m_sleeping.size())
+        return;
+
+    Place(index, last);
+    if (index > 0 && IsEarlier(last->m_nextUpdateTime, m_sleeping[(index - 1) / 2]->m_nextUpdateTime))
+        SiftUp(index);
+    else
+        SiftDown(index);
+}
+
+void AuraUpdateQueue::SiftUp(uint32 index)
+{
+    Aura* aura = m_sleeping[index];
+    while (index > 0)
+    {
+        uint32 parent = (index - 1) / 2;
+        if (!IsEarlier(aura->m_nextUpdateTime, m_sleeping[parent]->m_nextUpdateTime))
+            break;
+
+        Place(index, m_sleeping[parent]);
+        index = parent;
+    }
+    Place(index, aura);
+}
+
+void AuraUpdateQueue::SiftDown(uint32 index)
+{
+    Aura* aura = m_sleeping[index];
+    uint32 size = uint32(m_sleeping.size());
+    while (true)
+    {
+        uint32 child = index * 2 + 1;
+        if (child >= size)
+            break;
+
+        if (child + 1 < size && IsEarlier(m_sleeping[child + 1]->m_nextUpdateTime, m_sleeping[child]->m_nextUpdateTime))
+            ++child;
+
+        if (!IsEarlier(m_sleeping[child]->m_nextUpdateTime, aura->m_nextUpdateTime))
+            break;
+
+        Place(index, m_sleeping[child]);
+        index = child;
+    }
+    Place(index, aura);
+}
+
+void AuraUpdateQueue::Place(uint32 index, Aura* aura)
+{
+    m_sleeping[index] = aura;
+    aura->m_updateQueueIndex = index;
+}
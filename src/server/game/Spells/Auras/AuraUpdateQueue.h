@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITY_AURAUPDATEQUEUE_H
+#define TRINITY_AURAUPDATEQUEUE_H
+
+#include "Define.h"
+#include <vector>
+
+class Aura;
+class Unit;
+
+enum AuraUpdateQueueState
+{
+    AURA_UPDATE_QUEUE_NONE,                             // not owned by a unit (dynamic object auras) or removed
+    AURA_UPDATE_QUEUE_TICKING,                          // updated on every owner update
+    AURA_UPDATE_QUEUE_SLEEPING                          // skipped until Aura::m_nextUpdateTime
+};
+
+/**
+ * Schedules the updates of the auras owned by one unit.
+ *
+ * Auras with a running duration or with scripts are updated on every owner
+ * update, like before. A permanent aura has nothing to do between its periodic
+ * ticks and target map refreshes, so after each update it is put to sleep in a
+ * min-heap keyed by the owner time of the next one and skipped until then. The
+ * time it slept through is passed to UpdateOwner as one diff when it wakes up.
+ *
+ * Anything that changes the timers of a sleeping aura from outside must wake it
+ * first (Aura::WakeUpdate), which moves the skipped time into its counters and
+ * brings it back to the ticking list.
+ */
+class AuraUpdateQueue
+{
+    public:
+        AuraUpdateQueue() : m_time(0) { }
+
+        void Add(Aura* aura);
+        void Remove(Aura* aura);
+        void Wake(Aura* aura);
+
+        // updates the due auras, then removes the expired ones
+        void Update(Unit* owner, uint32 diff);
+
+        uint32 GetTime() const { return m_time; }
+        uint32 GetTickingCount() const;
+        uint32 GetSleepingCount() const { return uint32(m_sleeping.size()); }
+        Aura const* GetNextSleeping() const { return m_sleeping.empty() ? NULL : m_sleeping.front(); }
+        uint32 GetTimeToNextWake() const;
+
+    private:
+        void AddTicking(Aura* aura);
+        void AddSleeping(Aura* aura, uint32 wakeTime);
+        void RemoveSleeping(uint32 index);
+        void SiftUp(uint32 index);
+        void SiftDown(uint32 index);
+        void Place(uint32 index, Aura* aura);
+
+        std::vector<Aura*> m_ticking;                   // removed auras leave a NULL hole until the end of the next Update
+        std::vector<Aura*> m_sleeping;                  // binary min-heap on Aura::m_nextUpdateTime
+        uint32 m_time;                                  // sum of all diffs passed to Update, wraps around
+};
+
+#endif
@@ -33,6 +33,8 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
     friend void Aura::_InitEffects(uint32 effMask, Unit* caster, int32 *baseAmount);
     friend AuraPtr Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint32 effMask, Unit* caster, int32* baseAmount, Item* castItem, uint64 casterGUID);
     friend Aura::~Aura();
+    friend int32 Aura::GetUpdateSleepTime() const;
+    friend void Aura::_SkipUpdateTime(uint32 diff);
     private:
         explicit AuraEffect(AuraPtr base, uint8 effIndex, int32 *baseAmount, Unit* caster);
     public:
@@ -55,7 +57,7 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
         uint32 GetEffIndex() const { return m_effIndex; }
         int32 GetBaseAmount() const { return m_baseAmount; }
         int32 GetAmplitude() const { return m_amplitude; }
-        void SetAmplitude(int32 newAmplitude) { m_amplitude = newAmplitude; }
+        void SetAmplitude(int32 newAmplitude) { GetBase()->WakeUpdate(); m_amplitude = newAmplitude; }
 
         int32 GetMiscValueB() const { return m_spellInfo->Effects[m_effIndex].MiscValueB; }
         int32 GetMiscValue() const { return m_spellInfo->Effects[m_effIndex].MiscValue; }
@@ -71,8 +73,9 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
             m_canBeRecalculated = false;
         }
 
-        int32 GetPeriodicTimer() const { return m_periodicTimer; }
-        void SetPeriodicTimer(int32 periodicTimer) { m_periodicTimer = periodicTimer; }
+        // a sleeping aura counts its skipped time down only when it wakes up, see AuraUpdateQueue
+        int32 GetPeriodicTimer() const { return m_isPeriodic ? m_periodicTimer - int32(GetBase()->GetPendingSkipTime()) : m_periodicTimer; }
+        void SetPeriodicTimer(int32 periodicTimer) { GetBase()->WakeUpdate(); m_periodicTimer = periodicTimer; }
 
         int32 CalculateAmount(Unit* caster);
         void CalculatePeriodic(Unit* caster, bool resetPeriodicTimer = true, bool load = false);
@@ -91,10 +94,10 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
 
         uint32 GetTickNumber() const { return m_tickNumber; }
         int32 GetTotalTicks() const { return m_amplitude ? (GetBase()->GetMaxDuration() / m_amplitude) : 1;}
-        void ResetPeriodic(bool resetPeriodicTimer = false) { if (resetPeriodicTimer) m_periodicTimer = m_amplitude; m_tickNumber = 0;}
+        void ResetPeriodic(bool resetPeriodicTimer = false) { GetBase()->WakeUpdate(); if (resetPeriodicTimer) m_periodicTimer = m_amplitude; m_tickNumber = 0;}
 
         bool IsPeriodic() const { return m_isPeriodic; }
-        void SetPeriodic(bool isPeriodic) { m_isPeriodic = isPeriodic; }
+        void SetPeriodic(bool isPeriodic) { GetBase()->WakeUpdate(); m_isPeriodic = isPeriodic; }
         bool IsAffectingSpell(SpellInfo const* spell) const;
         bool HasSpellClassMask() const { return m_spellInfo->Effects[m_effIndex].SpellClassMask; }
 
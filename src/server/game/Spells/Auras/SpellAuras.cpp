@@ -95,7 +95,9 @@ void AuraApplication::_Remove()
             if (GetTarget()->GetVisibleAura(slot) == this)
             {
                 GetTarget()->SetVisibleAura(slot, foundAura);
+                // if it was flagged while this one held the slot, that queued update is already spent
                 foundAura->SetNeedClientUpdate();
+                GetTarget()->AddVisibleAuraUpdate(slot);
             }
             // set not valid slot for aura - prevent removing other visible aura
             slot = MAX_AURAS;
@@ -544,7 +546,8 @@ m_spellInfo(spellproto), m_casterGuid(casterGUID ? casterGUID : caster->GetGUID(
 m_castItemGuid(castItem ? castItem->GetGUID() : 0), m_applyTime(time(NULL)),
 m_owner(owner), m_timeCla(0), m_updateTargetMapInterval(0),
 m_casterLevel(caster ? caster->getLevel() : m_spellInfo->SpellLevel), m_procCharges(0), m_stackAmount(1),
-m_isRemoved(false), m_isSingleTarget(false), m_isUsingCharges(false)
+m_isRemoved(false), m_isSingleTarget(false), m_isUsingCharges(false),
+m_lastUpdateTime(0), m_nextUpdateTime(0), m_updateQueueIndex(0), m_updateQueueState(AURA_UPDATE_QUEUE_NONE)
 {
     if (spellPowerData->manaPerSecond)
         m_timeCla = 1 * IN_MILLISECONDS;
@@ -866,6 +869,47 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
     _DeleteRemovedApplications();
 }
 
+void Aura::WakeUpdate()
+{
+    if (m_updateQueueState == AURA_UPDATE_QUEUE_SLEEPING)
+        GetUnitOwner()->GetAuraUpdateQueue().Wake(this);
+}
+
+// Time a sleeping aura has not taken off its periodic timers yet, see _SkipUpdateTime
+uint32 Aura::GetPendingSkipTime() const
+{
+    if (m_updateQueueState != AURA_UPDATE_QUEUE_SLEEPING || !(IsPassive() || IsPermanent()))
+        return 0;
+
+    return GetUnitOwner()->GetAuraUpdateQueue().GetTime() - m_lastUpdateTime;
+}
+
+int32 Aura::GetUpdateSleepTime() const
+{
+    // running duration and power per second count down on every update, scripts may hook any of them
+    if (m_duration >= 0 || IsRemoved() || !m_loadedScripts.empty())
+        return 0;
+
+    int32 sleepTime = m_updateTargetMapInterval;
+    if (IsPassive() || IsPermanent())
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (m_effects[i] && m_effects[i]->m_isPeriodic)
+                sleepTime = std::min(sleepTime, m_effects[i]->m_periodicTimer);
+
+    return std::max(sleepTime, 0);
+}
+
+// Counts down the same timers UpdateOwner does, only valid while none of them runs out
+void Aura::_SkipUpdateTime(uint32 diff)
+{
+    m_updateTargetMapInterval -= diff;
+
+    if (IsPassive() || IsPermanent())
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (m_effects[i] && m_effects[i]->m_isPeriodic)
+                m_effects[i]->m_periodicTimer -= diff;
+}
+
 void Aura::Update(uint32 diff, Unit* caster)
 {
     if (m_duration > 0)
@@ -963,6 +1007,7 @@ void Aura::SetDuration(int32 duration, bool withMods)
             if (Player* modOwner = caster->GetSpellModOwner())
                 modOwner->ApplySpellMod(GetId(), SPELLMOD_DURATION, duration);
     }
+    WakeUpdate();
     m_duration = duration;
     SetNeedClientUpdateForTargets();
 }
@@ -1301,6 +1346,7 @@ int32 Aura::CalcDispelChance(Unit* auraTarget, bool offensive) const
 
 void Aura::SetLoadedState(int32 maxduration, int32 duration, int32 charges, uint8 stackamount, uint32 recalculateMask, int32 * amount)
 {
+    WakeUpdate();
     m_maxDuration = maxduration;
     m_duration = duration;
     m_procCharges = charges;
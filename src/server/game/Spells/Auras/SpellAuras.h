@@ -77,7 +77,12 @@ class AuraApplication
         void SetRemoveMode(AuraRemoveMode mode) { _removeMode = mode; }
         AuraRemoveMode GetRemoveMode() const {return _removeMode;}
 
-        void SetNeedClientUpdate() { _needClientUpdate = true;}
+        void SetNeedClientUpdate()
+        {
+            if (!_needClientUpdate && _slot < MAX_AURAS)
+                _target->AddVisibleAuraUpdate(_slot);
+            _needClientUpdate = true;
+        }
         bool IsNeedClientUpdate() const { return _needClientUpdate;}
         void BuildBitsUpdatePacket(ByteBuffer& data, bool remove) const;
         void BuildBytesUpdatePacket(ByteBuffer& data, bool remove, uint32 overrideSpell = 0) const;
@@ -87,6 +92,7 @@ class AuraApplication
 
 class Aura : public std::enable_shared_from_this<Aura>
 {
+    friend class AuraUpdateQueue;
     friend AuraPtr Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint32 effMask, Unit* caster, int32 *baseAmount, Item* castItem, uint64 casterGUID);
     public:
         typedef std::map<uint64, AuraApplication *> ApplicationMap;
@@ -126,6 +132,12 @@ class Aura : public std::enable_shared_from_this<Aura>
         void UpdateOwner(uint32 diff, WorldObject* owner);
         void Update(uint32 diff, Unit* caster);
 
+        // owner update scheduling, see AuraUpdateQueue
+        void WakeUpdate();
+        uint32 GetPendingSkipTime() const;
+        int32 GetUpdateSleepTime() const;
+        void _SkipUpdateTime(uint32 diff);
+
         time_t GetApplyTime() const { return m_applyTime; }
         int32 GetMaxDuration() const { return m_maxDuration; }
         void SetMaxDuration(int32 duration) { m_maxDuration = duration; }
@@ -263,6 +275,11 @@ class Aura : public std::enable_shared_from_this<Aura>
         SpellPowerEntry const* m_spellPowerData;
     private:
         Unit::AuraApplicationList m_removedApplications;
+
+        uint32 m_lastUpdateTime;                            // Owner aura queue time of the last UpdateOwner
+        uint32 m_nextUpdateTime;                            // Owner aura queue time a sleeping aura wakes up at
+        uint32 m_updateQueueIndex;
+        AuraUpdateQueueState m_updateQueueState;
 };
 
 class UnitAura : public Aura
@@ -854,6 +854,14 @@ void Spell::SelectSpellTargets()
                     // Do not check for selfcast
                     if (!ihit->scaleAura && ihit->targetGUID != m_caster->GetGUID())
                     {
+                         for (std::vector<std::pair<uint64, TargetInfo*> >::iterator itr = m_UniqueTargetIndex.begin(); itr != m_UniqueTargetIndex.end(); ++itr)
+                         {
+                             if (itr->second == &*ihit)
+                             {
+                                 m_UniqueTargetIndex.erase(itr);
+                                 break;
+                             }
+                         }
                          m_UniqueTargetInfo.erase(ihit++);
                          continue;
                     }
@@ -1250,6 +1258,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
     std::list<WorldObject*> targets;
     float radius = m_spellInfo->Effects[effIndex].CalcRadius(m_caster) * m_spellValue->RadiusMod;
     SearchAreaTargets(targets, radius, center, referer, targetType.GetObjectType(), targetType.GetCheckType(), m_spellInfo->Effects[effIndex].ImplicitTargetConditions);
+    PrefetchLineOfSight(targets);
 
     // Custom entries
     // TODO: remove those
@@ -1877,14 +1886,9 @@ void Spell::SelectImplicitChainTargets(SpellEffIndex effIndex, SpellImplicitTarg
         // Chain primary target is added earlier
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex);
 
-        // for backward compability
-        std::list<Unit*> unitTargets;
         for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
             if (Unit* unitTarget = (*itr)->ToUnit())
-                unitTargets.push_back(unitTarget);
-
-        for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end(); ++itr)
-            AddUnitTarget(*itr, effMask, false);
+                AddUnitTarget(unitTarget, effMask, false);
     }
 }
 
@@ -2192,14 +2196,82 @@ WorldObject* Spell::SearchNearbyTarget(float range, SpellTargetObjectTypes objec
     return target;
 }
 
-void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
+template<class CONTAINER>
+void Spell::SearchAreaTargets(CONTAINER& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
 {
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
         return;
     WoWSource::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    WoWSource::WorldObjectListSearcher<WoWSource::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-    SearchTargets<WoWSource::WorldObjectListSearcher<WoWSource::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
+    WoWSource::WorldObjectListSearcher<WoWSource::WorldObjectSpellAreaTargetCheck, CONTAINER> searcher(m_caster, targets, check, containerTypeMask);
+    SearchTargets<WoWSource::WorldObjectListSearcher<WoWSource::WorldObjectSpellAreaTargetCheck, CONTAINER> > (searcher, containerTypeMask, m_caster, position, range);
+}
+
+template void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+template void Spell::SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+
+// Traces the line of sight checks CheckEffectTarget() will do for these targets in one batch,
+// the results wait in the map's line of sight cache
+void Spell::PrefetchLineOfSight(std::list<WorldObject*> const& targets) const
+{
+    if (targets.size() < 2 || !LineOfSightCache::IsEnabled())
+        return;
+
+    if (!m_spellInfo->IsNeedAdditionalLosChecks() && (IsTriggered() || m_spellInfo->AttributesEx2 & SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS))
+        return;
+
+    // same origin as the default case of CheckEffectTarget()
+    float x, y, z;
+    if (m_targets.HasDst())
+        m_targets.GetDstPos()->GetPosition(x, y, z);
+    else
+    {
+        WorldObject* caster = NULL;
+        if (IS_GAMEOBJECT_GUID(m_originalCasterGUID))
+            caster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+        if (!caster)
+            caster = m_caster;
+        caster->GetPosition(x, y, z);
+    }
+
+    std::vector<LineOfSightQuery> queries;
+    queries.reserve(targets.size());
+    for (std::list<WorldObject*>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
+    {
+        if (*itr == m_caster || !(*itr)->ToUnit())
+            continue;
+
+        LineOfSightQuery query;
+        (*itr)->GetPosition(query.x, query.y, query.z);
+        query.z += 2.0f;
+        query.phasemask = (*itr)->GetPhaseMask();
+        query.inLineOfSight = true;
+        queries.push_back(query);
+    }
+
+    if (queries.size() > 1)
+        m_caster->GetMap()->isInLineOfSight(x, y, z + 2.0f, queries);
+}
+
+namespace
+{
+    // Object the chain can jump to, with the keys it is ordered by
+    struct ChainTargetCandidate
+    {
+        WorldObject* Object;
+        uint32 HealthDeficit;
+        float DistSq;
+    };
+
+    bool ChainTargetDeficitOrderPred(ChainTargetCandidate const& a, ChainTargetCandidate const& b)
+    {
+        return a.HealthDeficit > b.HealthDeficit;
+    }
+
+    bool ChainTargetDistanceOrderPred(ChainTargetCandidate const& a, ChainTargetCandidate const& b)
+    {
+        return a.DistSq < b.DistSq;
+    }
 }
 
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal)
@@ -2237,62 +2309,68 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (isBouncingFar)
         searchRadius *= chainTargets;
 
-    std::list<WorldObject*> tempTargets;
-    SearchAreaTargets(tempTargets, searchRadius, target, m_caster, objectType, selectType, condList);
-    tempTargets.remove(target);
+    std::vector<WorldObject*> found;
+    SearchAreaTargets(found, searchRadius, target, m_caster, objectType, selectType, condList);
 
     // remove targets which are always invalid for chain spells
     // for some spells allow only chain targets in front of caster (swipe for example)
-    if (!isBouncingFar)
+    std::vector<ChainTargetCandidate> candidates;
+    candidates.reserve(found.size());
+    for (std::vector<WorldObject*>::const_iterator itr = found.begin(); itr != found.end(); ++itr)
     {
-        for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end();)
+        if (*itr == target || (!isBouncingFar && !m_caster->HasInArc(static_cast<float>(M_PI), *itr)))
+            continue;
+
+        ChainTargetCandidate candidate;
+        candidate.Object = *itr;
+        candidate.HealthDeficit = 0;
+        candidate.DistSq = 0.0f;
+
+        // only units can be healed
+        if (isChainHeal)
         {
-            std::list<WorldObject*>::iterator checkItr = itr++;
-            if (!m_caster->HasInArc(static_cast<float>(M_PI), *checkItr))
-                tempTargets.erase(checkItr);
+            Unit* unitTarget = (*itr)->ToUnit();
+            if (!unitTarget)
+                continue;
+            candidate.HealthDeficit = unitTarget->GetMaxHealth() - unitTarget->GetHealth();
         }
+
+        candidates.push_back(candidate);
     }
 
-    while (chainTargets)
+    // the unit with highest hp deficit is healed first, the order does not depend on the jumps
+    if (isChainHeal)
+        std::stable_sort(candidates.begin(), candidates.end(), ChainTargetDeficitOrderPred);
+
+    while (chainTargets && !candidates.empty())
     {
-        // try to get unit for next chain jump
-        std::list<WorldObject*>::iterator foundItr = tempTargets.end();
-        // get unit with highest hp deficit in dist
-        if (isChainHeal)
+        // otherwise the closest object to the last target gets the next jump
+        if (!isChainHeal)
         {
-            uint32 maxHPDeficit = 0;
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
-            {
-                if (Unit* unitTarget = (*itr)->ToUnit())
-                {
-                    uint32 deficit = unitTarget->GetMaxHealth() - unitTarget->GetHealth();
-                    if ((deficit > maxHPDeficit || foundItr == tempTargets.end()) && target->IsWithinDist(unitTarget, jumpRadius) && target->IsWithinLOSInMap(unitTarget))
-                    {
-                        foundItr = itr;
-                        maxHPDeficit = deficit;
-                    }
-                }
-            }
+            for (std::vector<ChainTargetCandidate>::iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+                itr->DistSq = target->GetExactDistSq(itr->Object);
+            std::stable_sort(candidates.begin(), candidates.end(), ChainTargetDistanceOrderPred);
         }
-        // get closest object
-        else
+
+        // line of sight is only traced for candidates in order until one is visible
+        std::vector<ChainTargetCandidate>::iterator foundItr = candidates.end();
+        for (std::vector<ChainTargetCandidate>::iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            if ((isChainHeal || isBouncingFar) && !target->IsWithinDist(itr->Object, jumpRadius))
+                continue;
+
+            if (target->IsWithinLOSInMap(itr->Object))
             {
-                if (foundItr == tempTargets.end())
-                {
-                    if ((!isBouncingFar || target->IsWithinDist(*itr, jumpRadius)) && target->IsWithinLOSInMap(*itr))
-                        foundItr = itr;
-                }
-                else if (target->GetDistanceOrder(*itr, *foundItr) && target->IsWithinLOSInMap(*itr))
-                    foundItr = itr;
+                foundItr = itr;
+                break;
             }
         }
+
         // not found any valid target - chain ends
-        if (foundItr == tempTargets.end())
+        if (foundItr == candidates.end())
             break;
-        target = *foundItr;
-        tempTargets.erase(foundItr);
+        target = foundItr->Object;
+        candidates.erase(foundItr);
         targets.push_back(target);
         --chainTargets;
     }
@@ -2380,6 +2458,7 @@ void Spell::prepareDataForTriggerSystem(constAuraEffectPtr /*triggeredByAura*/)
 void Spell::CleanupTargetList()
 {
     m_UniqueTargetInfo.clear();
+    m_UniqueTargetIndex.clear();
     m_UniqueGOTargetInfo.clear();
     m_UniqueItemInfo.clear();
     m_delayMoment = 0;
@@ -2418,10 +2497,11 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
     uint64 targetGUID = target->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (std::vector<std::pair<uint64, TargetInfo*> >::const_iterator itr = m_UniqueTargetIndex.begin(); itr != m_UniqueTargetIndex.end(); ++itr)
     {
-        if (targetGUID == ihit->targetGUID)             // Found in list
+        if (targetGUID == itr->first)                   // Found in list
         {
+            TargetInfo* ihit = itr->second;
             ihit->effectMask |= effectMask;             // Immune effects removed from mask
             ihit->scaleAura = false;
             if (m_auraScaleMask && ihit->effectMask == m_auraScaleMask && m_caster != target)
@@ -2572,6 +2652,7 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
 
     // Add target to list
     m_UniqueTargetInfo.push_back(targetInfo);
+    m_UniqueTargetIndex.push_back(std::make_pair(targetGUID, &m_UniqueTargetInfo.back()));
 }
 
 void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
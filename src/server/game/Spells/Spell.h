@@ -463,7 +463,8 @@ class Spell
         template<class SEARCHER> void SearchTargets(SEARCHER& searcher, uint32 containerMask, Unit* referer, Position const* pos, float radius);
 
         WorldObject* SearchNearbyTarget(float range, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList = NULL);
-        void SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+        template<class CONTAINER> void SearchAreaTargets(CONTAINER& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+        void PrefetchLineOfSight(std::list<WorldObject*> const& targets) const;
         void SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal);
 
         void prepare(SpellCastTargets const* targets, constAuraEffectPtr triggeredByAura = NULLAURA_EFFECT);
@@ -685,6 +686,8 @@ class Spell
             int32  damage;
         };
         std::list<TargetInfo> m_UniqueTargetInfo;
+        // guid of every entry of m_UniqueTargetInfo, scanned instead of the list when adding targets
+        std::vector<std::pair<uint64, TargetInfo*> > m_UniqueTargetIndex;
         uint32 m_channelTargetEffectMask;                        // Mask req. alive targets
 
         struct GOTargetInfo
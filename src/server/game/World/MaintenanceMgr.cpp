@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "MaintenanceMgr.h"
+#include "DatabaseEnv.h"
+#include "ObjectAccessor.h"
+#include "ObjectMgr.h"
+#include "Player.h"
+#include "Corpse.h"
+#include "Mail.h"
+#include "World.h"
+#include "Log.h"
+#include "Timer.h"
+
+#include <deque>
+
+namespace
+{
+    uint32 GetMicroTimeDiff(ACE_Time_Value const& start)
+    {
+        ACE_Time_Value diff = ACE_OS::gettimeofday() - start;
+        return uint32(diff.sec() * 1000000 + diff.usec());
+    }
+}
+
+// Returns or deletes the mails that expired, see ObjectMgr::ReturnOrDeleteOldMails
+class ExpiredMailJob : public MaintenanceJob
+{
+    public:
+        ExpiredMailJob() : MaintenanceJob("expired mail"), m_basetime(0) { }
+        ~ExpiredMailJob() { Clear(); }
+
+        void Start()
+        {
+            m_basetime = uint64(time(NULL));
+            sLog->outInfo(LOG_FILTER_GENERAL, "MaintenanceMgr: returning and deleting mails expired before " UI64FMTD, m_basetime);
+
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
+            stmt->setUInt64(0, m_basetime);
+            m_mailCallback = CharacterDatabase.AsyncQuery(stmt);
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+            stmt->setUInt32(0, uint32(m_basetime));
+            m_itemCallback = CharacterDatabase.AsyncQuery(stmt);
+        }
+
+        bool Collect()
+        {
+            if (!m_mailCallback.ready() || !m_itemCallback.ready())
+                return false;
+
+            PreparedQueryResult result;
+            m_mailCallback.get(result);
+            m_mailCallback.cancel();
+
+            PreparedQueryResult items;
+            m_itemCallback.get(items);
+            m_itemCallback.cancel();
+
+            if (!result)
+                return true;
+
+            std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
+            if (items)
+            {
+                MailItemInfo item;
+                do
+                {
+                    Field* fields = items->Fetch();
+                    item.item_guid = fields[0].GetUInt32();
+                    item.item_template = fields[1].GetUInt32();
+                    uint32 mailId = fields[2].GetUInt32();
+                    itemsCache[mailId].push_back(item);
+                }
+                while (items->NextRow());
+            }
+
+            do
+            {
+                Field* fields = result->Fetch();
+                ExpiredMail expired;
+                expired.Message = new Mail;
+                expired.Message->messageID      = fields[0].GetUInt32();
+                expired.Message->messageType    = fields[1].GetUInt8();
+                expired.Message->sender         = fields[2].GetUInt32();
+                expired.Message->receiver       = fields[3].GetUInt32();
+                expired.HasItems             = fields[4].GetBool();
+                expired.Message->expire_time    = time_t(fields[5].GetUInt32());
+                expired.Message->deliver_time   = 0;
+                expired.Message->COD            = fields[6].GetUInt64();
+                expired.Message->checked        = fields[7].GetUInt8();
+                expired.Message->mailTemplateId = fields[8].GetInt16();
+
+                if (expired.HasItems)
+                    expired.Message->items.swap(itemsCache[expired.Message->messageID]);
+
+                m_mails.push_back(expired);
+            }
+            while (result->NextRow());
+
+            return true;
+        }
+
+        bool Apply()
+        {
+            if (m_mails.empty())
+                return false;
+
+            ExpiredMail expired = m_mails.front();
+            m_mails.pop_front();
+
+            // a mailbox read after the query sees the mails as they are now, leave them to the next run
+            uint32 receiver = expired.Message->receiver;
+            Player* player = ObjectAccessor::FindPlayer(MAKE_NEW_GUID(receiver, 0, HIGHGUID_PLAYER));
+            if ((!player || !player->m_mailsLoaded) && m_loadedMailboxes.find(receiver) == m_loadedMailboxes.end())
+                sObjectMgr->ReturnOrDeleteExpiredMail(expired.Message, expired.HasItems, m_basetime);
+
+            delete expired.Message;
+            return true;
+        }
+
+        uint32 GetBacklog() const { return uint32(m_mails.size()); }
+
+        void Clear()
+        {
+            m_mailCallback.cancel();
+            m_itemCallback.cancel();
+
+            for (std::deque<ExpiredMail>::iterator itr = m_mails.begin(); itr != m_mails.end(); ++itr)
+                delete itr->Message;
+            m_mails.clear();
+            m_loadedMailboxes.clear();
+        }
+
+        void OnMailboxLoaded(uint32 guidLow) { m_loadedMailboxes.insert(guidLow); }
+
+    private:
+        struct ExpiredMail
+        {
+            Mail* Message;
+            bool HasItems;
+        };
+
+        uint64 m_basetime;
+        PreparedQueryResultFuture m_mailCallback;
+        PreparedQueryResultFuture m_itemCallback;
+        std::deque<ExpiredMail> m_mails;
+        std::set<uint32> m_loadedMailboxes;
+};
+
+// Removes the characters deleted more than CharDelete.KeepDays ago, see Player::DeleteOldCharacters
+class OldCharactersJob : public MaintenanceJob
+{
+    public:
+        OldCharactersJob() : MaintenanceJob("old characters"), m_queried(false) { }
+        ~OldCharactersJob() { Clear(); }
+
+        void Start()
+        {
+            uint32 keepDays = sWorld->getIntConfig(CONFIG_CHARDELETE_KEEP_DAYS);
+            if (!keepDays)
+                return;
+
+            sLog->outInfo(LOG_FILTER_PLAYER, "MaintenanceMgr: deleting all characters which have been deleted %u days before...", keepDays);
+
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_OLD_CHARS);
+            stmt->setUInt32(0, uint32(time(NULL) - time_t(keepDays * DAY)));
+            m_callback = CharacterDatabase.AsyncQuery(stmt);
+            m_queried = true;
+        }
+
+        bool Collect()
+        {
+            // nothing was queried when CharDelete.KeepDays is 0
+            if (!m_queried)
+                return true;
+
+            if (!m_callback.ready())
+                return false;
+
+            PreparedQueryResult result;
+            m_callback.get(result);
+            m_callback.cancel();
+
+            if (result)
+            {
+                do
+                {
+                    Field* fields = result->Fetch();
+                    m_characters.push_back(std::make_pair(fields[0].GetUInt32(), fields[1].GetUInt32()));
+                }
+                while (result->NextRow());
+            }
+            return true;
+        }
+
+        bool Apply()
+        {
+            if (m_characters.empty())
+                return false;
+
+            std::pair<uint32, uint32> character = m_characters.front();
+            m_characters.pop_front();
+
+            // restored since the query
+            if (!sWorld->HasCharacterNameData(character.first))
+                Player::DeleteFromDB(character.first, character.second, true, true);
+
+            return true;
+        }
+
+        uint32 GetBacklog() const { return uint32(m_characters.size()); }
+
+        void Clear()
+        {
+            m_callback.cancel();
+            m_characters.clear();
+            m_queried = false;
+        }
+
+    private:
+        bool m_queried;
+        PreparedQueryResultFuture m_callback;
+        std::deque<std::pair<uint32 /*guid*/, uint32 /*account*/> > m_characters;
+};
+
+// Turns expired corpses into bones, see ObjectAccessor::RemoveOldCorpses
+class OldCorpsesJob : public MaintenanceJob
+{
+    public:
+        OldCorpsesJob() : MaintenanceJob("old corpses") { }
+
+        void Start()
+        {
+            sObjectAccessor->GetExpiredCorpseOwners(time(NULL), m_owners);
+        }
+
+        bool Collect() { return true; }
+
+        bool Apply()
+        {
+            if (m_owners.empty())
+                return false;
+
+            uint64 owner = m_owners.back();
+            m_owners.pop_back();
+
+            // the corpse may have been resurrected or replaced meanwhile
+            if (Corpse* corpse = sObjectAccessor->GetCorpseForPlayerGUID(owner))
+                if (corpse->IsExpired(time(NULL)))
+                    sObjectAccessor->ConvertCorpseForPlayer(owner);
+
+            return true;
+        }
+
+        uint32 GetBacklog() const { return uint32(m_owners.size()); }
+
+        void Clear() { m_owners.clear(); }
+
+    private:
+        std::vector<uint64> m_owners;
+};
+
+MaintenanceMgr::MaintenanceMgr()
+{
+    m_jobs[MAINTENANCE_JOB_EXPIRED_MAIL] = new ExpiredMailJob;
+    m_jobs[MAINTENANCE_JOB_OLD_CHARACTERS] = new OldCharactersJob;
+    m_jobs[MAINTENANCE_JOB_OLD_CORPSES] = new OldCorpsesJob;
+
+    for (uint32 i = 0; i < MAX_MAINTENANCE_JOBS; ++i)
+    {
+        m_state[i] = JOB_IDLE;
+        m_startTime[i] = 0;
+    }
+}
+
+MaintenanceMgr::~MaintenanceMgr()
+{
+    for (uint32 i = 0; i < MAX_MAINTENANCE_JOBS; ++i)
+        delete m_jobs[i];
+}
+
+void MaintenanceMgr::Schedule(MaintenanceJobType type)
+{
+    if (m_state[type] != JOB_IDLE)
+    {
+        sLog->outError(LOG_FILTER_GENERAL, "MaintenanceMgr: %s job is still running after %u ms with %u entries left, skipping this run.",
+            m_jobs[type]->GetName(), GetMSTimeDiffToNow(m_startTime[type]), m_jobs[type]->GetBacklog());
+        ++m_stats[type].Skipped;
+        return;
+    }
+
+    m_state[type] = JOB_QUERYING;
+    m_startTime[type] = getMSTime();
+    m_stats[type].LastProcessed = 0;
+
+    ACE_Time_Value start = ACE_OS::gettimeofday();
+    m_jobs[type]->Start();
+    uint32 tickTime = GetMicroTimeDiff(start);
+
+    m_stats[type].WorldTime += tickTime;
+    m_stats[type].MaxTickTime = std::max(m_stats[type].MaxTickTime, tickTime);
+}
+
+void MaintenanceMgr::Update()
+{
+    // the budget is shared by all jobs, but every running job gets at least one entry per update
+    uint32 budget = sWorld->getIntConfig(CONFIG_MAINTENANCE_TIME_BUDGET) * 1000;
+    ACE_Time_Value updateStart = ACE_OS::gettimeofday();
+
+    for (uint32 i = 0; i < MAX_MAINTENANCE_JOBS; ++i)
+    {
+        if (m_state[i] == JOB_IDLE)
+            continue;
+
+        MaintenanceJob* job = m_jobs[i];
+        MaintenanceJobStats& stats = m_stats[i];
+        ACE_Time_Value start = ACE_OS::gettimeofday();
+
+        if (m_state[i] == JOB_QUERYING)
+        {
+            if (!job->Collect())
+                continue;
+
+            m_state[i] = JOB_APPLYING;
+        }
+
+        bool finished = false;
+        do
+        {
+            if (!job->Apply())
+            {
+                finished = true;
+                break;
+            }
+
+            ++stats.LastProcessed;
+        }
+        while (!budget || GetMicroTimeDiff(updateStart) < budget);
+
+        stats.Backlog = job->GetBacklog();
+
+        uint32 tickTime = GetMicroTimeDiff(start);
+        stats.WorldTime += tickTime;
+        stats.MaxTickTime = std::max(stats.MaxTickTime, tickTime);
+
+        if (finished)
+            Finish(MaintenanceJobType(i));
+    }
+}
+
+void MaintenanceMgr::Finish(MaintenanceJobType type)
+{
+    MaintenanceJobStats& stats = m_stats[type];
+    ++stats.Runs;
+    stats.LastRunTime = GetMSTimeDiffToNow(m_startTime[type]);
+    stats.Backlog = 0;
+
+    m_jobs[type]->Clear();
+    m_state[type] = JOB_IDLE;
+
+    sLog->outInfo(LOG_FILTER_GENERAL, "MaintenanceMgr: %s job handled %u entries in %u ms.", m_jobs[type]->GetName(), stats.LastProcessed, stats.LastRunTime);
+}
+
+void MaintenanceMgr::OnMailboxLoaded(uint32 guidLow)
+{
+    if (m_state[MAINTENANCE_JOB_EXPIRED_MAIL] != JOB_IDLE)
+        static_cast<ExpiredMailJob*>(m_jobs[MAINTENANCE_JOB_EXPIRED_MAIL])->OnMailboxLoaded(guidLow);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITY_MAINTENANCEMGR_H
+#define TRINITY_MAINTENANCEMGR_H
+
+#include "Define.h"
+
+#include <ace/Singleton.h>
+#include <ace/Null_Mutex.h>
+
+enum MaintenanceJobType
+{
+    MAINTENANCE_JOB_EXPIRED_MAIL,
+    MAINTENANCE_JOB_OLD_CHARACTERS,
+    MAINTENANCE_JOB_OLD_CORPSES,
+
+    MAX_MAINTENANCE_JOBS
+};
+
+struct MaintenanceJobStats
+{
+    MaintenanceJobStats() : Runs(0), Skipped(0), LastRunTime(0), LastProcessed(0), Backlog(0), WorldTime(0), MaxTickTime(0) { }
+
+    uint32 Runs;
+    uint32 Skipped;                                     // schedules dropped because the previous run was still going
+    uint32 LastRunTime;                                 // ms from scheduling to the last entry of the previous run
+    uint32 LastProcessed;                               // entries handled by the current or previous run
+    uint32 Backlog;                                     // entries of the current run still to handle
+    uint64 WorldTime;                                   // us spent on the world thread, all runs
+    uint32 MaxTickTime;                                 // us spent on the world thread in a single update
+};
+
+/**
+ * A periodic cleanup that is too large to do in one world update.
+ *
+ * Start() issues the job's database queries asynchronously, or takes a copy of
+ * the in-memory state it works on. Once Collect() sees the results have arrived
+ * the job has a backlog of entries that are handled one by one with Apply() on
+ * the world thread, only as many per update as the time budget allows. Anything
+ * the job writes goes through the asynchronous database queue.
+ */
+class MaintenanceJob
+{
+    public:
+        explicit MaintenanceJob(char const* name) : m_name(name) { }
+        virtual ~MaintenanceJob() { }
+
+        char const* GetName() const { return m_name; }
+
+        virtual void Start() = 0;
+        virtual bool Collect() = 0;                     // true once the backlog is filled
+        virtual bool Apply() = 0;                       // handles one entry, false when none is left
+        virtual uint32 GetBacklog() const = 0;
+        virtual void Clear() = 0;
+
+    private:
+        char const* m_name;
+};
+
+class MaintenanceMgr
+{
+    friend class ACE_Singleton<MaintenanceMgr, ACE_Null_Mutex>;
+
+    public:
+        // world thread only
+        void Schedule(MaintenanceJobType type);
+        void Update();
+
+        void OnMailboxLoaded(uint32 guidLow);
+
+        char const* GetJobName(MaintenanceJobType type) const { return m_jobs[type]->GetName(); }
+        bool IsRunning(MaintenanceJobType type) const { return m_state[type] != JOB_IDLE; }
+        MaintenanceJobStats const& GetStats(MaintenanceJobType type) const { return m_stats[type]; }
+
+    private:
+        enum JobState
+        {
+            JOB_IDLE,
+            JOB_QUERYING,
+            JOB_APPLYING
+        };
+
+        MaintenanceMgr();
+        ~MaintenanceMgr();
+
+        void Finish(MaintenanceJobType type);
+
+        MaintenanceJob* m_jobs[MAX_MAINTENANCE_JOBS];
+        JobState m_state[MAX_MAINTENANCE_JOBS];
+        uint32 m_startTime[MAX_MAINTENANCE_JOBS];
+        MaintenanceJobStats m_stats[MAX_MAINTENANCE_JOBS];
+};
+
+#define sMaintenanceMgr ACE_Singleton<MaintenanceMgr, ACE_Null_Mutex>::instance()
+
+#endif
@@ -72,6 +72,7 @@
 #include "CharacterDatabaseCleaner.h"
 #include "ScriptMgr.h"
 #include "WeatherMgr.h"
+#include "WorldLoader.h"
 #include "CreatureTextMgr.h"
 #include "SmartAI.h"
 #include "Channel.h"
@@ -80,6 +81,8 @@
 #include "CalendarMgr.h"
 #include "BattlefieldMgr.h"
 #include "BlackMarketMgr.h"
+#include "ChannelFanout.h"
+#include "MaintenanceMgr.h"
 
 ACE_Atomic_Op<ACE_Thread_Mutex, bool> World::m_stopEvent = false;
 uint8 World::m_ExitCode = SHUTDOWN_EXIT_CODE;
@@ -627,6 +630,7 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS] = ConfigMgr::GetBoolDefault("PreserveCustomChannels", false);
     m_int_configs[CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION] = ConfigMgr::GetIntDefault("PreserveCustomChannelDuration", 14);
     m_bool_configs[CONFIG_GRID_UNLOAD] = ConfigMgr::GetBoolDefault("GridUnload", true);
+    m_int_configs[CONFIG_GRID_PREFETCH_LOOKAHEAD] = ConfigMgr::GetIntDefault("GridPrefetch.Lookahead", 10);
     m_int_configs[CONFIG_INTERVAL_SAVE] = ConfigMgr::GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = ConfigMgr::GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = ConfigMgr::GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -1051,6 +1055,16 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_RESTRICTED_LFG_CHANNEL]      = ConfigMgr::GetBoolDefault("Channel.RestrictedLfg", true);
     m_bool_configs[CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL] = ConfigMgr::GetBoolDefault("Channel.SilentlyGMJoin", false);
 
+    // the fan-out thread is started once at startup, see ChannelFanout::Initialize
+    if (reload)
+    {
+        bool val = ConfigMgr::GetBoolDefault("Channel.Fanout", true);
+        if (val != m_bool_configs[CONFIG_CHANNEL_FANOUT])
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "Channel.Fanout option can't be changed at worldserver.conf reload, using current value (%u).", uint32(m_bool_configs[CONFIG_CHANNEL_FANOUT]));
+    }
+    else
+        m_bool_configs[CONFIG_CHANNEL_FANOUT] = ConfigMgr::GetBoolDefault("Channel.Fanout", true);
+
     m_bool_configs[CONFIG_TALENTS_INSPECTING]           = ConfigMgr::GetBoolDefault("TalentsInspecting", true);
     m_bool_configs[CONFIG_CHAT_FAKE_MESSAGE_PREVENTING] = ConfigMgr::GetBoolDefault("ChatFakeMessagePreventing", false);
     m_int_configs[CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY] = ConfigMgr::GetIntDefault("ChatStrictLinkChecking.Severity", 0);
@@ -1182,11 +1196,16 @@ void World::LoadConfigSettings(bool reload)
     m_visibility_notify_periodInInstances = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InInstances",   DEFAULT_VISIBILITY_NOTIFY_PERIOD);
     m_visibility_notify_periodInBGArenas = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InBGArenas",    DEFAULT_VISIBILITY_NOTIFY_PERIOD);
 
+    m_float_configs[CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE] = ConfigMgr::GetFloatDefault("Visibility.MovementRelay.NearDistance", 30.0f);
+    m_int_configs[CONFIG_MOVEMENT_RELAY_MAX_INTERVAL] = ConfigMgr::GetIntDefault("Visibility.MovementRelay.MaxInterval", 1500);
+
     ///- Load the CharDelete related config options
     m_int_configs[CONFIG_CHARDELETE_METHOD] = ConfigMgr::GetIntDefault("CharDelete.Method", 0);
     m_int_configs[CONFIG_CHARDELETE_MIN_LEVEL] = ConfigMgr::GetIntDefault("CharDelete.MinLevel", 0);
     m_int_configs[CONFIG_CHARDELETE_KEEP_DAYS] = ConfigMgr::GetIntDefault("CharDelete.KeepDays", 30);
 
+    m_int_configs[CONFIG_MAINTENANCE_TIME_BUDGET] = ConfigMgr::GetIntDefault("Maintenance.TimeBudget", 5);
+
     ///- Read the "Data" directory from the config file
     std::string dataPath = ConfigMgr::GetStringDefault("DataDir", "./");
     if (dataPath.at(dataPath.length()-1) != '/' && dataPath.at(dataPath.length()-1) != '\\')
@@ -1218,6 +1237,7 @@ void World::LoadConfigSettings(bool reload)
     //VMAP::VMapFactory::preventSpellsFromBeingTestedForLoS(ignoreSpellIds.c_str());
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap support included. LineOfSight:%i, getHeight:%i, indoorCheck:%i PetLOS:%i", enableLOS, enableHeight, enableIndoor, enablePetLOS);
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap data directory is: %svmaps", m_dataPath.c_str());
+    m_int_configs[CONFIG_VMAP_LOS_CACHE_DURATION] = ConfigMgr::GetIntDefault("vmap.LOSCacheDuration", 500);
 
     m_int_configs[CONFIG_MAX_WHO] = ConfigMgr::GetIntDefault("MaxWhoListReturns", 49);
     m_bool_configs[CONFIG_LIMIT_WHO_ONLINE] = ConfigMgr::GetBoolDefault("LimitWhoOnline", true);
@@ -1241,6 +1261,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_STARTUP_LOADER_THREADS] = WorldLoader::GetConfiguredThreads();
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1302,6 +1323,12 @@ void World::LoadConfigSettings(bool reload)
     // Guild save interval
     m_bool_configs[CONFIG_GUILD_LEVELING_ENABLED] = ConfigMgr::GetBoolDefault("Guild.LevelingEnabled", true);
     m_int_configs[CONFIG_GUILD_SAVE_INTERVAL] = ConfigMgr::GetIntDefault("Guild.SaveInterval", 15);
+    m_int_configs[CONFIG_GUILD_SAVE_BATCH_SIZE] = ConfigMgr::GetIntDefault("Guild.SaveBatchSize", 20);
+    if (m_int_configs[CONFIG_GUILD_SAVE_BATCH_SIZE] == 0)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "Guild.SaveBatchSize (0) must be > 0. Using 20 instead.");
+        m_int_configs[CONFIG_GUILD_SAVE_BATCH_SIZE] = 20;
+    }
     m_int_configs[CONFIG_GUILD_MAX_LEVEL] = ConfigMgr::GetIntDefault("Guild.MaxLevel", 25);
     m_int_configs[CONFIG_GUILD_UNDELETABLE_LEVEL] = ConfigMgr::GetIntDefault("Guild.UndeletableLevel", 4);
     rate_values[RATE_XP_GUILD_MODIFIER] = ConfigMgr::GetFloatDefault("Guild.XPModifier", 0.25f);
@@ -1432,10 +1459,13 @@ void World::SetInitialWorldSettings()
     stmt->setUInt32(0, 3 * DAY);
     CharacterDatabase.Execute(stmt);
 
-    ///- Load the DBC files
+    ///- Independent loaders run side by side, each thread on its own WorldDatabase synch connection (opened for them in Master::_StartDB)
+    uint32 loaderThreads = std::min<uint32>(getIntConfig(CONFIG_STARTUP_LOADER_THREADS), WorldDatabase.GetSynchConnectionCount());
+
+    ///- Load the DBC files, only the few stores merged with a table query the database and they wait for a free connection
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initialize data stores...");
-    LoadDBCStores(m_dataPath);
-    LoadDB2Stores(m_dataPath);
+    LoadDBCStores(m_dataPath, getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+    LoadDB2Stores(m_dataPath, getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
     DetectDBCLang();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellInfo store...");
@@ -1472,113 +1502,73 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Localization strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
-
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group types...");
-    sSpellMgr->LoadSpellGroups();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Spells...");
-    sSpellMgr->LoadSpellLearnSpells();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc Event conditions...");
-    sSpellMgr->LoadSpellProcEvents();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc conditions and data...");
-    sSpellMgr->LoadSpellProcs();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonusess();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading forbidden spells...");
-    sSpellMgr->LoadForbiddenSpells();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Phase Dbc Info...");
-    sObjectMgr->LoadSpellPhaseInfo();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Enchant Spells Proc datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Disables");
-    DisableMgr::LoadDisables();                                 // must be before loading quests and items
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item set names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemTemplateAddon();
-
-    sLog->outInfo(LOG_FILTER_GENERAL, "Loading Item Scripts...");                 // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemScriptNames();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Equipment templates...");
-    sObjectMgr->LoadEquipmentTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature templates...");
-    sObjectMgr->LoadCreatureTemplates();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature template addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates...");
-    sObjectMgr->LoadCurrencyOnKill();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
+    ///- Load the static templates. Steps only wait for the steps they read from, everything else runs side by side.
+
+    WorldLoader templateLoader("Templates");
+    templateLoader.AddStep("Creature Locales", sObjectMgr, &ObjectMgr::LoadCreatureLocales);
+    templateLoader.AddStep("GameObject Locales", sObjectMgr, &ObjectMgr::LoadGameObjectLocales);
+    templateLoader.AddStep("Item Locales", sObjectMgr, &ObjectMgr::LoadItemLocales);
+    templateLoader.AddStep("Quest Locales", sObjectMgr, &ObjectMgr::LoadQuestLocales);
+    templateLoader.AddStep("NPC Text Locales", sObjectMgr, &ObjectMgr::LoadNpcTextLocales);
+    templateLoader.AddStep("Page Text Locales", sObjectMgr, &ObjectMgr::LoadPageTextLocales);
+    templateLoader.AddStep("Gossip Menu Option Locales", sObjectMgr, &ObjectMgr::LoadGossipMenuItemsLocales);
+    templateLoader.AddStep("Points Of Interest Locales", sObjectMgr, &ObjectMgr::LoadPointOfInterestLocales);
+
+    uint32 pageTexts = templateLoader.AddStep("Page Texts", sObjectMgr, &ObjectMgr::LoadPageTexts);
+    uint32 goTemplates = templateLoader.AddStep("Game Object Templates", sObjectMgr, &ObjectMgr::LoadGameObjectTemplate);
+    templateLoader.AddDependency(goTemplates, pageTexts);
+
+    uint32 spellRanks = templateLoader.AddStep("Spell Rank Data", sSpellMgr, &SpellMgr::LoadSpellRanks);
+    uint32 spellRequired = templateLoader.AddStep("Spell Required Data", sSpellMgr, &SpellMgr::LoadSpellRequired);
+    templateLoader.AddDependency(spellRequired, spellRanks);
+    uint32 spellGroups = templateLoader.AddStep("Spell Group types", sSpellMgr, &SpellMgr::LoadSpellGroups);
+    templateLoader.AddDependency(spellGroups, spellRanks);
+    uint32 spellLearnSkills = templateLoader.AddStep("Spell Learn Skills", sSpellMgr, &SpellMgr::LoadSpellLearnSkills);
+    templateLoader.AddDependency(spellLearnSkills, spellRanks);
+    templateLoader.AddStep("Spell Learn Spells", sSpellMgr, &SpellMgr::LoadSpellLearnSpells);
+    templateLoader.AddStep("Spell Proc Event conditions", sSpellMgr, &SpellMgr::LoadSpellProcEvents);
+    uint32 spellProcs = templateLoader.AddStep("Spell Proc conditions and data", sSpellMgr, &SpellMgr::LoadSpellProcs);
+    templateLoader.AddDependency(spellProcs, spellRanks);
+    templateLoader.AddStep("Spell Bonus Data", sSpellMgr, &SpellMgr::LoadSpellBonusess);
+    templateLoader.AddStep("Aggro Spells Definitions", sSpellMgr, &SpellMgr::LoadSpellThreats);
+    uint32 spellStackRules = templateLoader.AddStep("Spell Group Stack Rules", sSpellMgr, &SpellMgr::LoadSpellGroupStackRules);
+    templateLoader.AddDependency(spellStackRules, spellGroups);
+    templateLoader.AddStep("forbidden spells", sSpellMgr, &SpellMgr::LoadForbiddenSpells);
+    templateLoader.AddStep("Spell Phase Dbc Info", sObjectMgr, &ObjectMgr::LoadSpellPhaseInfo);
+    templateLoader.AddStep("NPC Texts", sObjectMgr, &ObjectMgr::LoadGossipText);
+    templateLoader.AddStep("Enchant Spells Proc datas", sSpellMgr, &SpellMgr::LoadSpellEnchantProcData);
+
+    uint32 randomEnchantments = templateLoader.AddStep("Item Random Enchantments Table", &LoadRandomEnchantmentsTable);
+    uint32 disables = templateLoader.AddStep("Disables", &DisableMgr::LoadDisables);
+    uint32 itemTemplates = templateLoader.AddStep("Items", sObjectMgr, &ObjectMgr::LoadItemTemplates);
+    templateLoader.AddDependency(itemTemplates, randomEnchantments);
+    templateLoader.AddDependency(itemTemplates, pageTexts);
+    templateLoader.AddDependency(itemTemplates, disables);
+    uint32 itemAddons = templateLoader.AddStep("Item set names", sObjectMgr, &ObjectMgr::LoadItemTemplateAddon);
+    templateLoader.AddDependency(itemAddons, itemTemplates);
+    uint32 itemScripts = templateLoader.AddStep("Item Scripts", sObjectMgr, &ObjectMgr::LoadItemScriptNames);
+    templateLoader.AddDependency(itemScripts, itemTemplates);
+
+    uint32 creatureModels = templateLoader.AddStep("Creature Model Based Info Data", sObjectMgr, &ObjectMgr::LoadCreatureModelInfo);
+    uint32 equipment = templateLoader.AddStep("Equipment templates", sObjectMgr, &ObjectMgr::LoadEquipmentTemplates);
+    uint32 creatureTemplates = templateLoader.AddStep("Creature templates", sObjectMgr, &ObjectMgr::LoadCreatureTemplates);
+    templateLoader.AddDependency(creatureTemplates, creatureModels);
+    templateLoader.AddDependency(creatureTemplates, equipment);
+    uint32 creatureAddons = templateLoader.AddStep("Creature template addons", sObjectMgr, &ObjectMgr::LoadCreatureTemplateAddons);
+    templateLoader.AddDependency(creatureAddons, creatureTemplates);
+    templateLoader.AddStep("Reputation Reward Rates", sObjectMgr, &ObjectMgr::LoadReputationRewardRate);
+    uint32 currencyOnKill = templateLoader.AddStep("Currency Loot Templates", sObjectMgr, &ObjectMgr::LoadCurrencyOnKill);
+    templateLoader.AddDependency(currencyOnKill, creatureTemplates);
+    uint32 reputationOnKill = templateLoader.AddStep("Creature Reputation OnKill Data", sObjectMgr, &ObjectMgr::LoadReputationOnKill);
+    templateLoader.AddDependency(reputationOnKill, creatureTemplates);
+    templateLoader.AddStep("Reputation Spillover Data", sObjectMgr, &ObjectMgr::LoadReputationSpilloverTemplate);
+    templateLoader.AddStep("Points Of Interest Data", sObjectMgr, &ObjectMgr::LoadPointsOfInterest);
+    uint32 creatureStats = templateLoader.AddStep("Creature Base Stats", sObjectMgr, &ObjectMgr::LoadCreatureClassLevelStats);
+    templateLoader.AddDependency(creatureStats, creatureTemplates);
+
+    templateLoader.Run(loaderThreads);
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Restructuring Creatures GUIDs...");
     sObjectMgr->RestructCreatureGUID(10000);
@@ -1647,50 +1637,11 @@ void World::SetInitialWorldSettings()
     sLFGMgr->LoadEntrancePositions();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellArea Data...");                // must be after quest load
-    sSpellMgr->LoadSpellAreas();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Classes Info...");
-    sSpellMgr->LoadSpellClassInfo();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger script names...");
-    sObjectMgr->LoadAreaTriggerScripts();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Graveyard-zone links...");
-    sObjectMgr->LoadGraveyardZones();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell pet auras...");
-    sSpellMgr->LoadSpellPetAuras();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell target coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading enchant custom attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading linked spells...");
-    sSpellMgr->LoadSpellLinked();
+    sSpellMgr->LoadSpellAreas();                                 // sets attributes of spells the loaders below read
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Create Data...");
     sObjectMgr->LoadPlayerInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
-
     CharacterDatabaseCleaner::CleanDatabase();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading the max pet number...");
@@ -1705,30 +1656,68 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player level dependent mail rewards...");
     sObjectMgr->LoadMailLevelRewards();
 
-    // Loot tables
-    LoadLootTables();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Fishing base level requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
+    ///- Loot, achievements, the npc/waypoint tables and the trigger and spell tables only read the templates and quests loaded above
+    WorldLoader dataLoader("World data");
+    uint32 creatureLoot = dataLoader.AddStep("Creature Loot Templates", &LoadLootTemplates_Creature);
+    uint32 fishingLoot = dataLoader.AddStep("Fishing Loot Templates", &LoadLootTemplates_Fishing);
+    uint32 gameobjectLoot = dataLoader.AddStep("Gameobject Loot Templates", &LoadLootTemplates_Gameobject);
+    uint32 itemLoot = dataLoader.AddStep("Item Loot Templates", &LoadLootTemplates_Item);
+    uint32 mailLoot = dataLoader.AddStep("Mail Loot Templates", &LoadLootTemplates_Mail);
+    uint32 millingLoot = dataLoader.AddStep("Milling Loot Templates", &LoadLootTemplates_Milling);
+    uint32 pickpocketingLoot = dataLoader.AddStep("Pickpocketing Loot Templates", &LoadLootTemplates_Pickpocketing);
+    uint32 skinningLoot = dataLoader.AddStep("Skinning Loot Templates", &LoadLootTemplates_Skinning);
+    uint32 disenchantLoot = dataLoader.AddStep("Disenchanting Loot Templates", &LoadLootTemplates_Disenchant);
+    uint32 prospectingLoot = dataLoader.AddStep("Prospecting Loot Templates", &LoadLootTemplates_Prospecting);
+    uint32 spellLoot = dataLoader.AddStep("Spell Loot Templates", &LoadLootTemplates_Spell);
+    uint32 referenceLoot = dataLoader.AddStep("Reference Loot Templates", &LoadLootTemplates_Reference);
+    dataLoader.AddDependency(referenceLoot, creatureLoot);                // checks the references of every other store
+    dataLoader.AddDependency(referenceLoot, fishingLoot);
+    dataLoader.AddDependency(referenceLoot, gameobjectLoot);
+    dataLoader.AddDependency(referenceLoot, itemLoot);
+    dataLoader.AddDependency(referenceLoot, mailLoot);
+    dataLoader.AddDependency(referenceLoot, millingLoot);
+    dataLoader.AddDependency(referenceLoot, pickpocketingLoot);
+    dataLoader.AddDependency(referenceLoot, skinningLoot);
+    dataLoader.AddDependency(referenceLoot, disenchantLoot);
+    dataLoader.AddDependency(referenceLoot, prospectingLoot);
+    dataLoader.AddDependency(referenceLoot, spellLoot);
+
+    dataLoader.AddStep("Skill Discovery Table", &LoadSkillDiscoveryTable);
+    dataLoader.AddStep("Skill Extra Item Table", &LoadSkillExtraItemTable);
+    dataLoader.AddStep("Skill Fishing base level requirements", sObjectMgr, &ObjectMgr::LoadFishingBaseSkillLevel);
+
+    dataLoader.AddStep("Achievements", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementReferenceList);
+    uint32 criteriaList = dataLoader.AddStep("Achievement Criteria Lists", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementCriteriaList);
+    uint32 criteriaData = dataLoader.AddStep("Achievement Criteria Data", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementCriteriaData);
+    dataLoader.AddDependency(criteriaData, criteriaList);
+    dataLoader.AddStep("Achievement Rewards", sAchievementMgr, &AchievementGlobalMgr::LoadRewards);
+    dataLoader.AddStep("Achievement Reward Locales", sAchievementMgr, &AchievementGlobalMgr::LoadRewardLocales);
+    dataLoader.AddStep("Completed Achievements", sAchievementMgr, &AchievementGlobalMgr::LoadCompletedAchievements);
+
+    uint32 gossipMenus = dataLoader.AddStep("Gossip menu", sObjectMgr, &ObjectMgr::LoadGossipMenu);
+    uint32 gossipMenuItems = dataLoader.AddStep("Gossip menu options", sObjectMgr, &ObjectMgr::LoadGossipMenuItems);
+    dataLoader.AddDependency(gossipMenuItems, gossipMenus);
+    dataLoader.AddStep("Vendors", sObjectMgr, &ObjectMgr::LoadVendors);
+    dataLoader.AddStep("Trainers", sObjectMgr, &ObjectMgr::LoadTrainerSpell);
+    dataLoader.AddStep("Waypoints", sWaypointMgr, &WaypointMgr::Load);
+    dataLoader.AddStep("SmartAI Waypoints", sSmartWaypointMgr, &SmartWaypointMgr::LoadFromDB);
+    dataLoader.AddStep("Creature Formations", sFormationMgr, &FormationMgr::LoadCreatureFormations);
+
+    dataLoader.AddStep("Spell Classes Info", sSpellMgr, &SpellMgr::LoadSpellClassInfo);
+    dataLoader.AddStep("spell pet auras", sSpellMgr, &SpellMgr::LoadSpellPetAuras);
+    dataLoader.AddStep("Spell target coordinates", sSpellMgr, &SpellMgr::LoadSpellTargetPositions);
+    dataLoader.AddStep("enchant custom attributes", sSpellMgr, &SpellMgr::LoadEnchantCustomAttr);
+    dataLoader.AddStep("linked spells", sSpellMgr, &SpellMgr::LoadSpellLinked);
+    dataLoader.AddStep("AreaTrigger definitions", sObjectMgr, &ObjectMgr::LoadAreaTriggerTeleports);
+    dataLoader.AddStep("Access Requirements", sObjectMgr, &ObjectMgr::LoadAccessRequirements);
+    dataLoader.AddStep("Quest Area Triggers", sObjectMgr, &ObjectMgr::LoadQuestAreaTriggers);
+    dataLoader.AddStep("Tavern Area Triggers", sObjectMgr, &ObjectMgr::LoadTavernAreaTriggers);
+    dataLoader.AddStep("AreaTrigger script names", sObjectMgr, &ObjectMgr::LoadAreaTriggerScripts);
+    dataLoader.AddStep("Graveyard-zone links", sObjectMgr, &ObjectMgr::LoadGraveyardZones);
+    dataLoader.AddStep("Exploration BaseXP Data", sObjectMgr, &ObjectMgr::LoadExplorationBaseXP);
+    dataLoader.AddStep("Pet Name Parts", sObjectMgr, &ObjectMgr::LoadPetNames);
+
+    dataLoader.Run(loaderThreads);
 
     // Delete expired auctions before loading
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting expired auctions...");
@@ -1765,27 +1754,6 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameTeleports...");
     sObjectMgr->LoadGameTele();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu...");
-    sObjectMgr->LoadGossipMenu();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu options...");
-    sObjectMgr->LoadGossipMenuItems();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Waypoints...");
-    sWaypointMgr->Load();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
     LoadWorldStates();
 
@@ -1913,6 +1881,8 @@ void World::SetInitialWorldSettings()
     // Delete all custom channels which haven't been used for PreserveCustomChannelDuration days.
     Channel::CleanOldChannelsInDB();
 
+    sChannelFanout->Initialize();
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Arena Season...");
     sGameEventMgr->StartArenaSeason();
 
@@ -2172,7 +2142,7 @@ void World::Update(uint32 diff)
         if (++mail_timer > mail_timer_expires)
         {
             mail_timer = 0;
-            sObjectMgr->ReturnOrDeleteOldMails(true);
+            sMaintenanceMgr->Schedule(MAINTENANCE_JOB_EXPIRED_MAIL);
         }
 
         ///- Handle expired auctions
@@ -2185,6 +2155,9 @@ void World::Update(uint32 diff)
     RecordTimeDiff(NULL);
     UpdateSessions(diff);
 
+    // hand over channel joins and leaves nobody spoke after
+    sChannelFanout->Update();
+
     SetRecordDiff(RECORD_DIFF_SESSION, getMSTime() - diffTime);
     diffTime = getMSTime();
 
@@ -2268,7 +2241,7 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
         m_timers[WUPDATE_DELETECHARS].Reset();
-        Player::DeleteOldCharacters();
+        sMaintenanceMgr->Schedule(MAINTENANCE_JOB_OLD_CHARACTERS);
     }
 
     sLFGMgr->Update(diff);
@@ -2286,9 +2259,15 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_CORPSES].Passed())
     {
         m_timers[WUPDATE_CORPSES].Reset();
-        sObjectAccessor->RemoveOldCorpses();
+        sMaintenanceMgr->Schedule(MAINTENANCE_JOB_OLD_CORPSES);
     }
 
+    // Handle the next entries of the running maintenance jobs
+    sMaintenanceMgr->Update();
+    SetRecordDiff(RECORD_DIFF_MAINTENANCE, getMSTime() - diffTime);
+    diffTime = getMSTime();
+    RecordTimeDiff("UpdateMaintenanceMgr");
+
     ///- Process Game events when necessary
     if (m_timers[WUPDATE_EVENTS].Passed())
     {
@@ -2314,6 +2293,9 @@ void World::Update(uint32 diff)
         sGuildMgr->SaveGuilds();
     }
 
+    // Write a few of the queued guilds each tick
+    sGuildMgr->UpdateSaveQueue();
+
     // Update Blackmarket
     if (m_timers[WUPDATE_BLACKMARKET].Passed())
     {
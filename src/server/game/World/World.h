@@ -129,6 +129,7 @@ enum WorldBoolConfigs
     CONFIG_DETECT_POS_COLLISION,
     CONFIG_RESTRICTED_LFG_CHANNEL,
     CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL,
+    CONFIG_CHANNEL_FANOUT,
     CONFIG_TALENTS_INSPECTING,
     CONFIG_CHAT_FAKE_MESSAGE_PREVENTING,
     CONFIG_DEATH_CORPSE_RECLAIM_DELAY_PVP,
@@ -219,6 +220,7 @@ enum WorldFloatConfigs
     CONFIG_STATS_LIMITS_PARRY,
     CONFIG_STATS_LIMITS_BLOCK,
     CONFIG_STATS_LIMITS_CRIT,
+    CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -341,6 +343,7 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_STARTUP_LOADER_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -351,6 +354,7 @@ enum WorldIntConfigs
     CONFIG_CHARDELETE_KEEP_DAYS,
     CONFIG_CHARDELETE_METHOD,
     CONFIG_CHARDELETE_MIN_LEVEL,
+    CONFIG_MAINTENANCE_TIME_BUDGET,
     CONFIG_AUTOBROADCAST_CENTER,
     CONFIG_AUTOBROADCAST_INTERVAL,
     CONFIG_MAX_RESULTS_LOOKUP_COMMANDS,
@@ -374,6 +378,10 @@ enum WorldIntConfigs
     CONFIG_WINTERGRASP_NOBATTLETIME,
     CONFIG_WINTERGRASP_RESTART_AFTER_CRASH,
     CONFIG_GUILD_SAVE_INTERVAL,
+    CONFIG_GUILD_SAVE_BATCH_SIZE,
+    CONFIG_MOVEMENT_RELAY_MAX_INTERVAL,
+    CONFIG_VMAP_LOS_CACHE_DURATION,
+    CONFIG_GRID_PREFETCH_LOOKAHEAD,
     CONFIG_GUILD_MAX_LEVEL,
     CONFIG_GUILD_UNDELETABLE_LEVEL,
     CONFIG_GUILD_DAILY_XP_CAP,
@@ -620,6 +628,7 @@ enum RecordDiffType
     RECORD_DIFF_OUTDOORPVP,
     RECORD_DIFF_LFG,
     RECORD_DIFF_CALLBACK,
+    RECORD_DIFF_MAINTENANCE,
     RECORD_DIFF_MAX
 };
 
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldLoader.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Errors.h"
+#include "Config.h"
+
+#include <sstream>
+
+#include <ace/Guard_T.h>
+#include <ace/Method_Request.h>
+#include <ace/OS_NS_unistd.h>
+
+class WorldLoaderThreadStartReq : public ACE_Method_Request
+{
+    public:
+        virtual int call()
+        {
+            MySQL::Thread_Init();
+            return 0;
+        }
+};
+
+class WorldLoaderThreadEndReq : public ACE_Method_Request
+{
+    public:
+        virtual int call()
+        {
+            MySQL::Thread_End();
+            return 0;
+        }
+};
+
+class WorldLoaderRequest : public ACE_Method_Request
+{
+    private:
+
+        WorldLoader& m_loader;
+        uint32 m_step;
+
+    public:
+
+        WorldLoaderRequest(WorldLoader& loader, uint32 step)
+            : m_loader(loader), m_step(step)
+        {
+        }
+
+        virtual int call()
+        {
+            m_loader.ExecuteStep(m_step);
+            m_loader.StepFinished(m_step);
+            return 0;
+        }
+};
+
+WorldLoader::WorldLoader(char const* name, bool logSteps) : m_name(name), m_logSteps(logSteps), m_executor(), m_mutex(), m_condition(m_mutex), m_remainingSteps(0)
+{
+}
+
+WorldLoader::~WorldLoader()
+{
+    for (std::vector<StepInfo>::iterator itr = m_steps.begin(); itr != m_steps.end(); ++itr)
+        delete itr->Loader;
+}
+
+uint32 WorldLoader::AddStep(char const* name, WorldLoaderFunctionStep::LoadFunction function)
+{
+    return AddStep(name, new WorldLoaderFunctionStep(function));
+}
+
+uint32 WorldLoader::AddStep(char const* name, WorldLoaderStep* loader)
+{
+    StepInfo info;
+    info.Name = name;
+    info.Loader = loader;
+    info.PendingDependencies = 0;
+    info.Duration = 0;
+    m_steps.push_back(info);
+    return uint32(m_steps.size() - 1);
+}
+
+void WorldLoader::AddDependency(uint32 step, uint32 dependency)
+{
+    // registration order must stay a valid serial order
+    ASSERT(dependency < step && step < m_steps.size());
+
+    m_steps[step].Dependencies.push_back(dependency);
+    m_steps[step].PendingDependencies++;
+    m_steps[dependency].Dependents.push_back(step);
+}
+
+void WorldLoader::Run(uint32 threads)
+{
+    uint32 oldMSTime = getMSTime();
+
+    if (threads > m_steps.size())
+        threads = uint32(m_steps.size());
+
+    if (threads <= 1 || m_executor.activate(int(threads), new WorldLoaderThreadStartReq, new WorldLoaderThreadEndReq) == -1)
+    {
+        threads = 1;
+        for (uint32 i = 0; i < m_steps.size(); ++i)
+            ExecuteStep(i);
+    }
+    else
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+        m_remainingSteps = uint32(m_steps.size());
+        for (uint32 i = 0; i < m_steps.size(); ++i)
+            if (!m_steps[i].PendingDependencies)
+                Schedule(i);
+
+        while (m_remainingSteps > 0)
+            m_condition.wait();
+    }
+
+    m_executor.deactivate();
+
+    LogCriticalPath(GetMSTimeDiffToNow(oldMSTime), threads);
+}
+
+void WorldLoader::ExecuteStep(uint32 step)
+{
+    StepInfo& info = m_steps[step];
+
+    if (m_logSteps)
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading %s...", info.Name.c_str());
+
+    uint32 oldMSTime = getMSTime();
+    info.Loader->Load();
+    info.Duration = GetMSTimeDiffToNow(oldMSTime);
+
+    if (m_logSteps)
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> %s step took %u ms", info.Name.c_str(), info.Duration);
+    else
+        sLog->outDebug(LOG_FILTER_SERVER_LOADING, "%s loaded in %u ms", info.Name.c_str(), info.Duration);
+}
+
+// m_mutex must be held
+void WorldLoader::Schedule(uint32 step)
+{
+    if (m_executor.execute(new WorldLoaderRequest(*this, step)) == -1)
+    {
+        // nothing else would run it, do not leave Run() waiting forever
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "WorldLoader: failed to schedule step '%s', running it on the calling thread.", m_steps[step].Name.c_str());
+        ExecuteStep(step);
+
+        --m_remainingSteps;
+        for (std::vector<uint32>::const_iterator itr = m_steps[step].Dependents.begin(); itr != m_steps[step].Dependents.end(); ++itr)
+            if (--m_steps[*itr].PendingDependencies == 0)
+                Schedule(*itr);
+    }
+}
+
+void WorldLoader::StepFinished(uint32 step)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+    --m_remainingSteps;
+    for (std::vector<uint32>::const_iterator itr = m_steps[step].Dependents.begin(); itr != m_steps[step].Dependents.end(); ++itr)
+        if (--m_steps[*itr].PendingDependencies == 0)
+            Schedule(*itr);
+
+    m_condition.broadcast();
+}
+
+void WorldLoader::LogCriticalPath(uint32 totalTime, uint32 threads) const
+{
+    if (m_steps.empty())
+        return;
+
+    // dependencies always precede their dependents, so one forward pass is enough
+    std::vector<uint32> pathTime(m_steps.size(), 0);
+    std::vector<int32> previous(m_steps.size(), -1);
+    uint32 last = 0;
+    uint32 serialTime = 0;
+
+    for (uint32 i = 0; i < m_steps.size(); ++i)
+    {
+        for (std::vector<uint32>::const_iterator itr = m_steps[i].Dependencies.begin(); itr != m_steps[i].Dependencies.end(); ++itr)
+        {
+            if (pathTime[*itr] > pathTime[i])
+            {
+                pathTime[i] = pathTime[*itr];
+                previous[i] = int32(*itr);
+            }
+        }
+
+        pathTime[i] += m_steps[i].Duration;
+        serialTime += m_steps[i].Duration;
+
+        if (pathTime[i] > pathTime[last])
+            last = i;
+    }
+
+    std::string path;
+    for (int32 i = int32(last); i >= 0; i = previous[i])
+    {
+        std::ostringstream ss;
+        ss << m_steps[i].Name << " (" << m_steps[i].Duration << " ms)";
+        path = path.empty() ? ss.str() : ss.str() + " -> " + path;
+    }
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> %s: %u steps loaded in %u ms on %u thread(s), sum of steps %u ms, critical path %u ms",
+        m_name.c_str(), uint32(m_steps.size()), totalTime, threads, serialTime, pathTime[last]);
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> %s critical path: %s", m_name.c_str(), path.c_str());
+}
+
+uint32 WorldLoader::GetConfiguredThreads()
+{
+    int32 threads = ConfigMgr::GetIntDefault("StartupLoader.Threads", 0);
+    if (threads > 0)
+        return uint32(threads);
+
+    // -1 where the processor count is not known
+    long processors = ACE_OS::num_processors_online();
+    return processors > 1 ? std::min<uint32>(uint32(processors), MAX_AUTO_LOADER_THREADS) : 1;
+}
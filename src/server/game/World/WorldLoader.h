@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_WORLDLOADER_H
+#define TRINITY_WORLDLOADER_H
+
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+#include "Define.h"
+#include "DelayExecutor.h"
+
+#include <string>
+#include <vector>
+
+// each loader thread holds a WorldDatabase synch connection for the lifetime of the server
+#define MAX_AUTO_LOADER_THREADS 8
+
+/// A single startup loader, e.g. ObjectMgr::LoadItemTemplates
+class WorldLoaderStep
+{
+    public:
+        virtual ~WorldLoaderStep() { }
+        virtual void Load() = 0;
+};
+
+class WorldLoaderFunctionStep : public WorldLoaderStep
+{
+    public:
+        typedef void (*LoadFunction)();
+
+        explicit WorldLoaderFunctionStep(LoadFunction function) : m_function(function) { }
+        void Load() { m_function(); }
+
+    private:
+        LoadFunction m_function;
+};
+
+template<class T>
+class WorldLoaderMethodStep : public WorldLoaderStep
+{
+    public:
+        typedef void (T::*LoadMethod)();
+
+        WorldLoaderMethodStep(T* object, LoadMethod method) : m_object(object), m_method(method) { }
+        void Load() { (m_object->*m_method)(); }
+
+    private:
+        T* m_object;
+        LoadMethod m_method;
+};
+
+/**
+ * Runs a group of startup loaders as a dependency graph.
+ *
+ * Steps are registered in the order the serial startup used to run them and a
+ * step may only depend on steps registered before it, so the registration order
+ * is always a valid serial order. With more than one thread a step is started as
+ * soon as all of its dependencies have finished; each worker thread gets its own
+ * MySQL thread context and takes whatever synch connection is free.
+ *
+ * The wall time of every step is recorded and the longest dependency chain
+ * (the lower bound of the group's load time) is logged once the group is done.
+ */
+class WorldLoader
+{
+    friend class WorldLoaderRequest;
+
+    public:
+        // logSteps: announce every step and its time at info level instead of debug
+        explicit WorldLoader(char const* name, bool logSteps = true);
+        ~WorldLoader();
+
+        uint32 AddStep(char const* name, WorldLoaderFunctionStep::LoadFunction function);
+
+        template<class T>
+        uint32 AddStep(char const* name, T* object, void (T::*method)())
+        {
+            return AddStep(name, new WorldLoaderMethodStep<T>(object, method));
+        }
+
+        // takes ownership of loader
+        uint32 AddStep(char const* name, WorldLoaderStep* loader);
+
+        // step must not start before dependency has finished
+        void AddDependency(uint32 step, uint32 dependency);
+
+        void Run(uint32 threads);
+
+        // StartupLoader.Threads, one thread per processor up to MAX_AUTO_LOADER_THREADS when it is 0
+        static uint32 GetConfiguredThreads();
+
+    private:
+        struct StepInfo
+        {
+            std::string Name;
+            WorldLoaderStep* Loader;
+            std::vector<uint32> Dependencies;
+            std::vector<uint32> Dependents;
+            uint32 PendingDependencies;
+            uint32 Duration;
+        };
+
+        void ExecuteStep(uint32 step);
+        void Schedule(uint32 step);
+        void StepFinished(uint32 step);
+        void LogCriticalPath(uint32 totalTime, uint32 threads) const;
+
+        std::string m_name;
+        bool m_logSteps;
+        std::vector<StepInfo> m_steps;
+
+        DelayExecutor m_executor;
+        ACE_Thread_Mutex m_mutex;
+        ACE_Condition_Thread_Mutex m_condition;
+        uint32 m_remainingSteps;
+};
+
+#endif
@@ -0,0 +1,1037 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* ScriptData
+Name: bench_commandscript
+%Complete: 100
+Comment: Timing of core code paths on synthetic data, only built with WITH_BENCHMARKS
+Category: commandscripts
+EndScriptData */
+
+#include "ScriptMgr.h"
+#include "ObjectMgr.h"
+#include "Chat.h"
+#include "LFGMatcher.h"
+#include "LFG.h"
+#include "AuctionHouseMgr.h"
+#include "AchievementMgr.h"
+#include "MovementStructures.h"
+#include "VMapFactory.h"
+#include "IVMapManager.h"
+#include "QueryResult.h"
+#include "ThreatManager.h"
+
+// Fills a PreparedResultSet row by row from caller owned bind buffers, the way the statement constructor stores fetched rows.
+class PreparedResultSetBench
+{
+    public:
+        static PreparedResultSet* Create(MYSQL_BIND* bind, uint64 rowCount, uint32 fieldCount)
+        {
+            return new PreparedResultSet(bind, rowCount, fieldCount);
+        }
+
+        static void StoreRow(PreparedResultSet* result) { result->StoreRow(); }
+        static void FinishRows(PreparedResultSet* result) { result->FinishRows(); }
+};
+
+// Indexes and searches a standalone AuctionHouseObject the way BuildListAuctionItems does, without the items:
+// no script hooks fire and nothing is registered in sAuctionMgr.
+class AuctionHouseBench
+{
+    public:
+        static void Add(AuctionHouseObject& house, AuctionEntry* auction, int32 randomPropertyId)
+        {
+            house.IndexAuction(auction, randomPropertyId);
+        }
+
+        // walks every auction instead of the candidates of the most selective filter when fullScan is set
+        static uint32 Search(AuctionHouseObject const& house, bool fullScan, std::wstring const& name, int locale,
+            uint8 levelMin, uint8 levelMax, uint32 itemClass, uint32 itemSubClass, uint32 quality)
+        {
+            std::vector<uint32> candidates;
+            AuctionHouseObject::AuctionSearchSourceType source = AuctionHouseObject::AUCTION_SEARCH_SOURCE_ALL;
+            if (fullScan)
+            {
+                candidates.reserve(house.AuctionIndex.size());
+                for (AuctionHouseObject::AuctionIndexMap::const_iterator itr = house.AuctionIndex.begin(); itr != house.AuctionIndex.end(); ++itr)
+                    candidates.push_back(itr->first);
+            }
+            else
+                source = house.FindSearchCandidates(candidates, name, locale, levelMin, levelMax, 0xFFFFFFFF, itemClass, itemSubClass, quality);
+
+            uint32 matches = 0;
+            for (std::vector<uint32>::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+                if (AuctionHouseObject::MatchesFilters(house.AuctionIndex.find(*itr)->second, source, name, locale, levelMin, levelMax, 0xFFFFFFFF, itemClass, itemSubClass, quality))
+                    ++matches;
+            return matches;
+        }
+};
+
+class bench_commandscript : public CommandScript
+{
+    public:
+        bench_commandscript() : CommandScript("bench_commandscript") { }
+
+        ChatCommand* GetCommands() const
+        {
+            static ChatCommand benchCommandTable[] =
+            {
+                { "lfg",            SEC_ADMINISTRATOR,  true,  &HandleBenchLfgCommand,             "", NULL },
+                { "auction",        SEC_ADMINISTRATOR,  true,  &HandleBenchAuctionCommand,         "", NULL },
+                { "achievement",    SEC_ADMINISTRATOR,  true,  &HandleBenchAchievementCommand,     "", NULL },
+                { "movementcodec",  SEC_ADMINISTRATOR,  true,  &HandleBenchMovementCodecCommand,   "", NULL },
+                { "movementrelay",  SEC_ADMINISTRATOR,  true,  &HandleBenchMovementRelayCommand,   "", NULL },
+                { "los",            SEC_ADMINISTRATOR,  false, &HandleBenchLosCommand,             "", NULL },
+                { "bytebuffer",     SEC_ADMINISTRATOR,  true,  &HandleBenchByteBufferCommand,      "", NULL },
+                { "resultset",      SEC_ADMINISTRATOR,  true,  &HandleBenchResultSetCommand,       "", NULL },
+                { "threat",         SEC_ADMINISTRATOR,  true,  &HandleBenchThreatCommand,          "", NULL },
+                { NULL,             SEC_PLAYER,         false, NULL,                               "", NULL }
+            };
+            static ChatCommand commandTable[] =
+            {
+                { "bench",          SEC_ADMINISTRATOR,  true,  NULL,                  "", benchCommandTable },
+                { NULL,             SEC_PLAYER,         false, NULL,                  "", NULL }
+            };
+            return commandTable;
+        }
+
+        // .bench lfg [#players [#dungeons]]
+        // Runs the dungeon finder matcher over #players synthetic solo players, each queued for one to three of
+        // #dungeons dungeons as tank, healer, damage or tank/healer/damage, and reports the groups it formed.
+        static bool HandleBenchLfgCommand(ChatHandler* handler, char const* args)
+        {
+            char* playersStr = strtok((char*)args, " ");
+            char* dungeonsStr = strtok(NULL, " ");
+            uint32 players = playersStr ? uint32(atoi(playersStr)) : 5000;
+            uint32 dungeons = dungeonsStr ? uint32(atoi(dungeonsStr)) : 30;
+            if (!players || !dungeons)
+                return false;
+
+            uint8 const roles[4] = { ROLE_TANK, ROLE_HEALER, ROLE_DAMAGE, ROLE_TANK | ROLE_HEALER | ROLE_DAMAGE };
+            uint32 const roleChances[4] = { 10, 15, 65, 10 };
+
+            LfgMatcherQueue queue(players);
+            for (uint32 i = 0; i < players; ++i)
+            {
+                LfgMatcherEntry& entry = queue[i];
+                entry.guid = MAKE_NEW_GUID(i + 1, 0, HIGHGUID_PLAYER);
+
+                uint32 roll = urand(0, 99);
+                uint8 role = 0;
+                while (roll >= roleChances[role])
+                    roll -= roleChances[role++];
+                entry.roles.push_back(roles[role]);
+
+                for (uint32 count = urand(1, 3); entry.dungeons.size() < std::min(count, dungeons);)
+                {
+                    uint32 dungeon = urand(1, dungeons);
+                    if (std::find(entry.dungeons.begin(), entry.dungeons.end(), dungeon) == entry.dungeons.end())
+                        entry.dungeons.push_back(dungeon);
+                }
+            }
+
+            LfgMatcherConflictMap conflicts;
+            std::vector<LfgMatcherGroup> groups;
+
+            uint32 oldMSTime = getMSTime();
+            LfgMatcher(queue, conflicts).Match(groups);
+            uint32 diff = GetMSTimeDiffToNow(oldMSTime);
+
+            uint32 matched = 0;
+            for (std::vector<LfgMatcherGroup>::const_iterator itr = groups.begin(); itr != groups.end(); ++itr)
+                matched += itr->size();
+
+            handler->PSendSysMessage("%u players queued for %u dungeons: %u groups formed, %u players matched, %u left in queue, %u ms.",
+                players, dungeons, uint32(groups.size()), matched, players - matched, diff);
+            return true;
+        }
+
+        // .bench auction [#auctions]
+        // Fills a standalone auction house with #auctions auctions of random item templates and times browse searches
+        // in the caller's locale, through the search indexes and by walking every auction. No items are created.
+        static bool HandleBenchAuctionCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 auctions = *args ? uint32(atoi(args)) : 100000;
+            if (!auctions)
+                return false;
+
+            int locale = handler->GetSessionDbLocaleIndex();
+
+            std::vector<ItemTemplate const*> protos;
+            ItemTemplateContainer const* store = sObjectMgr->GetItemTemplateStore();
+            for (ItemTemplateContainer::const_iterator itr = store->begin(); itr != store->end(); ++itr)
+                if (!itr->second.Name1.empty())
+                    protos.push_back(&itr->second);
+
+            if (protos.empty())
+                return false;
+
+            AuctionHouseObject house;
+            uint32 oldMSTime = getMSTime();
+            for (uint32 i = 0; i < auctions; ++i)
+            {
+                ItemTemplate const* proto = protos[urand(0, protos.size() - 1)];
+                AuctionEntry* auction = new AuctionEntry();
+                auction->Id = i + 1;
+                auction->auctioneer = 0;
+                auction->itemGUIDLow = 0;
+                auction->itemEntry = proto->ItemId;
+                auction->itemCount = 1;
+                auction->owner = 0;
+                auction->startbid = urand(1, 10000);
+                auction->bid = 0;
+                auction->buyout = auction->startbid * 2;
+                auction->expire_time = time(NULL) + HOUR;
+                auction->bidder = 0;
+                auction->deposit = 0;
+                auction->auctionHouseEntry = NULL;
+                auction->factionTemplateId = 0;
+                AuctionHouseBench::Add(house, auction, Item::GenerateItemRandomPropertyId(proto->ItemId));
+            }
+            handler->PSendSysMessage("%u auctions of %u item templates indexed in %u ms.", house.Getcount(), uint32(protos.size()), GetMSTimeDiffToNow(oldMSTime));
+
+            // the first letters of an auctioned item's name, in the caller's locale
+            std::wstring name = sAuctionMgr->GetLowerItemName(sObjectMgr->GetItemTemplate(house.GetAuction(1)->itemEntry), locale).substr(0, 4);
+
+            struct
+            {
+                char const* description;
+                uint32 itemClass;
+                uint32 itemSubClass;
+                uint32 quality;
+                uint8 levelMin;
+                uint8 levelMax;
+                bool byName;
+            } const searches[] =
+            {
+                { "no filter",                  0xFFFFFFFF,        0xFFFFFFFF,                 0xFFFFFFFF,          0,  0,  false },
+                { "weapons",                    ITEM_CLASS_WEAPON, 0xFFFFFFFF,                 0xFFFFFFFF,          0,  0,  false },
+                { "one-handed swords",          ITEM_CLASS_WEAPON, ITEM_SUBCLASS_WEAPON_SWORD, 0xFFFFFFFF,          0,  0,  false },
+                { "epic quality",               0xFFFFFFFF,        0xFFFFFFFF,                 ITEM_QUALITY_EPIC,   0,  0,  false },
+                { "required level 85 to 90",    0xFFFFFFFF,        0xFFFFFFFF,                 0xFFFFFFFF,          85, 90, false },
+                { "name",                       0xFFFFFFFF,        0xFFFFFFFF,                 0xFFFFFFFF,          0,  0,  true  },
+            };
+
+            uint32 const rounds = 10;
+            for (uint32 i = 0; i < sizeof(searches) / sizeof(searches[0]); ++i)
+            {
+                std::wstring searchedName = searches[i].byName ? name : std::wstring();
+                uint32 matches[2] = { 0, 0 };
+                uint32 times[2] = { 0, 0 };
+                for (uint8 fullScan = 0; fullScan < 2; ++fullScan)
+                {
+                    oldMSTime = getMSTime();
+                    for (uint32 round = 0; round < rounds; ++round)
+                        matches[fullScan] = AuctionHouseBench::Search(house, fullScan, searchedName, locale, searches[i].levelMin, searches[i].levelMax,
+                            searches[i].itemClass, searches[i].itemSubClass, searches[i].quality);
+                    times[fullScan] = GetMSTimeDiffToNow(oldMSTime);
+                }
+
+                handler->PSendSysMessage("%s: %u matches%s, %.2f ms per indexed search, %.2f ms per full scan.", searches[i].description, matches[0],
+                    matches[0] == matches[1] ? "" : " (DIFFERENT from the full scan)", float(times[0]) / rounds, float(times[1]) / rounds);
+            }
+            return true;
+        }
+
+        // .bench achievement [#rounds]
+        // Looks up the player criteria an update can advance for every asset used by an asset indexed criteria type,
+        // #rounds times, through the asset index and by walking all criteria of the type as updates used to.
+        static bool HandleBenchAchievementCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 rounds = *args ? uint32(atoi(args)) : 100;
+            if (!rounds)
+                return false;
+
+            std::vector<std::pair<AchievementCriteriaTypes, uint32> > lookups;
+            for (uint32 type = 0; type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++type)
+            {
+                if (!AchievementGlobalMgr::IsAssetIndexedCriteriaType(AchievementCriteriaTypes(type)))
+                    continue;
+
+                std::set<uint32> assets;
+                AchievementCriteriaEntryList const& criteria = sAchievementMgr->GetAchievementCriteriaByType(AchievementCriteriaTypes(type));
+                for (AchievementCriteriaEntryList::const_iterator itr = criteria.begin(); itr != criteria.end(); ++itr)
+                    if ((*itr)->raw.field3)
+                        assets.insert((*itr)->raw.field3);
+
+                for (std::set<uint32>::const_iterator itr = assets.begin(); itr != assets.end(); ++itr)
+                    lookups.push_back(std::make_pair(AchievementCriteriaTypes(type), *itr));
+            }
+
+            if (lookups.empty())
+                return false;
+
+            uint64 indexMatches = 0;
+            uint32 oldMSTime = getMSTime();
+            for (uint32 round = 0; round < rounds; ++round)
+                for (std::vector<std::pair<AchievementCriteriaTypes, uint32> >::const_iterator itr = lookups.begin(); itr != lookups.end(); ++itr)
+                    indexMatches += sAchievementMgr->GetAchievementCriteriaByAsset(itr->first, itr->second).size();
+            uint32 indexTime = GetMSTimeDiffToNow(oldMSTime);
+
+            uint64 scanMatches = 0;
+            oldMSTime = getMSTime();
+            for (uint32 round = 0; round < rounds; ++round)
+            {
+                for (std::vector<std::pair<AchievementCriteriaTypes, uint32> >::const_iterator itr = lookups.begin(); itr != lookups.end(); ++itr)
+                {
+                    AchievementCriteriaEntryList const& criteria = sAchievementMgr->GetAchievementCriteriaByType(itr->first);
+                    for (AchievementCriteriaEntryList::const_iterator citr = criteria.begin(); citr != criteria.end(); ++citr)
+                        if ((*citr)->raw.field3 == itr->second)
+                            ++scanMatches;
+                }
+            }
+            uint32 scanTime = GetMSTimeDiffToNow(oldMSTime);
+
+            handler->PSendSysMessage("%u rounds of %u asset lookups: asset index %u ms, walking the type %u ms, %.1f criteria per lookup, results %s.",
+                rounds, uint32(lookups.size()), indexTime, scanTime, float(indexMatches) / (uint64(rounds) * lookups.size()), indexMatches == scanMatches ? "identical" : "DIFFERENT");
+            return true;
+        }
+
+        static float RandomMovementFloat(float min, float max)
+        {
+            return urand(0, 1) ? frand(min, max) : 0.0f;
+        }
+
+        static void RandomizeMovementInfo(MovementInfo& info)
+        {
+            ObjectGuid guid;
+            ObjectGuid tguid;
+            for (uint8 i = 0; i < 8; ++i)
+            {
+                guid[i] = urand(0, 1) ? uint8(urand(0, 255)) : 0;
+                tguid[i] = urand(0, 1) ? uint8(urand(0, 255)) : 0;
+            }
+
+            info.guid = guid;
+            info.flags = urand(0, 1) ? urand(0, 0x3FFFFFFF) : 0;
+            info.flags2 = urand(0, 1) ? uint16(urand(0, 0x1FFF)) : 0;
+            info.pos.Relocate(frand(-10000.0f, 10000.0f), frand(-10000.0f, 10000.0f), frand(-500.0f, 500.0f), RandomMovementFloat(0.1f, 6.2f));
+            info.time = urand(0, 1) ? urand(1, 0xFFFFFFFF) : 0;
+
+            if (urand(0, 1))
+            {
+                info.t_guid = tguid;
+                info.t_pos.Relocate(frand(-50.0f, 50.0f), frand(-50.0f, 50.0f), frand(-50.0f, 50.0f), frand(0.0f, 6.2f));
+                info.t_seat = int8(urand(0, 255));
+                info.t_time = urand(0, 0xFFFFFFFF);
+                info.has_t_time2 = urand(0, 1);
+                info.t_time2 = info.has_t_time2 ? urand(0, 0xFFFFFFFF) : 0;
+                info.has_t_time3 = urand(0, 1);
+                info.t_time3 = info.has_t_time3 ? urand(0, 0xFFFFFFFF) : 0;
+            }
+
+            info.pitch = RandomMovementFloat(-1.5f, 1.5f);
+            info.hasFallData = urand(0, 1);
+            if (info.hasFallData)
+            {
+                info.fallTime = urand(0, 0xFFFFFFFF);
+                info.j_zspeed = frand(-50.0f, 50.0f);
+                info.hasFallDirection = urand(0, 1);
+                if (info.hasFallDirection)
+                {
+                    info.j_cosAngle = frand(-1.0f, 1.0f);
+                    info.j_sinAngle = frand(-1.0f, 1.0f);
+                    info.j_xyspeed = frand(0.0f, 50.0f);
+                }
+            }
+
+            info.splineElevation = RandomMovementFloat(-10.0f, 10.0f);
+            info.Alive32 = urand(0, 1) ? urand(1, 0xFFFFFFFF) : 0;
+        }
+
+        // compares float bit patterns, read values may be NaN
+        static bool SameMovementFloat(float a, float b)
+        {
+            return memcmp(&a, &b, sizeof(float)) == 0;
+        }
+
+        static bool SameMovementPosition(Position const& a, Position const& b)
+        {
+            return SameMovementFloat(a.m_positionX, b.m_positionX) && SameMovementFloat(a.m_positionY, b.m_positionY) &&
+                SameMovementFloat(a.m_positionZ, b.m_positionZ) && SameMovementFloat(a.m_orientation, b.m_orientation);
+        }
+
+        static bool SameMovementInfo(MovementInfo const& a, MovementInfo const& b)
+        {
+            return a.guid == b.guid && a.flags == b.flags && a.flags2 == b.flags2 && SameMovementPosition(a.pos, b.pos) &&
+                a.time == b.time && a.t_guid == b.t_guid && SameMovementPosition(a.t_pos, b.t_pos) && a.t_seat == b.t_seat &&
+                a.t_time == b.t_time && a.t_time2 == b.t_time2 && a.t_time3 == b.t_time3 && a.HavePitch == b.HavePitch &&
+                a.fallTime == b.fallTime && SameMovementFloat(a.j_zspeed, b.j_zspeed) && SameMovementFloat(a.j_cosAngle, b.j_cosAngle) &&
+                SameMovementFloat(a.j_sinAngle, b.j_sinAngle) && SameMovementFloat(a.j_xyspeed, b.j_xyspeed) &&
+                a.HaveSplineElevation == b.HaveSplineElevation && a.Alive32 == b.Alive32 && a.hasFallData == b.hasFallData &&
+                a.hasFallDirection == b.hasFallDirection && a.has_t_time2 == b.has_t_time2 && a.has_t_time3 == b.has_t_time3;
+        }
+
+        static bool SameExtraMovementData(ExtraMovementStatusElement const& a, ExtraMovementStatusElement const& b)
+        {
+            ObjectGuid guidA = a.Data.guid;
+            ObjectGuid guidB = b.Data.guid;
+            return uint64(guidA) == uint64(guidB) && SameMovementFloat(a.Data.floatData, b.Data.floatData) && a.Data.byteData == b.Data.byteData;
+        }
+
+        // .bench movementcodec [#count]
+        // Writes and reads #count random movement infos for every movement opcode through the generated codec and
+        // through the sequence interpreter, reports every opcode where the two disagree and the rate of both.
+        static bool HandleBenchMovementCodecCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 count = *args ? uint32(atoi(args)) : 1000;
+            if (!count)
+                return false;
+
+            // every extra element of a sequence is sent as a float, more than any sequence uses
+            static MovementStatusElements const extraElements[] =
+            {
+                MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat,
+                MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat, MSEExtraFloat
+            };
+
+            uint32 opcodes = 0;
+            uint32 failed = 0;
+            uint64 packets = 0;
+            uint32 codecTime = 0;
+            uint32 interpreterTime = 0;
+
+            WorldPacket codecPacket;
+            WorldPacket interpreterPacket;
+
+            for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+            {
+                MovementStatusCodec const* codec = GetMovementStatusCodec(Opcodes(opcode));
+                if (!codec)
+                    continue;
+
+                ++opcodes;
+
+                // the interpreter cannot write the generic client-only elements
+                bool interpreterWrites = true;
+                for (MovementStatusElements const* itr = codec->Sequence; *itr != MSEEnd; ++itr)
+                    if (*itr == MSEGeneric2bits0 || (*itr >= MSEGenericDword0 && *itr <= MSEGenericDword7))
+                        interpreterWrites = false;
+
+                bool same = true;
+                for (uint32 i = 0; i < count && same; ++i)
+                {
+                    MovementInfo info;
+                    RandomizeMovementInfo(info);
+
+                    ExtraMovementStatusElement extras(extraElements);
+                    extras.Data.guid = (uint64(urand(0, 0xFFFFFFFF)) << 32) | urand(0, 0xFFFFFFFF);
+                    extras.Data.floatData = frand(0.0f, 100.0f);
+                    extras.Data.byteData = int8(urand(0, 255));
+
+                    codecPacket.Initialize(Opcodes(opcode));
+                    codec->Write(codecPacket, &info, &extras);
+                    codecPacket.FlushBits();
+
+                    if (interpreterWrites)
+                    {
+                        extras.ResetIndex();
+                        interpreterPacket.Initialize(Opcodes(opcode));
+                        WriteMovementStatusSequence(codec->Sequence, interpreterPacket, &info, &extras);
+                        interpreterPacket.FlushBits();
+
+                        if (codecPacket.size() != interpreterPacket.size() ||
+                            (codecPacket.size() && memcmp(codecPacket.contents(), interpreterPacket.contents(), codecPacket.size())))
+                            same = false;
+                    }
+
+                    interpreterPacket = codecPacket;
+
+                    MovementInfo codecInfo;
+                    MovementInfo interpreterInfo;
+                    ExtraMovementStatusElement codecExtras(extraElements);
+                    ExtraMovementStatusElement interpreterExtras(extraElements);
+
+                    bool codecTransport = codec->Read(codecPacket, &codecInfo, &codecExtras);
+                    bool interpreterTransport = ReadMovementStatusSequence(codec->Sequence, interpreterPacket, &interpreterInfo, &interpreterExtras);
+
+                    if (codecTransport != interpreterTransport || codecPacket.rpos() != interpreterPacket.rpos() ||
+                        !SameMovementInfo(codecInfo, interpreterInfo) || !SameExtraMovementData(codecExtras, interpreterExtras))
+                        same = false;
+                }
+
+                if (!same)
+                {
+                    ++failed;
+                    handler->PSendSysMessage("Opcode 0x%04X: generated codec and interpreter disagree.", opcode);
+                    continue;
+                }
+
+                if (!interpreterWrites)
+                    continue;
+
+                // same packet through both, write and read counted as one packet
+                MovementInfo info;
+                MovementInfo readInfo;
+                RandomizeMovementInfo(info);
+                ExtraMovementStatusElement extras(extraElements);
+
+                uint32 oldMSTime = getMSTime();
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    extras.ResetIndex();
+                    codecPacket.Initialize(Opcodes(opcode));
+                    codec->Write(codecPacket, &info, &extras);
+                    codecPacket.FlushBits();
+                    extras.ResetIndex();
+                    codec->Read(codecPacket, &readInfo, &extras);
+                }
+                codecTime += GetMSTimeDiffToNow(oldMSTime);
+
+                oldMSTime = getMSTime();
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    extras.ResetIndex();
+                    interpreterPacket.Initialize(Opcodes(opcode));
+                    WriteMovementStatusSequence(codec->Sequence, interpreterPacket, &info, &extras);
+                    interpreterPacket.FlushBits();
+                    extras.ResetIndex();
+                    ReadMovementStatusSequence(codec->Sequence, interpreterPacket, &readInfo, &extras);
+                }
+                interpreterTime += GetMSTimeDiffToNow(oldMSTime);
+
+                packets += count;
+            }
+
+            codecTime = std::max<uint32>(codecTime, 1);
+            interpreterTime = std::max<uint32>(interpreterTime, 1);
+
+            handler->PSendSysMessage("%u movement opcodes checked with %u random packets each, %u mismatching.", opcodes, count, failed);
+            handler->PSendSysMessage("Write + read of " UI64FMTD " packets: generated codecs %u ms (" UI64FMTD " packets/s), interpreter %u ms (" UI64FMTD " packets/s).",
+                packets, codecTime, packets * IN_MILLISECONDS / codecTime, interpreterTime, packets * IN_MILLISECONDS / interpreterTime);
+            return true;
+        }
+
+        struct SimulatedMover
+        {
+            float x;
+            float y;
+            float orientation;
+            bool moving;
+            uint32 nextHeartbeat;
+            uint32 nextChange;
+            MovementRelayState relay;
+        };
+
+        static void SimulateMovementRelay(ChatHandler* handler, uint32 players, uint32 seconds)
+        {
+            float const range = World::GetMaxVisibleDistanceOnContinents();
+            float const areaSize = 100.0f;                  // players walk around in a square of twice this size
+            float const speed = 7.0f;                       // run speed, yards per second
+            uint32 const step = 100;                        // simulated update diff
+            uint32 const heartbeatInterval = 500;           // client heartbeat while moving
+
+            // size of a running heartbeat
+            MovementInfo sample;
+            sample.guid = MAKE_NEW_GUID(1, 0, HIGHGUID_PLAYER);
+            sample.flags = MOVEMENTFLAG_FORWARD;
+            sample.time = 1;
+            sample.pos.Relocate(1.0f, 1.0f, 1.0f, 1.0f);
+
+            WorldPacket data(SMSG_MOVE_UPDATE);
+            if (MovementStatusCodec const* codec = GetMovementStatusCodec(SMSG_MOVE_UPDATE))
+                codec->Write(data, &sample, NULL);
+            data.FlushBits();
+            uint64 const packetSize = data.size() + 4;     // plus server packet header
+
+            std::vector<SimulatedMover> movers(players);
+            for (uint32 i = 0; i < players; ++i)
+            {
+                movers[i].x = frand(-areaSize, areaSize);
+                movers[i].y = frand(-areaSize, areaSize);
+                movers[i].orientation = frand(0.0f, 2 * M_PI);
+                movers[i].moving = false;
+                movers[i].nextHeartbeat = 0;
+                movers[i].nextChange = urand(0, 5000);
+            }
+
+            uint64 inRange = 0;
+            uint64 relayed = 0;
+
+            for (uint32 now = 0; now < seconds * IN_MILLISECONDS; now += step)
+            {
+                for (uint32 i = 0; i < players; ++i)
+                {
+                    SimulatedMover& mover = movers[i];
+                    bool stateChange = false;
+                    bool send = false;
+
+                    if (now >= mover.nextChange)
+                    {
+                        // start, stop or turn
+                        mover.moving = urand(0, 9) < 7;
+                        mover.orientation = frand(0.0f, 2 * M_PI);
+                        mover.nextChange = now + urand(2000, 8000);
+                        mover.nextHeartbeat = now + heartbeatInterval;
+                        stateChange = true;
+                        send = true;
+                    }
+                    else if (mover.moving && now >= mover.nextHeartbeat)
+                    {
+                        mover.nextHeartbeat += heartbeatInterval;
+                        send = true;
+                    }
+
+                    if (mover.moving)
+                    {
+                        mover.x += std::cos(mover.orientation) * speed * step / IN_MILLISECONDS;
+                        mover.y += std::sin(mover.orientation) * speed * step / IN_MILLISECONDS;
+                        if (std::fabs(mover.x) > areaSize || std::fabs(mover.y) > areaSize)
+                        {
+                            mover.x = std::max(-areaSize, std::min(areaSize, mover.x));
+                            mover.y = std::max(-areaSize, std::min(areaSize, mover.y));
+                            mover.orientation = Position::NormalizeOrientation(mover.orientation + M_PI);
+                        }
+                    }
+
+                    if (!send)
+                        continue;
+
+                    for (uint32 j = 0; j < players; ++j)
+                    {
+                        if (j == i)
+                            continue;
+
+                        float dx = movers[j].x - mover.x;
+                        float dy = movers[j].y - mover.y;
+                        float dist = std::sqrt(dx * dx + dy * dy);
+                        if (dist > range)
+                            continue;
+
+                        ++inRange;
+                        if (mover.relay.ShouldDeliver(uint64(j + 1), dist, range, stateChange, now))
+                            ++relayed;
+                    }
+                }
+            }
+
+            uint64 saved = inRange - relayed;
+            handler->PSendSysMessage("%u players, %u s: " UI64FMTD " packets/s in range, " UI64FMTD " packets/s relayed, saved " UI64FMTD " packets/s (" UI64FMTD " bytes/s, %u%%).",
+                players, seconds, inRange / seconds, relayed / seconds, saved / seconds, saved * packetSize / seconds, inRange ? uint32(saved * 100 / inRange) : 0);
+        }
+
+        // .bench movementrelay [#players [#seconds]]
+        // Simulates a crowd moving around a city sized area and reports the movement packets and bytes the
+        // relay saves over sending every update to everyone in range. Without #players crowds of 50, 100,
+        // 200 and 300 players are simulated. Uses the Visibility.MovementRelay.* settings.
+        static bool HandleBenchMovementRelayCommand(ChatHandler* handler, char const* args)
+        {
+            char* playersStr = strtok((char*)args, " ");
+            char* secondsStr = strtok(NULL, " ");
+
+            uint32 seconds = secondsStr ? uint32(atoi(secondsStr)) : 60;
+            if (!seconds)
+                return false;
+
+            if (playersStr)
+            {
+                uint32 players = uint32(atoi(playersStr));
+                if (players < 2)
+                    return false;
+
+                SimulateMovementRelay(handler, players, seconds);
+                return true;
+            }
+
+            static uint32 const crowds[] = { 50, 100, 200, 300 };
+            for (uint8 i = 0; i < 4; ++i)
+                SimulateMovementRelay(handler, crowds[i], seconds);
+
+            return true;
+        }
+
+        // .bench los [#targets [#rounds]]
+        // Traces line of sight from the player to #targets random points on the ground within 40 yards, ray by
+        // ray and as one batch, and reports the vmap tree nodes visited and the time taken by both. Needs the
+        // vmap tiles around the player to be loaded.
+        static bool HandleBenchLosCommand(ChatHandler* handler, char const* args)
+        {
+            char* targetsStr = strtok((char*)args, " ");
+            char* roundsStr = strtok(NULL, " ");
+
+            uint32 count = targetsStr ? uint32(atoi(targetsStr)) : 25;
+            uint32 rounds = roundsStr ? uint32(atoi(roundsStr)) : 1000;
+            if (!count || !rounds)
+                return false;
+
+            Player* player = handler->GetSession()->GetPlayer();
+            Map* map = player->GetMap();
+            VMAP::IVMapManager* vMapManager = VMAP::VMapFactory::createOrGetVMapManager();
+
+            // eye height, as WorldObject::IsWithinLOS
+            float x, y, z;
+            player->GetPosition(x, y, z);
+            z += 2.0f;
+
+            std::vector<G3D::Vector3> targets(count);
+            std::vector<LineOfSightQuery> queries(count);
+            for (uint32 i = 0; i < count; ++i)
+            {
+                float angle = frand(0.0f, 2.0f * M_PI);
+                float dist = frand(5.0f, 40.0f);
+                float tx = x + dist * std::cos(angle);
+                float ty = y + dist * std::sin(angle);
+                float tz = map->GetHeight(player->GetPhaseMask(), tx, ty, z + 10.0f);
+                if (tz <= INVALID_HEIGHT)
+                    tz = z - 2.0f;
+
+                targets[i] = G3D::Vector3(tx, ty, tz + 2.0f);
+                queries[i].x = tx;
+                queries[i].y = ty;
+                queries[i].z = tz + 2.0f;
+                queries[i].phasemask = player->GetPhaseMask();
+            }
+
+            bool* separate = new bool[count];
+            bool* batched = new bool[count];
+            uint32 separateVisits = 0;
+            uint32 batchVisits = 0;
+
+            uint32 oldMSTime = getMSTime();
+            for (uint32 round = 0; round < rounds; ++round)
+                for (uint32 i = 0; i < count; ++i)
+                    vMapManager->isInLineOfSight(map->GetId(), x, y, z, &targets[i], &separate[i], 1, round ? NULL : &separateVisits);
+            uint32 separateTime = GetMSTimeDiffToNow(oldMSTime);
+
+            oldMSTime = getMSTime();
+            for (uint32 round = 0; round < rounds; ++round)
+                vMapManager->isInLineOfSight(map->GetId(), x, y, z, &targets[0], batched, count, round ? NULL : &batchVisits);
+            uint32 batchTime = GetMSTimeDiffToNow(oldMSTime);
+
+            uint32 blocked = 0;
+            uint32 mismatches = 0;
+            for (uint32 i = 0; i < count; ++i)
+            {
+                bool single = vMapManager->isInLineOfSight(map->GetId(), x, y, z, targets[i].x, targets[i].y, targets[i].z);
+                if (separate[i] != single || batched[i] != single)
+                    ++mismatches;
+                if (!single)
+                    ++blocked;
+            }
+
+            delete[] separate;
+            delete[] batched;
+
+            // what spell targeting sees: one batch fills the cache, the per target checks hit it
+            map->ClearLineOfSightCache();
+            oldMSTime = getMSTime();
+            for (uint32 round = 0; round < rounds; ++round)
+            {
+                map->isInLineOfSight(x, y, z, queries);
+                for (uint32 i = 0; i < count; ++i)
+                    map->isInLineOfSight(queries[i].x, queries[i].y, queries[i].z, x, y, z, queries[i].phasemask);
+            }
+            uint32 cachedTime = GetMSTimeDiffToNow(oldMSTime);
+            map->ClearLineOfSightCache();
+
+            if (!separateVisits)
+                handler->SendSysMessage("No vmap tree was visited, are vmaps enabled and loaded here?");
+
+            handler->PSendSysMessage("%u targets, %u blocked, %u disagreeing with the single ray check.", count, blocked, mismatches);
+            handler->PSendSysMessage("Tree nodes visited: separate rays %u, batch %u (%u%%).",
+                separateVisits, batchVisits, separateVisits ? batchVisits * 100 / separateVisits : 0);
+            handler->PSendSysMessage("%u rounds: separate rays %u ms, batch %u ms, batch and checks through the map cache %u ms.",
+                rounds, separateTime, batchTime, cachedTime);
+            return true;
+        }
+
+        // .bench bytebuffer [#count]
+        // Builds #count rounds of a small handler reply, an update field buffer and a large packet, and reports
+        // how many of their storage blocks came from the heap rather than the thread's buffer pool.
+        static bool HandleBenchByteBufferCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 count = *args ? uint32(atoi(args)) : 100000;
+            if (!count)
+                return false;
+
+            ByteBufferPoolStats before = ByteBufferStorage::GetPoolStats();
+            uint64 bytes = 0;
+
+            uint32 oldMSTime = getMSTime();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                ObjectGuid guid = MAKE_NEW_GUID(i, 0, HIGHGUID_PLAYER);
+                uint8 bitOrder[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+                WorldPacket reply(SMSG_MOVE_UPDATE);
+                reply.WriteBitInOrder(guid, bitOrder);
+                reply.WriteBits(i, 22);
+                reply.FlushBits();
+                reply.WriteBytesSeq(guid, bitOrder);
+                reply << uint32(i) << float(i);
+
+                ByteBuffer fieldBuffer;
+                for (uint32 j = 0; j < 64; ++j)
+                    fieldBuffer << uint32(i + j);
+
+                WorldPacket large(SMSG_MOVE_UPDATE);
+                for (uint32 j = 0; j < 1500; ++j)
+                    large << uint32(j);
+                large.append(fieldBuffer);
+
+                bytes += reply.size() + fieldBuffer.size() + large.size();
+            }
+            uint32 diff = std::max<uint32>(GetMSTimeDiffToNow(oldMSTime), 1);
+
+            ByteBufferPoolStats after = ByteBufferStorage::GetPoolStats();
+            uint32 heap = uint32(after.HeapAllocations - before.HeapAllocations);
+            uint32 pooled = uint32(after.PoolAllocations - before.PoolAllocations);
+
+            handler->PSendSysMessage("%u buffers (" UI64FMTD " bytes) built in %u ms: %u blocks taken from the heap, %u from the pool, %u given back to the heap.",
+                count * 3, bytes, diff, heap, pooled, uint32(after.HeapFrees - before.HeapFrees));
+            handler->PSendSysMessage("%.3f heap allocations per buffer, previously at least 1.", float(heap) / (count * 3));
+            return true;
+        }
+
+        // .bench resultset [#rows]
+        // Buffers a synthetic prepared result of #rows creature like rows (one string and one nullable column),
+        // reads every field back through the typed getters and compares with copying each value into its own allocation.
+        static bool HandleBenchResultSetCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 rows = *args ? uint32(atoi(args)) : 1000000;
+            if (!rows)
+                return false;
+
+            enum { COLUMNS = 12 };
+            enum_field_types const types[COLUMNS] =
+            {
+                MYSQL_TYPE_LONG, MYSQL_TYPE_LONG, MYSQL_TYPE_SHORT, MYSQL_TYPE_FLOAT, MYSQL_TYPE_FLOAT, MYSQL_TYPE_FLOAT,
+                MYSQL_TYPE_FLOAT, MYSQL_TYPE_LONG, MYSQL_TYPE_LONG, MYSQL_TYPE_VAR_STRING, MYSQL_TYPE_TINY, MYSQL_TYPE_LONGLONG
+            };
+            unsigned long const sizes[COLUMNS] = { 4, 4, 2, 4, 4, 4, 4, 4, 4, 33, 1, 8 };
+            uint64 buffers[COLUMNS][5];
+            unsigned long lengths[COLUMNS];
+            my_bool isNull[COLUMNS];
+
+            MYSQL_BIND bind[COLUMNS];
+            memset(bind, 0, sizeof(bind));
+            memset(buffers, 0, sizeof(buffers));
+            for (uint32 i = 0; i < COLUMNS; ++i)
+            {
+                bind[i].buffer_type = types[i];
+                bind[i].buffer = buffers[i];
+                bind[i].buffer_length = sizes[i];
+                bind[i].length = &lengths[i];
+                bind[i].is_null = &isNull[i];
+                lengths[i] = sizes[i];
+                isNull[i] = 0;
+            }
+
+            uint32 oldMSTime = getMSTime();
+            PreparedResultSet* result = PreparedResultSetBench::Create(bind, rows, COLUMNS);
+            for (uint32 row = 0; row < rows; ++row)
+            {
+                FillResultSetBenchRow(bind, row);
+                PreparedResultSetBench::StoreRow(result);
+            }
+            PreparedResultSetBench::FinishRows(result);
+            uint32 storeTime = GetMSTimeDiffToNow(oldMSTime);
+
+            oldMSTime = getMSTime();
+            uint64 checksum = 0;
+            do
+            {
+                Field* fields = result->Fetch();
+                checksum += fields[0].GetUInt32() + fields[1].GetUInt32() + fields[2].GetUInt16();
+                checksum += uint64(fields[3].GetFloat() + fields[4].GetFloat() + fields[5].GetFloat() + fields[6].GetFloat());
+                checksum += fields[7].GetUInt32() + fields[8].GetUInt32() + fields[9].GetStringLength();
+                checksum += fields[10].GetUInt8() + fields[11].GetUInt64();
+            }
+            while (result->NextRow());
+            uint32 readTime = GetMSTimeDiffToNow(oldMSTime);
+            size_t dataSize = result->GetDataSize();
+
+            oldMSTime = getMSTime();
+            delete result;
+            uint32 freeTime = GetMSTimeDiffToNow(oldMSTime);
+
+            // what buffering the same rows cost with a field array per row and an allocation per value
+            oldMSTime = getMSTime();
+            std::vector<char**> copies(rows);
+            for (uint32 row = 0; row < rows; ++row)
+            {
+                FillResultSetBenchRow(bind, row);
+                copies[row] = new char*[COLUMNS];
+                for (uint32 i = 0; i < COLUMNS; ++i)
+                {
+                    copies[row][i] = NULL;
+                    if (!isNull[i])
+                    {
+                        copies[row][i] = new char[sizes[i]];
+                        memcpy(copies[row][i], bind[i].buffer, sizes[i]);
+                    }
+                }
+            }
+            for (uint32 row = 0; row < rows; ++row)
+            {
+                for (uint32 i = 0; i < COLUMNS; ++i)
+                    delete[] copies[row][i];
+                delete[] copies[row];
+            }
+            uint32 copyTime = GetMSTimeDiffToNow(oldMSTime);
+
+            handler->PSendSysMessage("%u rows of %u columns buffered in %u ms into %u KB, read back in %u ms (checksum " UI64FMTD "), freed in %u ms.",
+                rows, uint32(COLUMNS), storeTime, uint32(dataSize / 1024), readTime, checksum, freeTime);
+            handler->PSendSysMessage("Copying every value into its own allocation took %u ms to buffer and free.", copyTime);
+            return true;
+        }
+
+        static void FillResultSetBenchRow(MYSQL_BIND* bind, uint32 row)
+        {
+            *static_cast<uint32*>(bind[0].buffer) = row;
+            *static_cast<uint32*>(bind[1].buffer) = 1000 + row % 5000;
+            *static_cast<uint16*>(bind[2].buffer) = uint16(row % 1000);
+            for (uint32 i = 3; i < 7; ++i)
+                *static_cast<float*>(bind[i].buffer) = float(row % 10000) * 0.5f + i;
+            *static_cast<uint32*>(bind[7].buffer) = 300;
+            *static_cast<uint32*>(bind[8].buffer) = 1 + row % 100000;
+
+            // empty for most rows, like creature.ScriptName
+            *bind[9].length = row % 8 ? 0 : snprintf(static_cast<char*>(bind[9].buffer), bind[9].buffer_length, "npc_bench_script_%u", row % 97);
+            *static_cast<uint8*>(bind[10].buffer) = 1;
+
+            *bind[11].is_null = row % 2;
+            *static_cast<uint64*>(bind[11].buffer) = row;
+        }
+
+        struct ThreatBenchEntry
+        {
+            uint64 Guid;
+            float Threat;
+
+            float getThreat() const { return Threat; }
+        };
+
+        enum
+        {
+            THREAT_BENCH_PLAYERS = 40,
+            THREAT_BENCH_ADDS    = 30
+        };
+
+        // Deterministic threat event: which player hit the add and for how much, tanks generate the most
+        static float NextThreatBenchEvent(uint32& seed, uint32& player)
+        {
+            seed = seed * 1103515245 + 12345;
+            player = (seed >> 8) % THREAT_BENCH_PLAYERS;
+            float amount = float((seed >> 16) % 200);
+            return player < 2 ? 1000.0f + amount * 5.0f : (player < 10 ? amount * 0.5f : 100.0f + amount);
+        }
+
+        // .bench threat [#ticks]
+        // Simulates #ticks rounds of a 40 player raid hitting 30 adds, every player adding threat to every add once
+        // per round followed by a victim update, with the previous sorted list and with the ordered threat array.
+        static bool HandleBenchThreatCommand(ChatHandler* handler, char const* args)
+        {
+            uint32 ticks = *args ? uint32(atoi(args)) : 1000;
+            if (!ticks)
+                return false;
+
+            std::vector<ThreatBenchEntry*> entries;
+            std::list<ThreatBenchEntry*> lists[THREAT_BENCH_ADDS];
+            std::vector<ThreatBenchEntry*> arrays[THREAT_BENCH_ADDS];
+            std::vector<uint64> guids[THREAT_BENCH_ADDS];
+            for (uint32 add = 0; add < THREAT_BENCH_ADDS; ++add)
+            {
+                for (uint32 player = 0; player < THREAT_BENCH_PLAYERS; ++player)
+                {
+                    ThreatBenchEntry* listEntry = new ThreatBenchEntry();
+                    listEntry->Guid = MAKE_NEW_GUID(player + 1, 0, HIGHGUID_PLAYER);
+                    listEntry->Threat = 0.0f;
+                    ThreatBenchEntry* arrayEntry = new ThreatBenchEntry(*listEntry);
+
+                    lists[add].push_back(listEntry);
+                    arrays[add].push_back(arrayEntry);
+                    guids[add].push_back(arrayEntry->Guid);
+                    entries.push_back(listEntry);
+                    entries.push_back(arrayEntry);
+                }
+            }
+
+            uint32 seed = 1;
+            uint32 oldMSTime = getMSTime();
+            uint64 listChecksum = 0;
+            for (uint32 tick = 0; tick < ticks; ++tick)
+            {
+                for (uint32 add = 0; add < THREAT_BENCH_ADDS; ++add)
+                {
+                    std::list<ThreatBenchEntry*>& list = lists[add];
+                    for (uint32 i = 0; i < THREAT_BENCH_PLAYERS; ++i)
+                    {
+                        uint32 player;
+                        float threat = NextThreatBenchEvent(seed, player);
+                        uint64 guid = MAKE_NEW_GUID(player + 1, 0, HIGHGUID_PLAYER);
+                        for (std::list<ThreatBenchEntry*>::const_iterator itr = list.begin(); itr != list.end(); ++itr)
+                        {
+                            if ((*itr)->Guid == guid)
+                            {
+                                (*itr)->Threat += threat;
+                                break;
+                            }
+                        }
+                    }
+
+                    list.sort(WoWSource::ThreatOrderPred());
+                    listChecksum += GUID_LOPART(list.front()->Guid);
+                }
+            }
+            uint32 listTime = GetMSTimeDiffToNow(oldMSTime);
+
+            seed = 1;
+            oldMSTime = getMSTime();
+            uint64 arrayChecksum = 0;
+            for (uint32 tick = 0; tick < ticks; ++tick)
+            {
+                for (uint32 add = 0; add < THREAT_BENCH_ADDS; ++add)
+                {
+                    std::vector<ThreatBenchEntry*>& array = arrays[add];
+                    std::vector<uint64>& arrayGuids = guids[add];
+                    for (uint32 i = 0; i < THREAT_BENCH_PLAYERS; ++i)
+                    {
+                        uint32 player;
+                        float threat = NextThreatBenchEvent(seed, player);
+                        uint64 guid = MAKE_NEW_GUID(player + 1, 0, HIGHGUID_PLAYER);
+                        for (size_t j = 0; j < arrayGuids.size(); ++j)
+                        {
+                            if (arrayGuids[j] == guid)
+                            {
+                                array[j]->Threat += threat;
+                                break;
+                            }
+                        }
+                    }
+
+                    if (WoWSource::RestoreThreatOrder(array))
+                        for (size_t j = 0; j < array.size(); ++j)
+                            arrayGuids[j] = array[j]->Guid;
+                    arrayChecksum += GUID_LOPART(array.front()->Guid);
+                }
+            }
+            uint32 arrayTime = GetMSTimeDiffToNow(oldMSTime);
+
+            for (std::vector<ThreatBenchEntry*>::const_iterator itr = entries.begin(); itr != entries.end(); ++itr)
+                delete *itr;
+
+            handler->PSendSysMessage("%u rounds of %u players against %u adds: sorted list %u ms, ordered array %u ms, top targets %s.",
+                ticks, uint32(THREAT_BENCH_PLAYERS), uint32(THREAT_BENCH_ADDS), listTime, arrayTime, listChecksum == arrayChecksum ? "identical" : "DIFFERENT");
+            return true;
+        }
+};
+
+void AddSC_bench_commandscript()
+{
+    new bench_commandscript();
+}
@@ -32,6 +32,8 @@ EndScriptData */
 #include "GridNotifiersImpl.h"
 #include "GossipDef.h"
 #include "MapManager.h"
+#include "GridPrefetcher.h"
+#include "MaintenanceMgr.h"
 
 #include <fstream>
 
@@ -69,6 +71,7 @@ class debug_commandscript : public CommandScript
                 { "setbit",         SEC_ADMINISTRATOR,  false, &HandleDebugSet32BitCommand,        "", NULL },
                 { "threat",         SEC_ADMINISTRATOR,  false, &HandleDebugThreatListCommand,      "", NULL },
                 { "hostil",         SEC_ADMINISTRATOR,  false, &HandleDebugHostileRefListCommand,  "", NULL },
+                { "auraqueue",      SEC_ADMINISTRATOR,  false, &HandleDebugAuraQueueCommand,       "", NULL },
                 { "anim",           SEC_GAMEMASTER,     false, &HandleDebugAnimCommand,            "", NULL },
                 { "arena",          SEC_ADMINISTRATOR,  false, &HandleDebugArenaCommand,           "", NULL },
                 { "bg",             SEC_ADMINISTRATOR,  false, &HandleDebugBattlegroundCommand,    "", NULL },
@@ -100,6 +103,10 @@ class debug_commandscript : public CommandScript
                 { "packet",         SEC_ADMINISTRATOR,  false, &HandleDebugPacketCommand,          "", NULL },
                 { "guildevent",     SEC_ADMINISTRATOR,  false, &HandleDebugGuildEventCommand,      "", NULL },
                 { "log",            SEC_ADMINISTRATOR,  false, &HandleDebugLogCommand,             "", NULL },
+                { "gridloads",      SEC_ADMINISTRATOR,  true,  &HandleDebugGridLoadsCommand,       "", NULL },
+                { "loginstats",     SEC_ADMINISTRATOR,  true,  &HandleDebugLoginStatsCommand,      "", NULL },
+                { "opcodestats",    SEC_ADMINISTRATOR,  true,  &HandleDebugOpcodeStatsCommand,     "", NULL },
+                { "maintenance",    SEC_ADMINISTRATOR,  true,  &HandleDebugMaintenanceCommand,     "", NULL },
                 { NULL,             SEC_PLAYER,         false, NULL,                               "", NULL }
             };
             static ChatCommand commandTable[] =
@@ -111,6 +118,91 @@ class debug_commandscript : public CommandScript
             return commandTable;
         }
 
+        // .debug gridloads
+        // Time map threads spent loading grids since startup, and how much of it the prefetcher saved them.
+        static bool HandleDebugGridLoadsCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            GridLoadStats stats = sGridPrefetcher->GetStats();
+
+            handler->PSendSysMessage("Terrain: %u grids loaded, %u of them prefetched, %u ms in total, %u ms on average, %u ms at most.",
+                stats.TerrainLoads, stats.TerrainPrefetched, stats.TerrainTime, stats.TerrainLoads ? stats.TerrainTime / stats.TerrainLoads : 0, stats.TerrainMaxTime);
+            handler->PSendSysMessage("Objects: %u grids loaded, %u ms in total, %u ms on average, %u ms at most.",
+                stats.ObjectLoads, stats.ObjectTime, stats.ObjectLoads ? stats.ObjectTime / stats.ObjectLoads : 0, stats.ObjectMaxTime);
+            handler->PSendSysMessage("Prefetcher: %u grids queued, %u read but never used.", stats.Requests, stats.Expired);
+            return true;
+        }
+
+        // .debug loginstats
+        // Average and worst time spent in each stage of a character login since startup.
+        static bool HandleDebugLoginStatsCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            static char const* stageNames[MAX_LOGIN_STAGES] = { "Queue", "Database", "Dispatch", "World", "Total" };
+
+            LoginLatencyStats stats = WorldSession::GetLoginLatencyStats();
+            handler->PSendSysMessage("%u character logins since startup.", stats.Logins);
+            if (!stats.Logins)
+                return true;
+
+            for (uint8 i = 0; i < MAX_LOGIN_STAGES; ++i)
+                handler->PSendSysMessage("%s: %u ms on average, %u ms at most.", stageNames[i], uint32(stats.TotalTime[i] / stats.Logins), stats.MaxTime[i]);
+            return true;
+        }
+
+        // .debug opcodestats [#count|reset]
+        // The #count opcodes the world thread spent the most time on since startup or the last reset, counting
+        // thread-unsafe handlers and the work map thread handlers posted to it.
+        static bool HandleDebugOpcodeStatsCommand(ChatHandler* handler, char const* args)
+        {
+            if (*args && !strcmp(args, "reset"))
+            {
+                WorldSession::ResetWorldThreadOpcodeStats();
+                handler->SendSysMessage("World thread opcode times cleared.");
+                return true;
+            }
+
+            uint32 count = *args ? uint32(atoi(args)) : 20;
+            if (!count)
+                return false;
+
+            WorldSession::OpcodeTimeStatsMap const& stats = WorldSession::GetWorldThreadOpcodeStats();
+
+            std::vector<std::pair<uint64, uint16> > byTime;
+            uint64 totalTime = 0;
+            for (WorldSession::OpcodeTimeStatsMap::const_iterator itr = stats.begin(); itr != stats.end(); ++itr)
+            {
+                byTime.push_back(std::make_pair(itr->second.TotalTime, itr->first));
+                totalTime += itr->second.TotalTime;
+            }
+
+            std::sort(byTime.begin(), byTime.end(), std::greater<std::pair<uint64, uint16> >());
+
+            handler->PSendSysMessage("World thread: %u opcodes handled, " UI64FMTD " ms in total.", uint32(byTime.size()), totalTime / 1000);
+            for (uint32 i = 0; i < count && i < byTime.size(); ++i)
+            {
+                OpcodeTimeStats const& opcode = stats.find(byTime[i].second)->second;
+                handler->PSendSysMessage("%s: %u packets, " UI64FMTD " ms in total, %u us on average, %u us at most.",
+                    GetOpcodeNameForLogging(Opcodes(byTime[i].second), WOW_CLIENT).c_str(), opcode.Count, opcode.TotalTime / 1000,
+                    uint32(opcode.TotalTime / opcode.Count), opcode.MaxTime);
+            }
+            return true;
+        }
+
+        // .debug maintenance
+        // Run time and backlog of the mail expiry, character deletion and corpse cleanup jobs.
+        static bool HandleDebugMaintenanceCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            for (uint32 i = 0; i < MAX_MAINTENANCE_JOBS; ++i)
+            {
+                MaintenanceJobType type = MaintenanceJobType(i);
+                MaintenanceJobStats const& stats = sMaintenanceMgr->GetStats(type);
+                handler->PSendSysMessage("%s: %s, %u entries left, %u runs (%u skipped), last run %u entries in %u ms.",
+                    sMaintenanceMgr->GetJobName(type), sMaintenanceMgr->IsRunning(type) ? "running" : "idle", stats.Backlog,
+                    stats.Runs, stats.Skipped, stats.LastProcessed, stats.LastRunTime);
+                handler->PSendSysMessage("    world thread: " UI64FMTD " ms in total, %u us at most in one update.", stats.WorldTime / 1000, stats.MaxTickTime);
+            }
+            return true;
+        }
+
         static bool HandleDebugLogCommand(ChatHandler* handler, char const* args)
         {
             if (!*args)
@@ -1122,8 +1214,8 @@ class debug_commandscript : public CommandScript
             if (!target || target->isTotem() || target->isPet())
                 return false;
 
-            std::list<HostileReference*>& threatList = target->getThreatManager().getThreatList();
-            std::list<HostileReference*>::iterator itr;
+            ThreatContainer::StorageType& threatList = target->getThreatManager().getThreatList();
+            ThreatContainer::StorageType::iterator itr;
             uint32 count = 0;
             handler->PSendSysMessage("Threat list of %s (guid %u)", target->GetName(), target->GetGUIDLow());
             for (itr = threatList.begin(); itr != threatList.end(); ++itr)
@@ -1138,6 +1230,22 @@ class debug_commandscript : public CommandScript
             return true;
         }
 
+        // .debug auraqueue
+        static bool HandleDebugAuraQueueCommand(ChatHandler* handler, char const* /*args*/)
+        {
+            Unit* target = handler->getSelectedUnit();
+            if (!target)
+                target = handler->GetSession()->GetPlayer();
+
+            AuraUpdateQueue const& queue = target->GetAuraUpdateQueue();
+            handler->PSendSysMessage("Aura updates of %s (guid %u): %u owned, %u ticking, %u sleeping", target->GetName(), target->GetGUIDLow(),
+                uint32(target->GetOwnedAuras().size()), queue.GetTickingCount(), queue.GetSleepingCount());
+
+            if (Aura const* next = queue.GetNextSleeping())
+                handler->PSendSysMessage("Next to wake up: spell %u in %u ms", next->GetId(), queue.GetTimeToNextWake());
+            return true;
+        }
+
         static bool HandleDebugHostileRefListCommand(ChatHandler* handler, char const* /*args*/)
         {
             Unit* target = handler->getSelectedUnit();
@@ -140,6 +140,7 @@ public:
 					handler->PSendSysMessage("Outdoor PVP diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_OUTDOORPVP));
 					handler->PSendSysMessage("LFG Mgr diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_LFG));
 					handler->PSendSysMessage("Callback diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_CALLBACK));
+					handler->PSendSysMessage("Maintenance diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_MAINTENANCE));
 				}
 			}
 		}
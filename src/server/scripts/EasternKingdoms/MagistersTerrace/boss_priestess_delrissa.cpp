@@ -835,8 +835,8 @@ public:
             if (Blink_Timer <= diff)
             {
                 bool InMeleeRange = false;
-                std::list<HostileReference*>& t_list = me->getThreatManager().getThreatList();
-                for (std::list<HostileReference*>::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
+                ThreatContainer::StorageType& t_list = me->getThreatManager().getThreatList();
+                for (ThreatContainer::StorageType::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
                 {
                     if (Unit* target = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
                     {
@@ -922,8 +922,8 @@ public:
             if (Intercept_Stun_Timer <= diff)
             {
                 bool InMeleeRange = false;
-                std::list<HostileReference*>& t_list = me->getThreatManager().getThreatList();
-                for (std::list<HostileReference*>::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
+                ThreatContainer::StorageType& t_list = me->getThreatManager().getThreatList();
+                for (ThreatContainer::StorageType::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
                 {
                     if (Unit* target = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
                     {
@@ -987,7 +987,7 @@ public:
             {
                 if (Creature* pPortal = DoSpawnCreature(CREATURE_FELFIRE_PORTAL, 0, 0, 0, 0, TEMPSUMMON_TIMED_DESPAWN, 20000))
                 {
-                    std::list<HostileReference*>::iterator itr;
+                    ThreatContainer::StorageType::iterator itr;
                     for (itr = me->getThreatManager().getThreatList().begin(); itr != me->getThreatManager().getThreatList().end(); ++itr)
                     {
                         Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid());
@@ -576,10 +576,11 @@ struct boss_faction_championsAI : public BossAI
 
     void UpdateThreat()
     {
-        std::list<HostileReference*> const& tList = me->getThreatManager().getThreatList();
-        for (std::list<HostileReference*>::const_iterator itr = tList.begin(); itr != tList.end(); ++itr)
+        // AddThreat can put a charmer on the list, walk a copy
+        std::vector<uint64> tList = me->getThreatManager().getThreatListGuids();
+        for (std::vector<uint64>::const_iterator itr = tList.begin(); itr != tList.end(); ++itr)
         {
-            Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid());
+            Unit* unit = Unit::GetUnit(*me, *itr);
             if (unit && me->getThreatManager().getThreat(unit))
             {
                 if (unit->GetTypeId() == TYPEID_PLAYER)
@@ -655,8 +656,8 @@ struct boss_faction_championsAI : public BossAI
 
     Unit* SelectEnemyCaster(bool /*casting*/)
     {
-        std::list<HostileReference*> const& tList = me->getThreatManager().getThreatList();
-        std::list<HostileReference*>::const_iterator iter;
+        ThreatContainer::StorageType const& tList = me->getThreatManager().getThreatList();
+        ThreatContainer::StorageType::const_iterator iter;
         Unit* target;
         for (iter = tList.begin(); iter!=tList.end(); ++iter)
         {
@@ -669,8 +670,8 @@ struct boss_faction_championsAI : public BossAI
 
     uint32 EnemiesInRange(float distance)
     {
-        std::list<HostileReference*> const& tList = me->getThreatManager().getThreatList();
-        std::list<HostileReference*>::const_iterator iter;
+        ThreatContainer::StorageType const& tList = me->getThreatManager().getThreatList();
+        ThreatContainer::StorageType::const_iterator iter;
         uint32 count = 0;
         Unit* target;
         for (iter = tList.begin(); iter != tList.end(); ++iter)
@@ -1891,10 +1891,11 @@ class spell_malygos_vortex_visual : public SpellScriptLoader
             {
                 if (Creature* caster = GetCaster()->ToCreature())
                 {
-                    const std::list<HostileReference*>& m_threatlist = caster->getThreatManager().getThreatList();
-                    for (std::list<HostileReference*>::const_iterator itr = m_threatlist.begin(); itr!= m_threatlist.end(); ++itr)
+                    // the vortex teleport can drop references, walk a copy
+                    std::vector<uint64> targets = caster->getThreatManager().getThreatListGuids();
+                    for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
                     {
-                        if (Unit* target = (*itr)->getTarget())
+                        if (Unit* target = ObjectAccessor::GetUnit(*caster, *itr))
                         {
                             Player* targetPlayer = target->ToPlayer();
                             if (!targetPlayer || targetPlayer->isGameMaster())
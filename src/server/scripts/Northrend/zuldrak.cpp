@@ -851,8 +851,8 @@ public:
             if (me->getVictim() && me->getVictim()->GetPositionZ() >= 286.276f)
             {
                 bool evadeMode = false;
-                std::list<HostileReference*> t_list = me->getThreatManager().getThreatList();
-                for (std::list<HostileReference*>::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
+                ThreatContainer::StorageType t_list = me->getThreatManager().getThreatList();
+                for (ThreatContainer::StorageType::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
                 {
                     if (Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
                     {
@@ -979,10 +979,10 @@ public:
             {
                 if (victim->GetPositionZ() >= 286.276f)
                 {
-                    std::list<HostileReference*> t_list = me->getThreatManager().getThreatList();
-                    for (std::list<HostileReference*>::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
+                    std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+                    for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
                     {
-                        if (Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
+                        if (Unit* unit = Unit::GetUnit(*me, *itr))
                         {
                             if (unit->GetPositionZ() <= 286.276f)
                             {
@@ -1128,10 +1128,10 @@ public:
 
             if (me->getVictim() && me->getVictim()->GetPositionZ() >= 286.276f)
             {
-                std::list<HostileReference*> t_list = me->getThreatManager().getThreatList();
-                for (std::list<HostileReference*>::const_iterator itr = t_list.begin(); itr!= t_list.end(); ++itr)
+                std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+                for (std::vector<uint64>::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
                 {
-                    if (Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid()))
+                    if (Unit* unit = Unit::GetUnit(*me, *itr))
                     {
                         if (unit->GetPositionZ() <= 286.276f)
                         {
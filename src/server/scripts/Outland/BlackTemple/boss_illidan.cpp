@@ -613,7 +613,7 @@ public:
 
         void DeleteFromThreatList(uint64 TargetGUID)
         {
-            for (std::list<HostileReference*>::const_iterator itr = me->getThreatManager().getThreatList().begin(); itr != me->getThreatManager().getThreatList().end(); ++itr)
+            for (ThreatContainer::StorageType::const_iterator itr = me->getThreatManager().getThreatList().begin(); itr != me->getThreatManager().getThreatList().end(); ++itr)
             {
                 if ((*itr)->getUnitGuid() == TargetGUID)
                 {
@@ -1488,9 +1488,9 @@ public:
 
         void KillAllElites()
         {
-            std::list<HostileReference*>& threatList = me->getThreatManager().getThreatList();
+            ThreatContainer::StorageType& threatList = me->getThreatManager().getThreatList();
             std::vector<Unit*> eliteList;
-            for (std::list<HostileReference*>::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
+            for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
             {
                 Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid());
                 if (unit && unit->GetEntry() == ILLIDARI_ELITE)
@@ -169,10 +169,10 @@ public:
 
         void CheckPlayers()
         {
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
+            ThreatContainer::StorageType& m_threatlist = me->getThreatManager().getThreatList();
             if (m_threatlist.empty())
                 return;                                         // No threat list. Don't continue.
-            std::list<HostileReference*>::const_iterator itr = m_threatlist.begin();
+            ThreatContainer::StorageType::const_iterator itr = m_threatlist.begin();
             std::list<Unit*> targets;
             for (; itr != m_threatlist.end(); ++itr)
             {
@@ -322,8 +322,8 @@ public:
             if (!Blossom)
                 return;
 
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
-            std::list<HostileReference*>::const_iterator i = m_threatlist.begin();
+            ThreatContainer::StorageType& m_threatlist = me->getThreatManager().getThreatList();
+            ThreatContainer::StorageType::const_iterator i = m_threatlist.begin();
             for (i = m_threatlist.begin(); i != m_threatlist.end(); ++i)
             {
                 Unit* unit = Unit::GetUnit(*me, (*i)->getUnitGuid());
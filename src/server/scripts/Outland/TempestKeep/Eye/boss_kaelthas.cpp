@@ -883,7 +883,9 @@ class boss_kaelthas : public CreatureScript
                             //GravityLapse_Timer
                             if (GravityLapse_Timer <= diff)
                             {
-                                std::list<HostileReference*>::const_iterator i = me->getThreatManager().getThreatList().begin();
+                                // teleports and knockbacks can drop references, walk a copy
+                                std::vector<uint64> targets = me->getThreatManager().getThreatListGuids();
+                                std::vector<uint64>::const_iterator i;
                                 switch (GravityLapse_Phase)
                                 {
                                     case 0:
@@ -894,9 +896,9 @@ class boss_kaelthas : public CreatureScript
                                         me->MonsterMoveWithSpeed(afGravityPos[0], afGravityPos[1], afGravityPos[2], 0);
 
                                         // 1) Kael'thas will portal the whole raid right into his body
-                                        for (i = me->getThreatManager().getThreatList().begin(); i!= me->getThreatManager().getThreatList().end(); ++i)
+                                        for (i = targets.begin(); i != targets.end(); ++i)
                                         {
-                                            Unit* unit = Unit::GetUnit(*me, (*i)->getUnitGuid());
+                                            Unit* unit = Unit::GetUnit(*me, *i);
                                             if (unit && (unit->GetTypeId() == TYPEID_PLAYER))
                                             {
                                                 //Use work around packet to prevent player from being dropped from combat
@@ -915,9 +917,9 @@ class boss_kaelthas : public CreatureScript
                                         DoScriptText(RAND(SAY_GRAVITYLAPSE1, SAY_GRAVITYLAPSE2), me);
 
                                         // 2) At that point he will put a Gravity Lapse debuff on everyone
-                                        for (i = me->getThreatManager().getThreatList().begin(); i != me->getThreatManager().getThreatList().end(); ++i)
+                                        for (i = targets.begin(); i != targets.end(); ++i)
                                         {
-                                            Unit* unit = Unit::GetUnit(*me, (*i)->getUnitGuid());
+                                            Unit* unit = Unit::GetUnit(*me, *i);
                                             if (unit && unit)
                                             {
                                                 DoCast(unit, SPELL_KNOCKBACK, true);
@@ -945,9 +947,9 @@ class boss_kaelthas : public CreatureScript
 
                                     case 3:
                                         //Remove flight
-                                        for (i = me->getThreatManager().getThreatList().begin(); i!= me->getThreatManager().getThreatList().end(); ++i)
+                                        for (i = targets.begin(); i != targets.end(); ++i)
                                         {
-                                            Unit* unit = Unit::GetUnit(*me, (*i)->getUnitGuid());
+                                            Unit* unit = Unit::GetUnit(*me, *i);
                                             if (unit && unit)
                                             {
                                                 if (unit->ToPlayer())
@@ -1281,8 +1283,8 @@ class boss_grand_astromancer_capernian : public CreatureScript
                 {
                     bool InMeleeRange = false;
                     Unit* target = NULL;
-                    std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
-                    for (std::list<HostileReference*>::const_iterator i = m_threatlist.begin(); i!= m_threatlist.end(); ++i)
+                    ThreatContainer::StorageType& m_threatlist = me->getThreatManager().getThreatList();
+                    for (ThreatContainer::StorageType::const_iterator i = m_threatlist.begin(); i!= m_threatlist.end(); ++i)
                     {
                         Unit* unit = Unit::GetUnit(*me, (*i)->getUnitGuid());
                                                                     //if in melee range
@@ -4960,8 +4960,8 @@ class npc_spectral_guise : public CreatureScript
                     me->CastSpell(me, SPELL_SPECTRAL_GUISE_CHARGES, true);
                     Aura::TryRefreshStackOrCreate(sSpellMgr->GetSpellInfo(SPELL_SPECTRAL_GUISE_STEALTH), MAX_EFFECT_MASK, owner, owner, sSpellMgr->GetSpellInfo(SPELL_SPECTRAL_GUISE_STEALTH)->spellPower);
 
-                    std::list<HostileReference*> threatList = owner->getThreatManager().getThreatList();
-                    for (std::list<HostileReference*>::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
+                    ThreatContainer::StorageType threatList = owner->getThreatManager().getThreatList();
+                    for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
                         if (Unit* unit = (*itr)->getTarget())
                             if (unit->GetTypeId() == TYPEID_UNIT)
                                 if (Creature* creature = unit->ToCreature())
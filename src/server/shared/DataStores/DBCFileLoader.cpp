@@ -27,64 +27,49 @@ DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), s
 
 bool DBCFileLoader::Load(const char* filename, const char* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = NULL;
-    }
+    Unload();
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // The file is mapped read-only instead of being read into a private buffer: AutoProduceData and
+    // AutoProduceStrings copy everything the store keeps, so the pages only stay in the page cache.
+    if (fileMap.map(filename, static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_PRIVATE) == -1)
         return false;
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    size_t fileSize = fileMap.size();
+    unsigned char* file = static_cast<unsigned char*>(fileMap.addr());
+    if (fileSize < 5 * sizeof(uint32))
     {
-        fclose(f);
+        Unload();
         return false;
     }
 
-
+    uint32 header;
+    memcpy(&header, file, 4);
     EndianConvert(header);
 
     if (header != 0x43424457)                                //'WDBC'
     {
-        fclose(f);
-        return false;
-    }
-
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
-    {
-        fclose(f);
+        Unload();
         return false;
     }
 
+    memcpy(&recordCount, file + 4, 4);                      // Number of records
     EndianConvert(recordCount);
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&fieldCount, file + 8, 4);                       // Number of fields
     EndianConvert(fieldCount);
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
-        return false;
-    }
-
+    memcpy(&recordSize, file + 12, 4);                      // Size of a record
     EndianConvert(recordSize);
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
+    memcpy(&stringSize, file + 16, 4);                      // String size
+    EndianConvert(stringSize);
+
+    if (fileSize - 5 * sizeof(uint32) < size_t(recordSize) * recordCount + stringSize)
     {
-        fclose(f);
+        Unload();
         return false;
     }
 
-    EndianConvert(stringSize);
-
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; ++i)
@@ -96,27 +81,25 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize*recordCount;
+    data = file + 5 * sizeof(uint32);
+    stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
+    return true;
+}
 
-    fclose(f);
+void DBCFileLoader::Unload()
+{
+    fileMap.close();
+    data = NULL;
+    stringTable = NULL;
 
-    return true;
+    delete [] fieldsOffset;
+    fieldsOffset = NULL;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    if (data)
-        delete [] data;
-
-    if (fieldsOffset)
-        delete [] fieldsOffset;
+    Unload();
 }
 
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
+#include <ace/Mem_Map.h>
 
 class DBCFileLoader
 {
@@ -29,6 +30,7 @@ class DBCFileLoader
         ~DBCFileLoader();
 
         bool Load(const char *filename, const char *fmt);
+        void Unload();
 
         class Record
         {
@@ -91,5 +93,6 @@ class DBCFileLoader
         uint32 *fieldsOffset;
         unsigned char *data;
         unsigned char *stringTable;
+        ACE_Mem_Map fileMap;
 };
 #endif
@@ -129,6 +129,12 @@ class DatabaseWorkerPool
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "All connections on DatabasePool '%s' closed.", GetDatabaseName());
         }
 
+        //! Number of synchronous connections, threads querying side by side each hold one.
+        uint8 GetSynchConnectionCount() const
+        {
+            return _connectionCount[IDX_SYNCH];
+        }
+
         /**
             Delayed one-way statement methods.
         */
@@ -337,6 +343,22 @@ class DatabaseWorkerPool
             return res;     //! Fool compiler, has no use yet
         }
 
+        //! Same as above, but the statements are split into up to 'parts' tasks (capped at the number of async
+        //! connections) which run in parallel. Each part takes the next statement not started yet, so the statements
+        //! must not depend on each other. The future is set when the last part has finished.
+        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, uint32 parts)
+        {
+            parts = std::min<uint32>(parts, std::min<uint32>(_connectionCount[IDX_ASYNC], uint32(holder->GetSize())));
+            if (parts <= 1)
+                return DelayQueryHolder(holder);
+
+            QueryResultHolderFuture res;
+            SQLQueryHolderSplit* split = new SQLQueryHolderSplit(parts);
+            for (uint32 i = 0; i < parts; ++i)
+                Enqueue(new SQLQueryHolderTask(holder, res, split, i));
+            return res;
+        }
+
         /**
             Transaction context methods.
         */
@@ -243,7 +243,7 @@ class Field
                     string = "";
                 return std::string(string, data.length);
             }
-            return std::string((char*)data.value);
+            return std::string((char*)data.value, data.length);
         }
 
         uint32 GetStringLength() const
@@ -253,7 +253,6 @@ class Field
 
     protected:
         Field();
-        ~Field();
 
         #if defined(__GNUC__)
         #pragma pack(1)
@@ -262,8 +261,8 @@ class Field
         #endif
         struct
         {
-            uint32 length;          // Length (prepared strings only)
-            void* value;            // Actual data in memory
+            uint32 length;          // Length (strings only)
+            void* value;            // Actual data in memory, owned by the result set
             enum_field_types type;  // Field type
             bool raw;               // Raw bytes? (Prepared statement or ad hoc)
          } data;
@@ -273,14 +272,8 @@ class Field
         #pragma pack(pop)
         #endif
 
-        void SetByteValue(void const* newValue, size_t const newSize, enum_field_types newType, uint32 length);
-        void SetStructuredValue(char* newValue, enum_field_types newType);
-
-        void CleanUp()
-        {
-            delete[] ((char*)data.value);
-            data.value = NULL;
-        }
+        void SetByteValue(void* newValue, enum_field_types newType, uint32 length);
+        void SetStructuredValue(char* newValue, enum_field_types newType, uint32 length);
 
         static size_t SizeForType(MYSQL_FIELD* field)
         {
@@ -19,6 +19,9 @@
 #include "QueryHolder.h"
 #include "PreparedStatement.h"
 #include "Log.h"
+#include "Timer.h"
+
+#include <ace/Guard_T.h>
 
 bool SQLQueryHolder::SetQuery(size_t index, const char *sql)
 {
@@ -165,8 +168,65 @@ void SQLQueryHolder::SetSize(size_t size)
     m_queries.resize(size);
 }
 
+bool SQLQueryHolderSplit::Start()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    return m_started++ == 0;
+}
+
+bool SQLQueryHolderSplit::Next(size_t& index, size_t count)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    if (m_next >= count)
+        return false;
+
+    index = m_next++;
+    return true;
+}
+
+bool SQLQueryHolderSplit::Finish()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    return --m_pending == 0;
+}
+
+bool SQLQueryHolderSplit::Release(bool& finished)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    finished = m_pending == 0;
+    return --m_alive == 0;
+}
+
+SQLQueryHolderTask::SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res)
+    : m_holder(holder), m_result(res), m_executed(false), m_split(NULL), m_part(0)
+{
+    if (m_holder)
+        m_holder->m_queuedTime = getMSTime();
+}
+
+SQLQueryHolderTask::SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res, SQLQueryHolderSplit* split, uint32 part)
+    : m_holder(holder), m_result(res), m_executed(false), m_split(split), m_part(part)
+{
+    // the other parts may already be running
+    if (m_holder && part == 0)
+        m_holder->m_queuedTime = getMSTime();
+}
+
 SQLQueryHolderTask::~SQLQueryHolderTask()
 {
+    if (m_split)
+    {
+        // the holder belongs to the future once every part ran, otherwise the last task frees it
+        bool finished;
+        if (m_split->Release(finished))
+        {
+            if (!finished)
+                delete m_holder;
+            delete m_split;
+        }
+        return;
+    }
+
     if (!m_executed)
         delete m_holder;
 }
@@ -177,34 +237,53 @@ bool SQLQueryHolderTask::Execute()
     if (!m_holder)
         return false;
 
-    /// we can do this, we are friends
-    std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
+    if (!m_split || m_split->Start())
+        m_holder->m_startTime = getMSTime();
 
-    for (size_t i = 0; i < queries.size(); i++)
+    size_t count = m_holder->m_queries.size();
+    if (m_split)
     {
-        /// execute all queries in the holder and pass the results
-        if (SQLElementData* data = &queries[i].first)
+        // a part stuck on a slow statement leaves the rest to the others
+        size_t index;
+        while (m_split->Next(index, count))
+            ExecuteStatement(index);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            ExecuteStatement(i);
+    }
+
+    // the other parts are still running
+    if (m_split && !m_split->Finish())
+        return true;
+
+    m_holder->m_readyTime = getMSTime();
+    m_result.set(m_holder);
+    return true;
+}
+
+void SQLQueryHolderTask::ExecuteStatement(size_t index)
+{
+    /// we can do this, we are friends
+    if (SQLElementData* data = &m_holder->m_queries[index].first)
+    {
+        switch (data->type)
         {
-            switch (data->type)
+            case SQL_ELEMENT_RAW:
             {
-                case SQL_ELEMENT_RAW:
-                {
-                    char const* sql = data->element.query;
-                    if (sql)
-                        m_holder->SetResult(i, m_conn->Query(sql));
-                    break;
-                }
-                case SQL_ELEMENT_PREPARED:
-                {
-                    PreparedStatement* stmt = data->element.stmt;
-                    if (stmt)
-                        m_holder->SetPreparedResult(i, m_conn->Query(stmt));
-                    break;
-                }
+                char const* sql = data->element.query;
+                if (sql)
+                    m_holder->SetResult(index, m_conn->Query(sql));
+                break;
+            }
+            case SQL_ELEMENT_PREPARED:
+            {
+                PreparedStatement* stmt = data->element.stmt;
+                if (stmt)
+                    m_holder->SetPreparedResult(index, m_conn->Query(stmt));
+                break;
             }
         }
     }
-
-    m_result.set(m_holder);
-    return true;
 }
@@ -19,6 +19,7 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <ace/Thread_Mutex.h>
 
 class SQLQueryHolder
 {
@@ -26,8 +27,13 @@ class SQLQueryHolder
     private:
         typedef std::pair<SQLElementData, SQLResultSetUnion> SQLResultPair;
         std::vector<SQLResultPair> m_queries;
+
+        // getMSTime() stamps of the trip through the async workers
+        uint32 m_queuedTime;
+        uint32 m_startTime;
+        uint32 m_readyTime;
     public:
-        SQLQueryHolder() {}
+        SQLQueryHolder() : m_queuedTime(0), m_startTime(0), m_readyTime(0) {}
         ~SQLQueryHolder();
         bool SetQuery(size_t index, const char *sql);
         bool SetPQuery(size_t index, const char *format, ...) ATTR_PRINTF(3, 4);
@@ -37,23 +43,53 @@ class SQLQueryHolder
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
         void SetPreparedResult(size_t index, PreparedResultSet* result);
+        size_t GetSize() const { return m_queries.size(); }
+
+        uint32 GetQueuedTime() const { return m_queuedTime; }
+        uint32 GetStartTime() const { return m_startTime; }     // first statement started
+        uint32 GetReadyTime() const { return m_readyTime; }     // last statement finished
 };
 
 typedef ACE_Future<SQLQueryHolder*> QueryResultHolderFuture;
 
+// Shared by the tasks a holder was split into, see DatabaseWorkerPool::DelayQueryHolder
+class SQLQueryHolderSplit
+{
+    public:
+        explicit SQLQueryHolderSplit(uint32 parts) : m_started(0), m_pending(parts), m_alive(parts), m_next(0) {}
+
+        bool Start();                                       // true for the first part to start
+        bool Next(size_t& index, size_t count);             // claims the next statement no part has started yet
+        bool Finish();                                      // true for the last part to finish
+        bool Release(bool& finished);                       // true for the last task destroyed
+
+    private:
+        ACE_Thread_Mutex m_lock;
+        uint32 m_started;
+        uint32 m_pending;
+        uint32 m_alive;
+        size_t m_next;
+};
+
 class SQLQueryHolderTask : public SQLOperation
 {
     private:
         SQLQueryHolder * m_holder;
         QueryResultHolderFuture m_result;
 		bool m_executed;
+        SQLQueryHolderSplit* m_split;                       // NULL if the holder runs as a single task
+        uint32 m_part;
 
     public:
-        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res)
-            : m_holder(holder), m_result(res), m_executed(false) {};
+        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res);
+        // executes the statements of the holder no other part has started, until none are left
+        SQLQueryHolderTask(SQLQueryHolder *holder, QueryResultHolderFuture res, SQLQueryHolderSplit* split, uint32 part);
         ~SQLQueryHolderTask();
         bool Execute();
 
+    private:
+        void ExecuteStatement(size_t index);
+
 };
 
 #endif
\ No newline at end of file
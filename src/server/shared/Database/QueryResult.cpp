@@ -19,6 +19,39 @@
 #include "DatabaseEnv.h"
 #include "Log.h"
 
+namespace
+{
+    // value of m_offsets for fields that point outside of the arena (NULL values)
+    size_t const NO_ARENA_OFFSET = size_t(-1);
+
+    char EmptyString[1] = { '\0' };
+
+    bool IsStringType(enum_field_types type)
+    {
+        switch (type)
+        {
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+            case MYSQL_TYPE_DECIMAL:
+            case MYSQL_TYPE_NEWDECIMAL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // fixed size values are aligned to their size so the getters can read them in place
+    size_t AlignOffset(size_t offset, size_t size)
+    {
+        size_t alignment = size >= 8 ? 8 : (size >= 4 ? 4 : (size >= 2 ? 2 : 1));
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+}
+
 ResultSet::ResultSet(MYSQL_RES *result, MYSQL_FIELD *fields, uint64 rowCount, uint32 fieldCount) :
 _rowCount(rowCount),
 _fieldCount(fieldCount),
@@ -30,12 +63,14 @@ _fields(fields)
 }
 
 PreparedResultSet::PreparedResultSet(MYSQL_STMT* stmt, MYSQL_RES *result, uint64 rowCount, uint32 fieldCount) :
+m_rows(NULL),
 m_rowCount(rowCount),
 m_rowPosition(0),
 m_fieldCount(fieldCount),
 m_rBind(NULL),
 m_stmt(stmt),
 m_res(result),
+m_bindBuffer(NULL),
 m_isNull(NULL),
 m_length(NULL)
 {
@@ -63,78 +98,83 @@ m_length(NULL)
         return;
     }
 
-    //- This is where we prepare the buffer based on metadata
-    uint32 i = 0;
-    MYSQL_FIELD* field = mysql_fetch_field(m_res);
-    while (field)
+    //- This is where we prepare the buffer based on metadata, one block shared by all columns
+    MYSQL_FIELD* fields = mysql_fetch_fields(m_res);
+    size_t bufferSize = 0;
+    size_t fixedRowSize = 0;
+    for (uint32 i = 0; i < m_fieldCount; ++i)
     {
-        size_t size = Field::SizeForType(field);
+        size_t size = Field::SizeForType(&fields[i]);
+        bufferSize = AlignOffset(bufferSize, size) + size;
+        if (!IsStringType(fields[i].type))
+            fixedRowSize = AlignOffset(fixedRowSize, size) + size;
+    }
+
+    m_bindBuffer = static_cast<char*>(malloc(bufferSize ? bufferSize : 1));
+    memset(m_bindBuffer, 0, bufferSize);
 
-        m_rBind[i].buffer_type = field->type;
-        m_rBind[i].buffer = malloc(size);
-        memset(m_rBind[i].buffer, 0, size);
+    size_t offset = 0;
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        size_t size = Field::SizeForType(&fields[i]);
+        offset = AlignOffset(offset, size);
+
+        m_rBind[i].buffer_type = fields[i].type;
+        m_rBind[i].buffer = m_bindBuffer + offset;
         m_rBind[i].buffer_length = size;
         m_rBind[i].length = &m_length[i];
         m_rBind[i].is_null = &m_isNull[i];
         m_rBind[i].error = NULL;
-        m_rBind[i].is_unsigned = field->flags & UNSIGNED_FLAG;
+        m_rBind[i].is_unsigned = fields[i].flags & UNSIGNED_FLAG;
 
-        ++i;
-        field = mysql_fetch_field(m_res);
+        offset += size;
     }
 
     //- This is where we bind the bind the buffer to the statement
     if (mysql_stmt_bind_result(m_stmt, m_rBind))
     {
         sLog->outWarn(LOG_FILTER_SQL, "%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+        FreeBindBuffer();
         delete[] m_rBind;
         delete[] m_isNull;
         delete[] m_length;
+        m_rBind = NULL;
+        m_rowCount = 0;
         return;
     }
 
     m_rowCount = mysql_stmt_num_rows(m_stmt);
+    m_rows = new Field[size_t(m_rowCount) * m_fieldCount];
+    m_offsets.resize(size_t(m_rowCount) * m_fieldCount);
+
+    // fixed size columns are known up front, strings grow the arena as they come
+    m_arena.reserve(size_t(m_rowCount) * AlignOffset(fixedRowSize, 8));
 
-    m_rows.resize(uint32(m_rowCount));
     while (_NextRow())
-    {
-        m_rows[uint32(m_rowPosition)] = new Field[m_fieldCount];
-        for (uint64 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
-        {
-            if (!*m_rBind[fIndex].is_null)
-                m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( m_rBind[fIndex].buffer,
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
-            else
-                switch (m_rBind[fIndex].buffer_type)
-                {
-                    case MYSQL_TYPE_TINY_BLOB:
-                    case MYSQL_TYPE_MEDIUM_BLOB:
-                    case MYSQL_TYPE_LONG_BLOB:
-                    case MYSQL_TYPE_BLOB:
-                    case MYSQL_TYPE_STRING:
-                    case MYSQL_TYPE_VAR_STRING:
-                    m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( "",
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
-                    break;
-                    default:
-                    m_rows[uint32(m_rowPosition)][fIndex].SetByteValue( 0,
-                                                            m_rBind[fIndex].buffer_length,
-                                                            m_rBind[fIndex].buffer_type,
-                                                           *m_rBind[fIndex].length );
-                }
-        }
-        m_rowPosition++;
-    }
-    m_rowPosition = 0;
+        StoreRow();
+
+    FinishRows();
 
     /// All data is buffered, let go of mysql c api structures
     CleanUp();
 }
 
+PreparedResultSet::PreparedResultSet(MYSQL_BIND* bind, uint64 rowCount, uint32 fieldCount) :
+m_rows(NULL),
+m_rowCount(rowCount),
+m_rowPosition(0),
+m_fieldCount(fieldCount),
+m_rBind(bind),
+m_stmt(NULL),
+m_res(NULL),
+m_bindBuffer(NULL),
+m_isNull(NULL),
+m_length(NULL)
+{
+    m_rows = new Field[size_t(m_rowCount) * m_fieldCount];
+    m_offsets.resize(size_t(m_rowCount) * m_fieldCount);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -142,8 +182,71 @@ ResultSet::~ResultSet()
 
 PreparedResultSet::~PreparedResultSet()
 {
-    for (uint32 i = 0; i < uint32(m_rowCount); ++i)
-        delete[] m_rows[i];
+    delete[] m_rows;
+}
+
+void PreparedResultSet::StoreRow()
+{
+    ASSERT(m_rowPosition < m_rowCount);
+
+    size_t index = size_t(m_rowPosition) * m_fieldCount;
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex, ++index)
+    {
+        MYSQL_BIND const& bind = m_rBind[fIndex];
+        enum_field_types type = bind.buffer_type;
+        uint32 length = uint32(*bind.length);
+
+        if (*bind.is_null)
+        {
+            m_offsets[index] = NO_ARENA_OFFSET;
+            m_rows[index].SetByteValue(IsStringType(type) ? EmptyString : NULL, type, 0);
+            continue;
+        }
+
+        size_t size = 0;
+        if (IsStringType(type))
+        {
+            // truncated values keep what fit in the bind buffer, terminator included
+            if (length >= bind.buffer_length)
+                length = bind.buffer_length ? uint32(bind.buffer_length - 1) : 0;
+            size = length + 1;
+        }
+        else
+            size = bind.buffer_length;
+
+        if (!size)
+        {
+            m_offsets[index] = NO_ARENA_OFFSET;
+            m_rows[index].SetByteValue(NULL, type, 0);
+            continue;
+        }
+
+        size_t offset = AlignOffset(m_arena.size(), size);
+        m_arena.resize(offset + size);
+        memcpy(&m_arena[offset], bind.buffer, size);
+        if (IsStringType(type))
+            m_arena[offset + length] = '\0';
+
+        m_offsets[index] = offset;
+        // the pointer is set by FinishRows(), the arena may still move
+        m_rows[index].SetByteValue(NULL, type, length);
+    }
+
+    ++m_rowPosition;
+}
+
+void PreparedResultSet::FinishRows()
+{
+    // rows the server did not send are dropped
+    m_rowCount = m_rowPosition;
+    m_rowPosition = 0;
+
+    size_t count = size_t(m_rowCount) * m_fieldCount;
+    for (size_t i = 0; i < count; ++i)
+        if (m_offsets[i] != NO_ARENA_OFFSET)
+            m_rows[i].data.value = &m_arena[m_offsets[i]];
+
+    std::vector<size_t>().swap(m_offsets);
 }
 
 bool ResultSet::NextRow()
@@ -160,8 +263,10 @@ bool ResultSet::NextRow()
         return false;
     }
 
+    // the fields point into the row buffered by mysql_store_result, valid until the next fetch
+    unsigned long* lengths = mysql_fetch_lengths(_result);
     for (uint32 i = 0; i < _fieldCount; i++)
-        _currentRow[i].SetStructuredValue(row[i], _fields[i].type);
+        _currentRow[i].SetStructuredValue(row[i], _fields[i].type, uint32(lengths[i]));
 
     return true;
 }
@@ -169,7 +274,7 @@ bool ResultSet::NextRow()
 bool PreparedResultSet::NextRow()
 {
     /// Only updates the m_rowPosition so upper level code knows in which element
-    /// of the rows vector to look
+    /// of the rows array to look
     if (++m_rowPosition >= m_rowCount)
         return false;
 
@@ -223,6 +328,6 @@ void PreparedResultSet::CleanUp()
 
 void PreparedResultSet::FreeBindBuffer()
 {
-    for (uint32 i = 0; i < m_fieldCount; ++i)
-        free (m_rBind[i].buffer);
+    free(m_bindBuffer);
+    m_bindBuffer = NULL;
 }
@@ -60,12 +60,21 @@ class ResultSet
 
 typedef WoWSource::AutoPtr<ResultSet, ACE_Thread_Mutex> QueryResult;
 
+/**
+ * Every value of a prepared result is copied into one contiguous arena, row after
+ * row, with fixed size values aligned to their size. The fields of all rows live in
+ * a single array of views into that arena, so buffering a result takes a handful of
+ * allocations however many rows and columns it has, and the typed getters read the
+ * binary values in place.
+ */
 class PreparedResultSet
 {
     public:
         PreparedResultSet(MYSQL_STMT* stmt, MYSQL_RES* result, uint64 rowCount, uint32 fieldCount);
         ~PreparedResultSet();
 
+        size_t GetDataSize() const { return m_arena.size(); }
+
         bool NextRow();
         uint64 GetRowCount() const { return m_rowCount; }
         uint32 GetFieldCount() const { return m_fieldCount; }
@@ -73,30 +82,44 @@ class PreparedResultSet
         Field* Fetch() const
         {
             ASSERT(m_rowPosition < m_rowCount);
-            return m_rows[uint32(m_rowPosition)];
+            return &m_rows[size_t(m_rowPosition) * m_fieldCount];
         }
 
         const Field & operator [] (uint32 index) const
         {
             ASSERT(m_rowPosition < m_rowCount);
             ASSERT(index < m_fieldCount);
-            return m_rows[uint32(m_rowPosition)][index];
+            return m_rows[size_t(m_rowPosition) * m_fieldCount + index];
         }
 
     protected:
-        std::vector<Field*> m_rows;
+        Field* m_rows;
+        std::vector<char> m_arena;
         uint64 m_rowCount;
         uint64 m_rowPosition;
         uint32 m_fieldCount;
 
     private:
+        // .bench resultset fills a result from its own bind buffers
+        friend class PreparedResultSetBench;
+
+        // Result filled by the caller through the given bind buffers, one StoreRow() per row, then FinishRows()
+        PreparedResultSet(MYSQL_BIND* bind, uint64 rowCount, uint32 fieldCount);
+
+        void StoreRow();
+        void FinishRows();
+
         MYSQL_BIND* m_rBind;
         MYSQL_STMT* m_stmt;
         MYSQL_RES* m_res;
+        char* m_bindBuffer;
 
         my_bool* m_isNull;
         unsigned long* m_length;
 
+        // arena offset of each stored value until FinishRows() turns them into pointers
+        std::vector<size_t> m_offsets;
+
         void FreeBindBuffer();
         void CleanUp();
         bool _NextRow();
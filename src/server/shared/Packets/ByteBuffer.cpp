@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ByteBuffer.h"
+
+#include <ace/TSS_T.h>
+
+class ByteBufferPool
+{
+    public:
+        ~ByteBufferPool()
+        {
+            for (uint8 i = 0; i < BYTEBUFFER_POOL_CLASSES; ++i)
+                for (std::vector<uint8*>::iterator itr = m_free[i].begin(); itr != m_free[i].end(); ++itr)
+                    delete[] *itr;
+        }
+
+        uint8* Allocate(size_t& size)
+        {
+            uint8 sizeClass = GetSizeClass(size);
+            if (sizeClass == BYTEBUFFER_POOL_CLASSES)
+            {
+                ++m_stats.HeapAllocations;
+                return new uint8[size];
+            }
+
+            size = size_t(BYTEBUFFER_POOL_MIN_BLOCK) << sizeClass;
+            if (m_free[sizeClass].empty())
+            {
+                ++m_stats.HeapAllocations;
+                return new uint8[size];
+            }
+
+            ++m_stats.PoolAllocations;
+            uint8* block = m_free[sizeClass].back();
+            m_free[sizeClass].pop_back();
+            return block;
+        }
+
+        void Free(uint8* block, size_t size)
+        {
+            // pooled blocks always have the exact size of their class
+            uint8 sizeClass = GetSizeClass(size);
+            if (sizeClass < BYTEBUFFER_POOL_CLASSES && (size_t(BYTEBUFFER_POOL_MIN_BLOCK) << sizeClass) == size &&
+                m_free[sizeClass].size() < std::max<size_t>(BYTEBUFFER_POOL_CLASS_BYTES / size, 4))
+            {
+                m_free[sizeClass].push_back(block);
+                return;
+            }
+
+            ++m_stats.HeapFrees;
+            delete[] block;
+        }
+
+        ByteBufferPoolStats const& GetStats() const { return m_stats; }
+
+    private:
+        // BYTEBUFFER_POOL_CLASSES if the size is too large to be pooled
+        static uint8 GetSizeClass(size_t size)
+        {
+            uint8 sizeClass = 0;
+            while (sizeClass < BYTEBUFFER_POOL_CLASSES && (size_t(BYTEBUFFER_POOL_MIN_BLOCK) << sizeClass) < size)
+                ++sizeClass;
+            return sizeClass;
+        }
+
+        std::vector<uint8*> m_free[BYTEBUFFER_POOL_CLASSES];
+        ByteBufferPoolStats m_stats;
+};
+
+// Never destroyed, buffers may still be freed while static objects are torn down
+typedef ACE_TSS<ByteBufferPool> ByteBufferPoolTSS;
+static ByteBufferPoolTSS* byteBufferPool = new ByteBufferPoolTSS();
+
+void ByteBufferStorage::Grow(size_t capacity)
+{
+    uint8* data = Allocate(capacity);
+    if (_size)
+        memcpy(data, _data, _size);
+
+    if (_data != _inline)
+        Free(_data, _capacity);
+
+    _data = data;
+    _capacity = capacity;
+}
+
+uint8* ByteBufferStorage::Allocate(size_t& size)
+{
+    if (ByteBufferPool* pool = *byteBufferPool)
+        return pool->Allocate(size);
+
+    return new uint8[size];
+}
+
+void ByteBufferStorage::Free(uint8* block, size_t size)
+{
+    if (ByteBufferPool* pool = *byteBufferPool)
+        pool->Free(block, size);
+    else
+        delete[] block;
+}
+
+ByteBufferPoolStats ByteBufferStorage::GetPoolStats()
+{
+    if (ByteBufferPool* pool = *byteBufferPool)
+        return pool->GetStats();
+
+    return ByteBufferPoolStats();
+}
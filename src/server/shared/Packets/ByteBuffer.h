@@ -145,15 +145,103 @@ class ByteBufferSourceException : public ByteBufferException
         }
 };
 
-class ByteBuffer
+// contents up to this size are stored inside the buffer itself
+#define BYTEBUFFER_INLINE_SIZE      96
+// larger contents use pooled blocks of 256 bytes to 64 KB, in powers of two
+#define BYTEBUFFER_POOL_MIN_BLOCK   256
+#define BYTEBUFFER_POOL_CLASSES     9
+// free blocks each thread keeps per size class, in bytes
+#define BYTEBUFFER_POOL_CLASS_BYTES (256 * 1024)
+
+struct ByteBufferPoolStats
+{
+    ByteBufferPoolStats() : HeapAllocations(0), PoolAllocations(0), HeapFrees(0) { }
+
+    uint64 HeapAllocations;                                 // blocks taken from the heap
+    uint64 PoolAllocations;                                 // blocks reused from the pool
+    uint64 HeapFrees;                                       // blocks given back to the heap
+};
+
+/**
+ * Storage of a ByteBuffer. Small contents live in the inline array, larger ones
+ * in blocks from a per thread pool, so building and dropping a packet normally
+ * does not reach the heap allocator. A block freed on another thread than the
+ * one that allocated it simply joins that thread's pool.
+ */
+class ByteBufferStorage
 {
     public:
-        const static size_t DEFAULT_SIZE = 0x1000;
+        ByteBufferStorage() : _data(_inline), _size(0), _capacity(BYTEBUFFER_INLINE_SIZE) { }
+
+        ByteBufferStorage(ByteBufferStorage const& other) : _data(_inline), _size(0), _capacity(BYTEBUFFER_INLINE_SIZE)
+        {
+            *this = other;
+        }
+
+        ~ByteBufferStorage()
+        {
+            if (_data != _inline)
+                Free(_data, _capacity);
+        }
+
+        ByteBufferStorage& operator=(ByteBufferStorage const& other)
+        {
+            if (this != &other)
+            {
+                _size = 0;
+                reserve(other._size);
+                if (other._size)
+                    memcpy(_data, other._data, other._size);
+                _size = other._size;
+            }
+            return *this;
+        }
+
+        uint8& operator[](size_t pos) { return _data[pos]; }
+        uint8 const& operator[](size_t pos) const { return _data[pos]; }
+
+        size_t size() const { return _size; }
+        size_t capacity() const { return _capacity; }
+        bool empty() const { return _size == 0; }
+
+        void clear() { _size = 0; }
+
+        void reserve(size_t capacity)
+        {
+            if (capacity > _capacity)
+                Grow(capacity);
+        }
+
+        void resize(size_t size, uint8 value = 0)
+        {
+            if (size > _capacity)
+                Grow(std::max(size, _capacity * 2));
+            if (size > _size)
+                memset(_data + _size, value, size - _size);
+            _size = size;
+        }
 
+        // counters of the calling thread's pool
+        static ByteBufferPoolStats GetPoolStats();
+
+    private:
+        void Grow(size_t capacity);
+
+        static uint8* Allocate(size_t& size);
+        static void Free(uint8* block, size_t size);
+
+        uint8* _data;
+        size_t _size;
+        size_t _capacity;
+        uint8 _inline[BYTEBUFFER_INLINE_SIZE];
+};
+
+class ByteBuffer
+{
+    public:
         // constructor
         ByteBuffer() : _rpos(0), _wpos(0), _bitpos(8), _curbitval(0)
         {
-            _storage.reserve(DEFAULT_SIZE);
         }
 
         ByteBuffer(size_t reserve) : _rpos(0), _wpos(0), _bitpos(8), _curbitval(0)
@@ -199,8 +287,12 @@ class ByteBuffer
 
         void WriteBitInOrder(ObjectGuid guid, uint8 order[8])
         {
+            uint8 mask = 0;
             for (uint8 i = 0; i < 8; ++i)
-                WriteBit(guid[order[i]]);
+                if (guid[order[i]])
+                    mask |= 1 << (7 - i);
+
+            WriteBits(mask, 8);
         }
 
         bool WriteBit(uint32 bit)
@@ -237,18 +329,52 @@ class ByteBuffer
             return ((_curbitval >> (7-_bitpos)) & 1) != 0;
         }
 
+        // Same as calling WriteBit for each bit from the highest, but fills the pending byte a chunk at a time
         template <typename T> void WriteBits(T value, size_t bits)
         {
-            for (int32 i = bits-1; i >= 0; --i)
-                WriteBit((value >> i) & 1);
+            uint64 v = uint64(value);
+            while (bits)
+            {
+                size_t count = std::min<size_t>(bits, _bitpos);
+                bits -= count;
+
+                _bitpos -= count;
+                _curbitval |= uint8(((v >> bits) & ((1 << count) - 1)) << _bitpos);
+
+                if (_bitpos == 0)
+                {
+                    _bitpos = 8;
+                    append((uint8 *)&_curbitval, sizeof(_curbitval));
+                    _curbitval = 0;
+                }
+            }
         }
 
+        // Same as calling ReadBit for each bit, reads the current byte a chunk at a time
         uint32 ReadBits(size_t bits)
         {
             uint32 value = 0;
-            for (int32 i = bits-1; i >= 0; --i)
-                if (ReadBit())
-                    value |= (1 << (i));
+            while (bits)
+            {
+                size_t count;
+                if (_bitpos >= 7)
+                {
+                    // current byte used up (or none read yet)
+                    _curbitval = read<uint8>();
+                    count = std::min<size_t>(bits, 8);
+                    value = (value << count) | (_curbitval >> (8 - count));
+                    _bitpos = count - 1;
+                }
+                else
+                {
+                    size_t left = 7 - _bitpos;
+                    count = std::min<size_t>(bits, left);
+                    value = (value << count) | ((_curbitval >> (left - count)) & ((1 << count) - 1));
+                    _bitpos += count;
+                }
+
+                bits -= count;
+            }
 
             return value;
         }
@@ -626,8 +752,9 @@ class ByteBuffer
 
         void append(const uint8 *src, size_t cnt)
         {
+            // nothing to write, e.g. an empty string or a buffer that was never filled
             if (!cnt)
-                throw ByteBufferSourceException(_wpos, size(), cnt);
+                return;
 
             if (!src)
                 throw ByteBufferSourceException(_wpos, size(), cnt);
@@ -757,7 +884,7 @@ class ByteBuffer
     protected:
         size_t _rpos, _wpos, _bitpos;
         uint8 _curbitval;
-        std::vector<uint8> _storage;
+        ByteBufferStorage _storage;
 };
 
 template <typename T>
@@ -34,6 +34,12 @@ int DelayExecutor::deactivate()
     queue_.queue()->deactivate();
     wait();
 
+    // the workers stopped at the deactivated queue, requests still in it would never run nor be freed
+    queue_.queue()->activate();
+    while (ACE_Method_Request* rq = queue_.dequeue((ACE_Time_Value*)&ACE_Time_Value::zero))
+        delete rq;
+    queue_.queue()->deactivate();
+
     return 0;
 }
 
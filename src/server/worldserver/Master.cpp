@@ -26,6 +26,7 @@
 #include "SystemConfig.h"
 #include "SignalHandler.h"
 #include "World.h"
+#include "WorldLoader.h"
 #include "WorldRunnable.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -369,6 +370,8 @@ bool Master::_StartDB()
     }
 
     synch_threads = ConfigMgr::GetIntDefault("WorldDatabase.SynchThreads", 1);
+    // every startup loader thread runs its queries on a synch connection of its own
+    synch_threads = std::max<uint32>(synch_threads, std::min<uint32>(WorldLoader::GetConfiguredThreads(), 32));
     ///- Initialise the world database
     if (!WorldDatabase.Open(dbstring, async_threads, synch_threads))
     {
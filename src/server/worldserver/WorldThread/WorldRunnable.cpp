@@ -31,6 +31,9 @@
 #include "Timer.h"
 #include "WorldRunnable.h"
 #include "OutdoorPvPMgr.h"
+#include "GuildMgr.h"
+#include "ChannelFanout.h"
+#include "LFGMgr.h"
 
 #define WORLD_SLEEP_CONST 25
 
@@ -86,9 +89,14 @@ void WorldRunnable::run()
     sWorld->KickAll();                                       // save and kick all players
     sWorld->UpdateSessions( 1 );                             // real players unload required UpdateSessions call
 
+    sGuildMgr->SaveAllGuilds();                              // pending guild experience and achievements
+
     // unload battleground templates before different singletons destroyed
     sBattlegroundMgr->DeleteAllBattlegrounds();
 
+    sChannelFanout->Unload();                                // last channel messages go out before the network stops
+    sLFGMgr->Unload();                                       // stop the dungeon matcher thread
+
     sWorldSocketMgr->StopNetwork();
 
     sMapMgr->UnloadAll();                     // unload all grids (including locked in memory)
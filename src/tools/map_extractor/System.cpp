@@ -22,7 +22,17 @@
 #include <stdio.h>
 #include <deque>
 #include <list>
+#include <map>
+#include <vector>
+#include <string>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <mutex>
+#include <atomic>
 
 #ifdef _WIN32
 #include "direct.h"
@@ -49,6 +59,11 @@
     #include <io.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define EXTRACTOR_SSE2
+#endif
+
 #ifdef O_LARGEFILE
     #define OPEN_FLAGS (O_RDONLY | O_BINARY | O_LARGEFILE)
 #else
@@ -67,6 +82,7 @@ typedef struct
 map_id *map_ids;
 uint16 *areas;
 uint16 *LiqType;
+size_t LiqTypeMaxId = 0;
 char output_path[128] = ".";
 char input_path[128] = ".";
 uint32 maxAreaId = 0;
@@ -96,6 +112,19 @@ float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - l
 
 uint32 CONF_TargetBuild = 17399;              // 5.4.0 17399
 
+// ADT files are converted on this many threads, each with its own MPQ handles
+uint32 CONF_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+// Skip tiles whose ADT data and conversion settings did not change since the last extraction
+bool CONF_incremental = false;
+
+// Run every SSE2 helper next to its scalar loop and report differences
+bool CONF_simd_check = false;
+std::atomic<uint32> SimdCheckMismatches(0);
+
+// Hashes of the ADT sources of the last extraction, see ExtractMapsFromMpq
+#define ADT_HASHES_FILE "adt_hashes.txt"
+
 // List MPQ for extract maps from
 char const* CONF_mpq_list[] =
 {
@@ -168,7 +197,10 @@ void Usage(char const* prg)
         "-e extract only MAP(1)/DBC(2) - standard: both(3)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
         "-b target build (default %u)\n"\
-        "Example: %s -f 0 -i \"c:\\games\\game\"", prg, CONF_TargetBuild, prg);
+        "-t number of threads converting map tiles (default %u)\n"\
+        "-u only convert map tiles whose source changed since the last extraction 0 by default\n"\
+        "-c compare the SSE2 map conversion against the scalar code, fails on any difference 0 by default\n"\
+        "Example: %s -f 0 -i \"c:\\games\\game\"", prg, CONF_TargetBuild, CONF_threads, prg);
     exit(1);
 }
 
@@ -182,6 +214,9 @@ void HandleArgs(int argc, char* arg[])
         // f - use float to int conversion
         // h - limit minimum height
         // b - target client build
+        // t - threads converting map tiles
+        // u - only convert changed map tiles
+        // c - check SSE2 helpers against the scalar loops
         if (arg[c][0] != '-')
             Usage(arg[0]);
 
@@ -221,6 +256,24 @@ void HandleArgs(int argc, char* arg[])
                 else
                     Usage(arg[0]);
                 break;
+            case 't':
+                if (c + 1 < argc && atoi(arg[c + 1]) > 0)    // all ok
+                    CONF_threads = atoi(arg[c++ + 1]);
+                else
+                    Usage(arg[0]);
+                break;
+            case 'u':
+                if (c + 1 < argc)                            // all ok
+                    CONF_incremental = atoi(arg[c++ + 1]) != 0;
+                else
+                    Usage(arg[0]);
+                break;
+            case 'c':
+                if (c + 1 < argc)                            // all ok
+                    CONF_simd_check = atoi(arg[c++ + 1]) != 0;
+                else
+                    Usage(arg[0]);
+                break;
             default:
                 break;
         }
@@ -324,6 +377,7 @@ void ReadAreaTableDBC()
     size_t area_count = dbc.getRecordCount();
     maxAreaId = dbc.getMaxId();
     areas = new uint16[maxAreaId + 1];
+    memset(areas, 0, (maxAreaId + 1) * sizeof(uint16));     // ids missing from the dbc, also hashed for -u
 
     for (uint32 x = 0; x < area_count; ++x)
         areas[dbc.getRecord(x).getUInt(0)] = dbc.getRecord(x).getUInt(3);
@@ -370,6 +424,7 @@ void ReadLiquidTypeTableDBC()
     size_t LiqType_count = dbc.getRecordCount();
     size_t LiqType_maxid = dbc.getMaxId();
     LiqType = new uint16[LiqType_maxid + 1];
+    LiqTypeMaxId = LiqType_maxid;
     memset(LiqType, 0xff, (LiqType_maxid + 1) * sizeof(uint16));
 
     for (uint32 x = 0; x < LiqType_count; ++x)
@@ -459,28 +514,272 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-
-bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/, uint32 build)
+
+// The helpers below give the same results as checking the values one by one in order,
+// four at a time where SSE2 is available. With -c every call also runs the scalar loop
+// and compares both results byte for byte, see CheckSameBytes.
+
+void GetHeightRangeScalar(float const* heights, uint32 count, float& minHeight, float& maxHeight)
 {
-    ADT_file adt;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        float h = heights[i];
+        if (maxHeight < h) maxHeight = h;
+        if (minHeight > h) minHeight = h;
+    }
+}
 
-    if (!adt.loadFile(WorldMpq, filename))
-        return false;
+void LimitMinHeightScalar(float* heights, uint32 count, float limit)
+{
+    for (uint32 i = 0; i < count; ++i)
+        if (heights[i] < limit)
+            heights[i] = limit;
+}
+
+template<typename T>
+void PackHeightsScalar(float const* heights, T* packed, uint32 count, float minHeight, float step)
+{
+    for (uint32 i = 0; i < count; ++i)
+        packed[i] = T((heights[i] - minHeight) * step + 0.5f);
+}
+
+bool HasLiquidScalar(bool const* show, uint32 count)
+{
+    for (uint32 i = 0; i < count; ++i)
+        if (show[i])
+            return true;
+    return false;
+}
+
+void GetHeightRangeSimd(float const* heights, uint32 count, float& minHeight, float& maxHeight)
+{
+    uint32 i = 0;
+
+#ifdef EXTRACTOR_SSE2
+    if (count >= 4)
+    {
+        float startMin = minHeight;
+        float startMax = maxHeight;
+
+        // a NaN height keeps the current value, like the scalar comparison
+        __m128 vMin = _mm_set1_ps(minHeight);
+        __m128 vMax = _mm_set1_ps(maxHeight);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 h = _mm_loadu_ps(heights + i);
+            vMin = _mm_min_ps(h, vMin);
+            vMax = _mm_max_ps(h, vMax);
+        }
+
+        float mins[4], maxs[4];
+        _mm_storeu_ps(mins, vMin);
+        _mm_storeu_ps(maxs, vMax);
+        for (uint32 j = 0; j < 4; ++j)
+        {
+            if (minHeight > mins[j]) minHeight = mins[j];
+            if (maxHeight < maxs[j]) maxHeight = maxs[j];
+        }
+
+        // -0 and +0 compare equal, only the one found first in order may be kept
+        if (minHeight == 0.0f || maxHeight == 0.0f)
+        {
+            minHeight = startMin;
+            maxHeight = startMax;
+            i = 0;
+        }
+    }
+#endif
+
+    GetHeightRangeScalar(heights + i, count - i, minHeight, maxHeight);
+}
+
+void LimitMinHeightSimd(float* heights, uint32 count, float limit)
+{
+    uint32 i = 0;
+#ifdef EXTRACTOR_SSE2
+    // max_ps returns its second operand for equal and NaN values, which then stay as they are
+    __m128 vLimit = _mm_set1_ps(limit);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(heights + i, _mm_max_ps(vLimit, _mm_loadu_ps(heights + i)));
+#endif
+    LimitMinHeightScalar(heights + i, count - i, limit);
+}
+
+template<typename T>
+void PackHeightsSimd(float const* heights, T* packed, uint32 count, float minHeight, float step)
+{
+    uint32 i = 0;
+#ifdef EXTRACTOR_SSE2
+    __m128 vMin = _mm_set1_ps(minHeight);
+    __m128 vStep = _mm_set1_ps(step);
+    __m128 vHalf = _mm_set1_ps(0.5f);
+    int32 values[4];
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 h = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(heights + i), vMin), vStep), vHalf);
+        _mm_storeu_si128((__m128i*)values, _mm_cvttps_epi32(h));
+        for (uint32 j = 0; j < 4; ++j)
+            packed[i + j] = T(values[j]);
+    }
+#endif
+    PackHeightsScalar(heights + i, packed + i, count - i, minHeight, step);
+}
+
+bool HasLiquidSimd(bool const* show, uint32 count)
+{
+    uint32 i = 0;
+#ifdef EXTRACTOR_SSE2
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i const*)(show + i)), zero)) != 0xFFFF)
+            return true;
+#endif
+    return HasLiquidScalar(show + i, count - i);
+}
+
+void CheckSameBytes(char const* helper, void const* simd, void const* scalar, size_t size)
+{
+    if (memcmp(simd, scalar, size) == 0)
+        return;
+
+    ++SimdCheckMismatches;
+    printf("\n%s: SSE2 and scalar results differ\n", helper);
+}
+
+void GetHeightRange(float const* heights, uint32 count, float& minHeight, float& maxHeight)
+{
+    float range[2] = { minHeight, maxHeight };
+    GetHeightRangeSimd(heights, count, minHeight, maxHeight);
+    if (!CONF_simd_check)
+        return;
+
+    GetHeightRangeScalar(heights, count, range[0], range[1]);
+    float simdRange[2] = { minHeight, maxHeight };
+    CheckSameBytes("GetHeightRange", simdRange, range, sizeof(range));
+}
+
+void LimitMinHeight(float* heights, uint32 count, float limit)
+{
+    if (!CONF_simd_check)
+    {
+        LimitMinHeightSimd(heights, count, limit);
+        return;
+    }
 
+    std::vector<float> scalar(heights, heights + count);
+    LimitMinHeightSimd(heights, count, limit);
+    LimitMinHeightScalar(scalar.data(), count, limit);
+    CheckSameBytes("LimitMinHeight", heights, scalar.data(), count * sizeof(float));
+}
+
+template<typename T>
+void PackHeights(float const* heights, T* packed, uint32 count, float minHeight, float step)
+{
+    PackHeightsSimd(heights, packed, count, minHeight, step);
+    if (!CONF_simd_check)
+        return;
+
+    std::vector<T> scalar(count);
+    PackHeightsScalar(heights, scalar.data(), count, minHeight, step);
+    CheckSameBytes("PackHeights", packed, scalar.data(), count * sizeof(T));
+}
+
+bool HasLiquid(bool const* show, uint32 count)
+{
+    bool result = HasLiquidSimd(show, count);
+    if (CONF_simd_check)
+    {
+        bool scalar = HasLiquidScalar(show, count);
+        CheckSameBytes("HasLiquid", &result, &scalar, sizeof(bool));
+    }
+    return result;
+}
+
+// Runs the helpers on generated input with the values the SSE2 paths treat specially
+// (NaN, -0/+0, infinities, the height limit) at every position of the 4 and 16 wide blocks
+bool RunSimdSelfCheck()
+{
+    printf("Checking SSE2 helpers against the scalar loops...\n");
+
+    uint32 seed = 1;
+    float const special[] = { 0.0f, -0.0f, CONF_use_minHeight, std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+    uint32 const specialCount = sizeof(special) / sizeof(special[0]);
+    uint32 const sizes[] = { 0, 1, 3, 4, 5, 7, 8, 15, 16, 17, 31, 33, ADT_GRID_SIZE, ADT_GRID_SIZE * ADT_GRID_SIZE, (ADT_GRID_SIZE + 1) * (ADT_GRID_SIZE + 1) };
+
+    SimdCheckMismatches = 0;
+    for (uint32 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        uint32 count = sizes[s];
+        for (uint32 round = 0; round < 64; ++round)
+        {
+            std::vector<float> heights(count);
+            std::vector<float> finite(count);
+            std::vector<char> show(count);
+            for (uint32 i = 0; i < count; ++i)
+            {
+                seed = seed * 1103515245 + 12345;
+                finite[i] = float(int32(seed >> 8) % 400000) / 100.0f - 2000.0f;
+                heights[i] = (seed >> 4) % 8 == 0 ? special[(seed >> 12) % specialCount] : finite[i];
+                show[i] = (seed >> 16) % (round + 2) == 0;
+
+                // zeros of both signs as the lowest and highest value, only the first one found may be kept
+                if (round % 4 == 1)
+                    heights[i] = (seed >> 20) % 2 ? -0.0f : 0.0f;
+                else if (round % 4 == 2)
+                    heights[i] = (seed >> 20) % 3 == 0 ? -0.0f : (seed >> 20) % 3 == 1 ? 0.0f : fabs(finite[i]) + 1.0f;
+            }
+
+            float minHeight = 20000.0f, maxHeight = -20000.0f;
+            GetHeightRange(heights.data(), count, minHeight, maxHeight);
+            LimitMinHeight(heights.data(), count, CONF_use_minHeight);
+            HasLiquid((bool const*)show.data(), count);
+
+            // packing only sees heights inside the range it was given
+            minHeight = 20000.0f;
+            maxHeight = -20000.0f;
+            GetHeightRange(finite.data(), count, minHeight, maxHeight);
+            float diff = maxHeight - minHeight;
+            if (count == 0 || diff <= 0.0f)
+                continue;
+
+            std::vector<uint8> packed8(count);
+            std::vector<uint16> packed16(count);
+            PackHeights(finite.data(), packed8.data(), count, minHeight, selectUInt8StepStore(diff));
+            PackHeights(finite.data(), packed16.data(), count, minHeight, selectUInt16StepStore(diff));
+        }
+    }
+
+    printf("%u mismatch(es)\n", uint32(SimdCheckMismatches));
+    return SimdCheckMismatches == 0;
+}
+
+// Converts ADT files to .map files. Holds the temporary grid data store, so every
+// thread converting tiles needs its own.
+class ADTConverter
+{
+    public:
+        bool ConvertADT(ADT_file& adt, char const* filename, char const* filename2, uint32 build);
+
+    private:
+        // Temporary grid data store
+        uint16 area_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+        float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+        float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+        uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+        uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+        uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+        uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+
+        uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+        uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+        bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+        float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+};
+
+bool ADTConverter::ConvertADT(ADT_file& adt, char const* filename, char const* filename2, uint32 build)
+{
     memset(liquid_show, 0, sizeof(liquid_show));
     memset(liquid_flags, 0, sizeof(liquid_flags));
     memset(liquid_entry, 0, sizeof(liquid_entry));
@@ -628,36 +927,14 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
     //============================================
     float maxHeight = -20000;
     float minHeight =  20000;
-    for (int y = 0; y < ADT_GRID_SIZE; y++)
-    {
-        for(int x = 0; x < ADT_GRID_SIZE; x++)
-        {
-            float h = V8[y][x];
-            if (maxHeight < h) maxHeight = h;
-            if (minHeight > h) minHeight = h;
-        }
-    }
-    for (int y = 0; y <= ADT_GRID_SIZE; y++)
-    {
-        for (int x = 0; x <= ADT_GRID_SIZE; x++)
-        {
-            float h = V9[y][x];
-            if (maxHeight < h) maxHeight = h;
-            if (minHeight > h) minHeight = h;
-        }
-    }
+    GetHeightRange(&V8[0][0], ADT_GRID_SIZE * ADT_GRID_SIZE, minHeight, maxHeight);
+    GetHeightRange(&V9[0][0], (ADT_GRID_SIZE + 1) * (ADT_GRID_SIZE + 1), minHeight, maxHeight);
 
     // Check for allow limit minimum height (not store height in deep ochean - allow save some memory)
     if (CONF_allow_height_limit && minHeight < CONF_use_minHeight)
     {
-        for (int y = 0; y < ADT_GRID_SIZE; y++)
-            for (int x = 0; x < ADT_GRID_SIZE; x++)
-                if (V8[y][x] < CONF_use_minHeight)
-                    V8[y][x] = CONF_use_minHeight;
-        for (int y = 0; y <= ADT_GRID_SIZE; y++)
-            for (int x = 0; x <= ADT_GRID_SIZE; x++)
-                if (V9[y][x] < CONF_use_minHeight)
-                    V9[y][x] = CONF_use_minHeight;
+        LimitMinHeight(&V8[0][0], ADT_GRID_SIZE * ADT_GRID_SIZE, CONF_use_minHeight);
+        LimitMinHeight(&V9[0][0], (ADT_GRID_SIZE + 1) * (ADT_GRID_SIZE + 1), CONF_use_minHeight);
         if (minHeight < CONF_use_minHeight)
             minHeight = CONF_use_minHeight;
         if (maxHeight < CONF_use_minHeight)
@@ -703,22 +980,14 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
         // Pack it to int values if need
         if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
         {
-            for (int y = 0; y < ADT_GRID_SIZE; y++)
-                for(int x = 0; x < ADT_GRID_SIZE; x++)
-                    uint8_V8[y][x] = uint8((V8[y][x] - minHeight) * step + 0.5f);
-            for (int y = 0; y <= ADT_GRID_SIZE; y++)
-                for(int x = 0; x <= ADT_GRID_SIZE; x++)
-                    uint8_V9[y][x] = uint8((V9[y][x] - minHeight) * step + 0.5f);
+            PackHeights(&V8[0][0], &uint8_V8[0][0], ADT_GRID_SIZE * ADT_GRID_SIZE, minHeight, step);
+            PackHeights(&V9[0][0], &uint8_V9[0][0], (ADT_GRID_SIZE + 1) * (ADT_GRID_SIZE + 1), minHeight, step);
             map.heightMapSize += sizeof(uint8_V9) + sizeof(uint8_V8);
         }
         else if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
         {
-            for (int y = 0; y < ADT_GRID_SIZE; y++)
-                for(int x = 0; x < ADT_GRID_SIZE; x++)
-                    uint16_V8[y][x] = uint16((V8[y][x] - minHeight) * step + 0.5f);
-            for (int y = 0; y <= ADT_GRID_SIZE; y++)
-                for(int x = 0; x <= ADT_GRID_SIZE; x++)
-                    uint16_V9[y][x] = uint16((V9[y][x] - minHeight) * step + 0.5f);
+            PackHeights(&V8[0][0], &uint16_V8[0][0], ADT_GRID_SIZE * ADT_GRID_SIZE, minHeight, step);
+            PackHeights(&V9[0][0], &uint16_V9[0][0], (ADT_GRID_SIZE + 1) * (ADT_GRID_SIZE + 1), minHeight, step);
             map.heightMapSize += sizeof(uint16_V9) + sizeof(uint16_V8);
         }
         else
@@ -894,6 +1163,13 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
         minHeight = 20000;
         for (int y = 0; y < ADT_GRID_SIZE; y++)
         {
+            // most rows are either dry or hold the liquid of a whole cell
+            if (!HasLiquid(liquid_show[y], ADT_GRID_SIZE))
+            {
+                std::fill_n(liquid_height[y], ADT_GRID_SIZE, CONF_use_minHeight);
+                continue;
+            }
+
             for (int x = 0; x < ADT_GRID_SIZE; x++)
             {
                 if (liquid_show[y][x])
@@ -1029,11 +1305,158 @@ bool ConvertADT(char *filename, char *filename2, int /*cell_y*/, int /*cell_x*/,
     return true;
 }
 
+bool LoadCommonMPQFiles(HANDLE& mpq, bool log);
+
+uint64 HashBytes(uint64 hash, void const* data, size_t size)
+{
+    // FNV-1a
+    uint8 const* bytes = (uint8 const*)data;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    return hash;
+}
+
+// Everything besides the ADT itself that ends up in a .map file
+uint64 HashConvertSettings(uint32 build)
+{
+    uint64 hash = 0xCBF29CE484222325ULL;
+    hash = HashBytes(hash, &build, sizeof(build));
+    hash = HashBytes(hash, &CONF_allow_height_limit, sizeof(CONF_allow_height_limit));
+    hash = HashBytes(hash, &CONF_use_minHeight, sizeof(CONF_use_minHeight));
+    hash = HashBytes(hash, &CONF_allow_float_to_int, sizeof(CONF_allow_float_to_int));
+    hash = HashBytes(hash, &CONF_float_to_int8_limit, sizeof(CONF_float_to_int8_limit));
+    hash = HashBytes(hash, &CONF_float_to_int16_limit, sizeof(CONF_float_to_int16_limit));
+    hash = HashBytes(hash, &CONF_flat_height_delta_limit, sizeof(CONF_flat_height_delta_limit));
+    hash = HashBytes(hash, &CONF_flat_liquid_delta_limit, sizeof(CONF_flat_liquid_delta_limit));
+    hash = HashBytes(hash, areas, (maxAreaId + 1) * sizeof(uint16));
+    hash = HashBytes(hash, LiqType, (LiqTypeMaxId + 1) * sizeof(uint16));
+    return hash;
+}
+
+struct ADTExtractJob
+{
+    uint32 mapId;
+    uint32 x;
+    uint32 y;
+    std::string mpqName;
+    std::string outputName;
+    uint64 lastHash;                                        // from the previous extraction, 0 if unknown
+    uint64 hash;                                            // 0 if the tile could not be converted
+};
+
+typedef std::map<std::string, uint64> ADTHashMap;
+
+ADTHashMap LoadADTHashes(std::string const& filename)
+{
+    ADTHashMap hashes;
+    FILE* input = fopen(filename.c_str(), "r");
+    if (!input)
+        return hashes;
+
+    char name[64];
+    unsigned long long hash;
+    while (fscanf(input, "%63s %llx", name, &hash) == 2)
+        hashes[name] = uint64(hash);
+
+    fclose(input);
+    return hashes;
+}
+
+void SaveADTHashes(std::string const& filename, std::vector<ADTExtractJob> const& jobs)
+{
+    FILE* output = fopen(filename.c_str(), "w");
+    if (!output)
+    {
+        printf("Can't create the output file '%s'\n", filename.c_str());
+        return;
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i)
+        if (jobs[i].hash)
+            fprintf(output, "%03u%02u%02u.map %016llx\n", jobs[i].mapId, jobs[i].y, jobs[i].x, (unsigned long long)jobs[i].hash);
+
+    fclose(output);
+}
+
+// Hands out the tiles to the converting threads
+class ADTExtractQueue
+{
+    public:
+        ADTExtractQueue(std::vector<ADTExtractJob>& jobs, uint32 build)
+            : _jobs(jobs), _build(build), _settingsHash(HashConvertSettings(build)), _next(0), _done(0), _skipped(0) { }
+
+        void Run(HANDLE mpq);
+
+        uint32 GetSkipped() const { return _skipped; }
+
+    private:
+        ADTExtractJob* Next();
+        void Finished(bool skipped);
+
+        std::vector<ADTExtractJob>& _jobs;
+        uint32 _build;
+        uint64 _settingsHash;
+        std::mutex _lock;
+        size_t _next;
+        size_t _done;
+        uint32 _skipped;
+};
+
+ADTExtractJob* ADTExtractQueue::Next()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _next < _jobs.size() ? &_jobs[_next++] : NULL;
+}
+
+void ADTExtractQueue::Finished(bool skipped)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (skipped)
+        ++_skipped;
+
+    // draw progress bar
+    size_t percent = (100 * ++_done) / _jobs.size();
+    if (percent != (100 * (_done - 1)) / _jobs.size())
+        printf("Processing........................%u%%\r", uint32(percent));
+}
+
+void ADTExtractQueue::Run(HANDLE mpq)
+{
+    ADTConverter* converter = new ADTConverter();
+    while (ADTExtractJob* job = Next())
+    {
+        bool skipped = false;
+        ADT_file adt;
+        if (adt.loadFile(mpq, job->mpqName.c_str()))
+        {
+            job->hash = HashBytes(_settingsHash, adt.GetData(), adt.GetDataSize());
+            if (CONF_incremental && job->hash == job->lastHash && FileExists(job->outputName.c_str()))
+                skipped = true;
+            else if (!converter->ConvertADT(adt, job->mpqName.c_str(), job->outputName.c_str(), _build))
+                job->hash = 0;
+        }
+
+        Finished(skipped);
+    }
+    delete converter;
+}
+
+void ExtractADTThread(ADTExtractQueue* queue)
+{
+    HANDLE mpq = NULL;
+    if (!LoadCommonMPQFiles(mpq, false))
+        return;
+
+    queue->Run(mpq);
+    SFileCloseArchive(mpq);
+}
+
 void ExtractMapsFromMpq(uint32 build)
 {
     char mpq_filename[1024];
     char output_filename[1024];
     char mpq_map_name[1024];
+    char map_filename[64];
 
     printf("Extracting maps...\n");
 
@@ -1046,6 +1469,9 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
+    ADTHashMap lastHashes = LoadADTHashes(path + ADT_HASHES_FILE);
+    std::vector<ADTExtractJob> jobs;
+
     printf("Convert map files\n");
     for (uint32 z = 0; z < map_count; ++z)
     {
@@ -1064,15 +1490,48 @@ void ExtractMapsFromMpq(uint32 build)
                     continue;
 
                 sprintf(mpq_filename, "World\\Maps\\%s\\%s_%u_%u.adt", map_ids[z].name, map_ids[z].name, x, y);
-                sprintf(output_filename, "%s/maps/%03u%02u%02u.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpq_filename, output_filename, y, x, build);
+                sprintf(map_filename, "%03u%02u%02u.map", map_ids[z].id, y, x);
+                sprintf(output_filename, "%s/maps/%s", output_path, map_filename);
+
+                ADTExtractJob job;
+                job.mapId = map_ids[z].id;
+                job.x = x;
+                job.y = y;
+                job.mpqName = mpq_filename;
+                job.outputName = output_filename;
+                job.hash = 0;
+                ADTHashMap::const_iterator itr = lastHashes.find(map_filename);
+                job.lastHash = itr != lastHashes.end() ? itr->second : 0;
+                jobs.push_back(job);
             }
+        }
+    }
 
-            // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y+1)) / WDT_MAP_SIZE);
+    if (!jobs.empty())
+    {
+        uint32 threads = std::min<uint32>(CONF_threads, uint32(jobs.size()));
+        printf("Converting %u map tiles on %u thread(s)\n", uint32(jobs.size()), threads);
+
+        // every tile is written by one thread only, the output does not depend on the thread count
+        ADTExtractQueue queue(jobs, build);
+        std::vector<std::thread*> workers;
+        for (uint32 i = 1; i < threads; ++i)
+            workers.push_back(new std::thread(ExtractADTThread, &queue));
+
+        queue.Run(WorldMpq);
+
+        for (size_t i = 0; i < workers.size(); ++i)
+        {
+            workers[i]->join();
+            delete workers[i];
         }
+
+        if (CONF_incremental)
+            printf("\n%u of %u map tiles unchanged", queue.GetSkipped(), uint32(jobs.size()));
     }
 
+    SaveADTHashes(path + ADT_HASHES_FILE, jobs);
+
     printf("\n");
     delete [] areas;
     delete [] map_ids;
@@ -1269,31 +1728,33 @@ bool LoadLocaleMPQFile(int locale)
     return true;
 }
 
-void LoadCommonMPQFiles(uint32 build)
+// Opens the world MPQ with its patches, the extracting threads each open their own handle
+bool LoadCommonMPQFiles(HANDLE& mpq, bool log)
 {
     TCHAR filename[512];
 
     _stprintf(filename, _T("%s/Data/world.MPQ"), input_path);
-    _tprintf(_T("Loading common MPQ files\n"));
-    if (!SFileOpenArchive(filename, 0, MPQ_OPEN_READ_ONLY, &WorldMpq))
+    if (log)
+        _tprintf(_T("Loading common MPQ files\n"));
+    if (!SFileOpenArchive(filename, 0, MPQ_OPEN_READ_ONLY, &mpq))
     {
         if (GetLastError() != ERROR_PATH_NOT_FOUND)
             _tprintf(_T("Cannot open archive %s\n"), filename);
-        return;
+        return false;
     }
 
     int count = sizeof(CONF_mpq_list) / sizeof(char*);
     for (int i = 1; i < count; ++i)
     {
         _stprintf(filename, _T("%s/Data/%s"), input_path, CONF_mpq_list[i]);
-        if (!SFileOpenPatchArchive(WorldMpq, filename, "", 0))
+        if (!SFileOpenPatchArchive(mpq, filename, "", 0))
         {
             if (GetLastError() != ERROR_PATH_NOT_FOUND)
                 _tprintf(_T("Cannot open archive %s\n"), filename);
-            else
+            else if (log)
                 _tprintf(_T("Not found %s\n"), filename);
         }
-        else
+        else if (log)
             _tprintf(_T("Loaded %s\n"), filename);
 
     }
@@ -1308,19 +1769,21 @@ void LoadCommonMPQFiles(uint32 build)
         memset(filename, 0, sizeof(filename));
         _stprintf(filename, _T("%s/Data/wow-update-base-%u.MPQ"), input_path, Builds[i]);
  
-        if (!SFileOpenPatchArchive(WorldMpq, filename, "base", 0))
+        if (!SFileOpenPatchArchive(mpq, filename, "base", 0))
         {
             if (GetLastError() != ERROR_PATH_NOT_FOUND)
                 _tprintf(_T("Cannot open patch archive %s\n"), filename);
-            else
+            else if (log)
                 _tprintf(_T("Not found %s\n"), filename);
             continue;
         }
-        else
+        else if (log)
             _tprintf(_T("Loaded %s\n"), filename);
     }
 
-    printf("\n");
+    if (log)
+        printf("\n");
+    return true;
 }
 
 int main(int argc, char * arg[])
@@ -1330,6 +1793,9 @@ int main(int argc, char * arg[])
 
     HandleArgs(argc, arg);
 
+    if (CONF_simd_check && !RunSimdSelfCheck())
+        return 1;
+
     int FirstLocale = -1;
     uint32 build = 0;
 
@@ -1395,7 +1861,7 @@ int main(int argc, char * arg[])
 
         // Open MPQs
         LoadLocaleMPQFile(FirstLocale);
-        LoadCommonMPQFiles(build);
+        LoadCommonMPQFiles(WorldMpq, true);
 
         // Extract maps
         ExtractMapsFromMpq(build);
@@ -1403,6 +1869,12 @@ int main(int argc, char * arg[])
         // Close MPQs
         SFileCloseArchive(WorldMpq);
         SFileCloseArchive(LocaleMpq);
+
+        if (CONF_simd_check && SimdCheckMismatches != 0)
+        {
+            printf("SSE2 and scalar map conversion differ in %u place(s)\n", uint32(SimdCheckMismatches));
+            return 1;
+        }
     }
 
     return 0;
@@ -36,7 +36,7 @@ FileLoader::~FileLoader()
     free();
 }
 
-bool FileLoader::loadFile(HANDLE mpq, char* filename, bool log)
+bool FileLoader::loadFile(HANDLE mpq, char const* filename, bool log)
 {
     free();
     HANDLE file;
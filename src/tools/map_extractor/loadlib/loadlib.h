@@ -81,7 +81,7 @@ public:
     file_MVER *version;
     FileLoader();
     ~FileLoader();
-    bool loadFile(HANDLE mpq, char *filename, bool log = true);
+    bool loadFile(HANDLE mpq, char const* filename, bool log = true);
     virtual void free();
 };
 #endif
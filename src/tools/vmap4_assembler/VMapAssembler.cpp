@@ -19,33 +19,141 @@
  
 #include <string>
 #include <iostream>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+
+#include <ace/OS_NS_unistd.h>
+#include <ace/OS_NS_sys_stat.h>
+#include <ace/Dirent.h>
 
 #include "TileAssembler.h"
 
+struct FileChecksum
+{
+    FileChecksum() : size(0), hash(2166136261u) { }
+
+    uint64 size;
+    uint32 hash;
+};
+
+typedef std::map<std::string, FileChecksum> ChecksumMap;
+
+// FNV-1a over every file in the directory, keyed by file name
+static bool checksumDirectory(std::string const& dirName, ChecksumMap& sums)
+{
+    ACE_Dirent dir;
+    if (dir.open(dirName.c_str()) == -1)
+    {
+        std::cout << "can't open directory " << dirName << std::endl;
+        return false;
+    }
+
+    while (ACE_DIRENT* entry = dir.read())
+    {
+        std::string name = entry->d_name;
+        if (name == "." || name == "..")
+            continue;
+
+        FILE* file = fopen((dirName + "/" + name).c_str(), "rb");
+        if (!file)
+            continue;
+
+        FileChecksum& sum = sums[name];
+        unsigned char buffer[64 * 1024];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            for (size_t i = 0; i < read; ++i)
+                sum.hash = (sum.hash ^ buffer[i]) * 16777619u;
+            sum.size += read;
+        }
+        fclose(file);
+    }
+
+    return true;
+}
+
+static bool convert(std::string const& src, std::string const& dest, uint32 threads)
+{
+    std::cout << "using " << src << " as source directory and writing output to " << dest << " with " << threads << " thread(s)" << std::endl;
+
+    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest, threads);
+    bool success = ta->convertWorld2();
+    delete ta;
+    return success;
+}
+
+// the output must be the same for any number of threads, this rebuilds it
+// with a single thread into verifyDir and compares both trees file by file
+static bool verify(std::string const& src, std::string const& dest, std::string const& verifyDir)
+{
+    ACE_OS::mkdir(verifyDir.c_str());
+    if (!convert(src, verifyDir, 1))
+        return false;
+
+    ChecksumMap threaded, single;
+    if (!checksumDirectory(dest, threaded) || !checksumDirectory(verifyDir, single))
+        return false;
+
+    uint32 mismatches = 0;
+    for (ChecksumMap::const_iterator itr = single.begin(); itr != single.end(); ++itr)
+    {
+        ChecksumMap::const_iterator other = threaded.find(itr->first);
+        if (other == threaded.end())
+        {
+            std::cout << "missing in " << dest << ": " << itr->first << std::endl;
+            ++mismatches;
+        }
+        else if (other->second.size != itr->second.size || other->second.hash != itr->second.hash)
+        {
+            std::cout << "differs: " << itr->first << std::endl;
+            ++mismatches;
+        }
+    }
+
+    for (ChecksumMap::const_iterator itr = threaded.begin(); itr != threaded.end(); ++itr)
+    {
+        if (single.find(itr->first) == single.end())
+        {
+            std::cout << "missing in " << verifyDir << ": " << itr->first << std::endl;
+            ++mismatches;
+        }
+    }
+
+    std::cout << "verified " << single.size() << " file(s), " << mismatches << " mismatch(es)" << std::endl;
+    return mismatches == 0;
+}
+
 int main(int argc, char* argv[])
 {
-    if(argc != 3)
+    if(argc < 3 || argc > 5)
     {
         //printf("\nusage: %s <raw data dir> <vmap dest dir> [config file name]\n", argv[0]);
-        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
+        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir> [threads [verify dir]]" << std::endl;
+        std::cout << "  with a verify dir the output is rebuilt there with one thread and compared against <vmap dest dir>" << std::endl;
         return 1;
     }
 
     std::string src = argv[1];
     std::string dest = argv[2];
 
-    std::cout << "using " << src << " as source directory and writing output to " << dest << std::endl;
+    long threads = argc >= 4 ? atol(argv[3]) : ACE_OS::num_processors_online();
+    if (threads < 1)
+        threads = 1;
 
-    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest);
-
-    if(!ta->convertWorld2())
+    if (!convert(src, dest, uint32(threads)))
     {
         std::cout << "exit with errors" << std::endl;
-        delete ta;
         return 1;
     }
 
-    delete ta;
+    if (argc == 5 && !verify(src, dest, argv[4]))
+    {
+        std::cout << "verify failed, the threaded output differs from the single threaded one" << std::endl;
+        return 1;
+    }
+
     std::cout << "Ok, all done" << std::endl;
     return 0;
 }